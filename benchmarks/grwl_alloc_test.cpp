@@ -0,0 +1,280 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+//
+// This program checks that event processing does not allocate once the
+// library has warmed up.  It installs counting allocator hooks, drives window
+// and cursor events through the event loop, replays preedit and drop events
+// from an input log, requests the clipboard string and fails if any
+// allocation is made after the warm-up.
+//
+// Not covered: clipboard transfers between clients, such as X11 INCR
+// transfers and Wayland data offers, and the native input method paths of
+// each platform.  The clipboard request is served by the library itself as
+// it owns the selection, and preedit and drop events enter through the
+// replay path instead of the platform event handlers.
+//
+// Usage: grwl_alloc_test [--platform any|win32|cocoa|x11|wayland|null] [--count N]
+//
+//===========================================================================
+
+#include <GRWL/grwl.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The input log read by grwlReplayInput, see src/input_record.cpp
+#define LOG_PATH "grwl_alloc_test.log"
+#define RECORD_PREEDIT 13
+#define RECORD_DROP 19
+
+// Allocations are only counted while this is set, so that setup and teardown
+// do not need to be allocation-free
+static bool counting;
+static long allocationCount;
+static long eventCount;
+
+static void* allocate(size_t size, void* user)
+{
+    if (counting)
+    {
+        allocationCount++;
+    }
+
+    return malloc(size);
+}
+
+static void* reallocate(void* block, size_t size, void* user)
+{
+    if (counting)
+    {
+        allocationCount++;
+    }
+
+    return realloc(block, size);
+}
+
+static void deallocate(void* block, void* user)
+{
+    free(block);
+}
+
+static void errorCallback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void cursorPosCallback(GRWLwindow* window, double xpos, double ypos)
+{
+    eventCount++;
+}
+
+static void windowPosCallback(GRWLwindow* window, int xpos, int ypos)
+{
+    eventCount++;
+}
+
+static void windowSizeCallback(GRWLwindow* window, int width, int height)
+{
+    eventCount++;
+}
+
+static void preeditCallback(GRWLwindow* window, int preeditCount, unsigned int* preeditString, int blockCount,
+                            int* blockSizes, int focusedBlock, int caret)
+{
+    eventCount++;
+}
+
+static void dropCallback(GRWLwindow* window, int pathCount, const char* paths[])
+{
+    eventCount++;
+}
+
+static void clipboardCallback(const char* string, void* user)
+{
+    eventCount++;
+}
+
+static void writeRecord(FILE* file, uint16_t type, const void* payload, uint16_t size)
+{
+    const uint64_t time = 0;
+    const uint32_t target = 1;
+
+    fwrite(&time, sizeof(time), 1, file);
+    fwrite(&target, sizeof(target), 1, file);
+    fwrite(&type, sizeof(type), 1, file);
+    fwrite(&size, sizeof(size), 1, file);
+    fwrite(payload, 1, size, file);
+}
+
+// Writes an input log with a preedit and a drop event for the first window
+//
+static bool writeInputLog()
+{
+    FILE* file = fopen(LOG_PATH, "wb");
+    if (!file)
+    {
+        return false;
+    }
+
+    const uint64_t frequency = 1000000;
+    fwrite("GRWLINP1", 1, 8, file);
+    fwrite(&frequency, sizeof(frequency), 1, file);
+
+    // Text count, block count, focused block and caret, followed by the text
+    // and the block sizes
+    const int preedit[] = { 3, 1, 0, 3, 'g', 'r', 'w', 3 };
+    writeRecord(file, RECORD_PREEDIT, preedit, sizeof(preedit));
+
+    const char drop[] = "/tmp/first.txt\0/tmp/second.txt";
+    writeRecord(file, RECORD_DROP, drop, sizeof(drop));
+
+    return fclose(file) == 0;
+}
+
+static int parsePlatform(const char* name)
+{
+    static const struct
+    {
+        const char* name;
+        int ID;
+    } platforms[] = {
+        { "any", GRWL_ANY_PLATFORM },     { "win32", GRWL_PLATFORM_WIN32 },     { "cocoa", GRWL_PLATFORM_COCOA },
+        { "x11", GRWL_PLATFORM_X11 },     { "wayland", GRWL_PLATFORM_WAYLAND }, { "null", GRWL_PLATFORM_NULL },
+    };
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); i++)
+    {
+        if (strcmp(name, platforms[i].name) == 0)
+        {
+            return platforms[i].ID;
+        }
+    }
+
+    return 0;
+}
+
+// Generates a batch of window system events and drains them
+//
+static void runIteration(GRWLwindow* window, long i)
+{
+    grwlSetWindowPos(window, 100 + (int)(i & 1), 100);
+    grwlSetWindowSize(window, 640 + (int)(i & 1), 480);
+    grwlSetCursorPos(window, (double)(i & 63), (double)(i & 31));
+    grwlRequestClipboardString(clipboardCallback, nullptr);
+    grwlPostEmptyEvent();
+    grwlPollEvents();
+    grwlWaitEventsTimeout(0.0);
+
+    grwlReplayInput(LOG_PATH, 0.0);
+    grwlGetClipboardString(nullptr);
+    grwlGetKey(window, GRWL_KEY_A);
+    grwlGetMouseButton(window, GRWL_MOUSE_BUTTON_LEFT);
+}
+
+static void usage()
+{
+    printf("Usage: grwl_alloc_test [--platform any|win32|cocoa|x11|wayland|null] [--count N]\n");
+}
+
+int main(int argc, char** argv)
+{
+    int platform = GRWL_PLATFORM_NULL;
+    long count = 1000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--platform") == 0 && i + 1 < argc)
+        {
+            platform = parsePlatform(argv[++i]);
+            if (!platform)
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+        {
+            count = atol(argv[++i]);
+            if (count < 1)
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+        }
+        else
+        {
+            usage();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    GRWLallocator allocator = {};
+    allocator.allocate = allocate;
+    allocator.reallocate = reallocate;
+    allocator.deallocate = deallocate;
+
+    grwlSetErrorCallback(errorCallback);
+    grwlInitAllocator(&allocator);
+    grwlInitHint(GRWL_PLATFORM, platform);
+
+    if (!grwlInit())
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    grwlWindowHint(GRWL_CLIENT_API, GRWL_NO_API);
+    GRWLwindow* window = grwlCreateWindow(640, 480, "GRWL allocation test", nullptr, nullptr);
+    if (!window)
+    {
+        grwlTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    grwlSetCursorPosCallback(window, cursorPosCallback);
+    grwlSetWindowPosCallback(window, windowPosCallback);
+    grwlSetWindowSizeCallback(window, windowSizeCallback);
+    grwlSetPreeditCallback(window, preeditCallback);
+    grwlSetDropCallback(window, dropCallback);
+    grwlSetClipboardString(nullptr, "GRWL allocation test");
+
+    if (!writeInputLog())
+    {
+        fprintf(stderr, "Error: Failed to write input log\n");
+        grwlTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    // Let the library grow its buffers to fit the working set
+    for (long i = 0; i < 100; i++)
+    {
+        runIteration(window, i);
+    }
+
+    eventCount = 0;
+    counting = true;
+
+    for (long i = 0; i < count; i++)
+    {
+        runIteration(window, i);
+    }
+
+    counting = false;
+
+    grwlDestroyWindow(window);
+    grwlTerminate();
+    remove(LOG_PATH);
+
+    printf("%li iterations, %li events, %li allocations\n", count, eventCount, allocationCount);
+
+    if (allocationCount > 0)
+    {
+        fprintf(stderr, "Error: Event processing allocated after warm-up\n");
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
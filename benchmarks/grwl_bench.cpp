@@ -0,0 +1,550 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+//
+// This program measures the cost of the library paths that matter most for
+// latency and prints the results as JSON, so that they can be compared
+// between releases.
+//
+// Usage: grwl_bench [--platform any|win32|cocoa|x11|wayland|null] [--scale N]
+//
+// On X11 it is intended to be run under Xvfb.
+//
+//===========================================================================
+
+#if defined(GRWL_BENCH_INTERNAL)
+    // The text transcoding helpers are not part of the public API and can only
+    // be called when linking with the static library
+    #include "internal.hpp"
+#else
+    #include <GRWL/grwl.h>
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef std::chrono::steady_clock Clock;
+
+// A single benchmark result
+//
+typedef struct Result
+{
+    const char* name;
+    const char* unit;
+    long iterations;
+    double total;
+    double min;
+    double max;
+    // Events delivered to callbacks, or -1 if not applicable
+    long events;
+} Result;
+
+static Result results[32];
+static int resultCount;
+static long eventCount;
+
+static double nanosecondsSince(Clock::time_point start)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+static Result* addResult(const char* name, const char* unit)
+{
+    Result* result = results + resultCount++;
+    result->name = name;
+    result->unit = unit;
+    result->iterations = 0;
+    result->total = 0.0;
+    result->min = 1e300;
+    result->max = 0.0;
+    result->events = -1;
+    return result;
+}
+
+static void addSample(Result* result, double nanoseconds)
+{
+    result->iterations++;
+    result->total += nanoseconds;
+
+    if (nanoseconds < result->min)
+    {
+        result->min = nanoseconds;
+    }
+    if (nanoseconds > result->max)
+    {
+        result->max = nanoseconds;
+    }
+}
+
+static void errorCallback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void cursorPosCallback(GRWLwindow* window, double xpos, double ypos)
+{
+    eventCount++;
+}
+
+static void windowPosCallback(GRWLwindow* window, int xpos, int ypos)
+{
+    eventCount++;
+}
+
+static void userEventCallback(int type, void* payload)
+{
+    eventCount++;
+}
+
+static int parsePlatform(const char* name)
+{
+    static const struct
+    {
+        const char* name;
+        int ID;
+    } platforms[] = {
+        { "any", GRWL_ANY_PLATFORM },     { "win32", GRWL_PLATFORM_WIN32 },     { "cocoa", GRWL_PLATFORM_COCOA },
+        { "x11", GRWL_PLATFORM_X11 },     { "wayland", GRWL_PLATFORM_WAYLAND }, { "null", GRWL_PLATFORM_NULL },
+    };
+
+    for (size_t i = 0; i < sizeof(platforms) / sizeof(platforms[0]); i++)
+    {
+        if (strcmp(name, platforms[i].name) == 0)
+        {
+            return platforms[i].ID;
+        }
+    }
+
+    return 0;
+}
+
+static const char* getPlatformName(int platform)
+{
+    switch (platform)
+    {
+        case GRWL_PLATFORM_WIN32:
+            return "win32";
+        case GRWL_PLATFORM_COCOA:
+            return "cocoa";
+        case GRWL_PLATFORM_X11:
+            return "x11";
+        case GRWL_PLATFORM_WAYLAND:
+            return "wayland";
+        case GRWL_PLATFORM_NULL:
+            return "null";
+    }
+
+    return "unknown";
+}
+
+static bool init(int platform)
+{
+    grwlInitHint(GRWL_PLATFORM, platform);
+    return grwlInit();
+}
+
+static GRWLwindow* createWindow()
+{
+    grwlDefaultWindowHints();
+    grwlWindowHint(GRWL_VISIBLE, false);
+    grwlWindowHint(GRWL_CLIENT_API, GRWL_NO_API);
+    return grwlCreateWindow(640, 480, "GRWL benchmark", nullptr, nullptr);
+}
+
+static void benchInit(int platform, long count)
+{
+    Result* result = addResult("init_terminate", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        if (!init(platform))
+        {
+            return;
+        }
+        addSample(result, nanosecondsSince(start));
+
+        grwlTerminate();
+    }
+}
+
+static void benchWindowCreation(long count)
+{
+    Result* create = addResult("create_window", "ns/call");
+    Result* destroy = addResult("destroy_window", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        Clock::time_point start = Clock::now();
+        GRWLwindow* window = createWindow();
+        if (!window)
+        {
+            return;
+        }
+        addSample(create, nanosecondsSince(start));
+
+        start = Clock::now();
+        grwlDestroyWindow(window);
+        addSample(destroy, nanosecondsSince(start));
+    }
+}
+
+static void benchPollEvents(GRWLwindow* window, long count)
+{
+    Result* idle = addResult("poll_events_idle", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        grwlPollEvents();
+        addSample(idle, nanosecondsSince(start));
+    }
+
+    Result* wakeup = addResult("post_empty_event_poll_events", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        grwlPostEmptyEvent();
+        grwlPollEvents();
+        addSample(wakeup, nanosecondsSince(start));
+    }
+
+    // Generate events by moving the window and cursor and by posting user
+    // events, then time how long it takes to drain them through the callbacks
+    // Some platforms, like Null, deliver the window events from within the
+    // calls that move the window and cursor, so the user events ensure that
+    // every platform dispatches events from the event processing
+    grwlShowWindow(window);
+    grwlSetCursorPosCallback(window, cursorPosCallback);
+    grwlSetWindowPosCallback(window, windowPosCallback);
+    grwlSetUserEventCallback(userEventCallback);
+
+    Result* events = addResult("poll_events_dispatch", "ns/call");
+    events->events = 0;
+
+    for (long i = 0; i < count; i++)
+    {
+        grwlSetWindowPos(window, 100 + (int)(i & 1), 100);
+        grwlSetCursorPos(window, (double)(i & 63), (double)(i & 31));
+
+        for (int j = 0; j < 8; j++)
+        {
+            grwlPostUserEvent(j, nullptr);
+        }
+
+        // Only count the events delivered from within the event processing
+        eventCount = 0;
+
+        const Clock::time_point start = Clock::now();
+        grwlPollEvents();
+        addSample(events, nanosecondsSince(start));
+
+        events->events += eventCount;
+    }
+
+    grwlSetCursorPosCallback(window, nullptr);
+    grwlSetWindowPosCallback(window, nullptr);
+    grwlSetUserEventCallback(nullptr);
+    grwlHideWindow(window);
+}
+
+static void benchMonitors(long count)
+{
+    GRWLmonitor* monitor = grwlGetPrimaryMonitor();
+    if (!monitor)
+    {
+        return;
+    }
+
+    Result* position = addResult("get_monitor_pos", "ns/call");
+    Result* mode = addResult("get_video_mode", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        int xpos, ypos;
+
+        const Clock::time_point start = Clock::now();
+        grwlGetMonitorPos(monitor, &xpos, &ypos);
+        addSample(position, nanosecondsSince(start));
+    }
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        grwlGetVideoMode(monitor);
+        addSample(mode, nanosecondsSince(start));
+    }
+}
+
+static void benchGamepads(long count)
+{
+    Result* result = addResult("get_gamepad_state", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        GRWLgamepadstate state;
+
+        const Clock::time_point start = Clock::now();
+        grwlGetGamepadState(GRWL_JOYSTICK_1, &state);
+        addSample(result, nanosecondsSince(start));
+    }
+}
+
+static void benchImages(GRWLwindow* window, long count)
+{
+    static unsigned char pixels[256 * 256 * 4];
+
+    for (size_t i = 0; i < sizeof(pixels); i++)
+    {
+        pixels[i] = (unsigned char)(i * 7);
+    }
+
+    GRWLimage image = {};
+    image.width = 256;
+    image.height = 256;
+    image.pixels = pixels;
+
+    Result* cursor = addResult("create_cursor_256", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        GRWLcursor* handle = grwlCreateCursor(&image, 0, 0);
+        addSample(cursor, nanosecondsSince(start));
+
+        grwlDestroyCursor(handle);
+    }
+
+    Result* icon = addResult("set_window_icon_256", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        grwlSetWindowIcon(window, 1, &image);
+        addSample(icon, nanosecondsSince(start));
+    }
+}
+
+static void benchClipboard(long count)
+{
+    // A multi-megabyte payload with some non-ASCII text, like a pasted log
+    const size_t size = 4 * 1024 * 1024;
+    char* text = (char*)malloc(size + 1);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        text[i] = (char)('a' + i % 26);
+        if (i % 64 == 62)
+        {
+            text[i] = '\xc3';
+            text[++i] = '\xa9';
+        }
+    }
+
+    text[size] = '\0';
+
+    Result* result = addResult("clipboard_roundtrip_4mb", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        grwlSetClipboardString(nullptr, text);
+        grwlGetClipboardString(nullptr);
+        addSample(result, nanosecondsSince(start));
+    }
+
+    free(text);
+}
+
+#if defined(GRWL_BENCH_INTERNAL)
+
+static void benchTranscoding(long count)
+{
+    // The same kind of multi-megabyte payload as the clipboard benchmark,
+    // passed straight to the helpers used for selections and preedit text
+    const size_t size = 4 * 1024 * 1024;
+    char* text = (char*)malloc(size + 1);
+    uint32_t* codepoints = (uint32_t*)malloc(size * sizeof(uint32_t));
+    char* utf8 = (char*)malloc(size * 2 + 1);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        text[i] = (char)('a' + i % 26);
+        if (i % 64 == 62)
+        {
+            text[i] = '\xc3';
+            text[++i] = '\xa9';
+        }
+    }
+
+    text[size] = '\0';
+
+    Result* decode = addResult("decode_utf8_4mb", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        _grwlDecodeUTF8(codepoints, text, size);
+        addSample(decode, nanosecondsSince(start));
+    }
+
+    // Interpreted as Latin-1 the two-byte sequences become two characters
+    Result* latin1 = addResult("convert_latin1_4mb", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        const Clock::time_point start = Clock::now();
+        if (_grwlGetLatin1LengthUTF8(text, size) <= size * 2)
+        {
+            utf8[_grwlConvertLatin1toUTF8(utf8, text, size)] = '\0';
+        }
+        addSample(latin1, nanosecondsSince(start));
+    }
+
+    free(utf8);
+    free(codepoints);
+    free(text);
+}
+
+static void benchUriList(long count)
+{
+    // A drop of many files with escaped characters in their paths, as sent by
+    // file managers
+    const int entryCount = 10000;
+    const char* entry = "file:///home/user/Pictures/Holiday%202024/IMG_%d%%20copy.jpg\r\n";
+    const size_t entrySize = 80;
+    char* text = (char*)malloc(entryCount * entrySize + 1);
+    size_t length = 0;
+
+    for (int i = 0; i < entryCount; i++)
+    {
+        length += snprintf(text + length, entrySize, entry, i);
+    }
+
+    Result* result = addResult("parse_uri_list_10000", "ns/call");
+
+    for (long i = 0; i < count; i++)
+    {
+        int pathCount;
+
+        const Clock::time_point start = Clock::now();
+        _grwlParseUriList(text, &pathCount);
+        addSample(result, nanosecondsSince(start));
+
+        // The paths are allocated from the per-event arena
+        _grwlResetArena();
+    }
+
+    free(text);
+}
+
+#endif
+
+static void printResults(int platform)
+{
+    printf("{\n");
+    printf("  \"version\": \"%s\",\n", grwlGetVersionString());
+    printf("  \"platform\": \"%s\",\n", getPlatformName(platform));
+    printf("  \"results\": [\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        const Result* result = results + i;
+        const double mean = result->iterations ? result->total / result->iterations : 0.0;
+
+        printf("    {\"name\": \"%s\", \"unit\": \"%s\", \"iterations\": %li, \"mean\": %.1f, \"min\": %.1f, "
+               "\"max\": %.1f",
+               result->name, result->unit, result->iterations, mean, result->iterations ? result->min : 0.0,
+               result->max);
+
+        if (result->events >= 0)
+        {
+            const double seconds = result->total / 1e9;
+            printf(", \"events\": %li, \"events_per_second\": %.1f", result->events,
+                   seconds > 0.0 ? result->events / seconds : 0.0);
+        }
+
+        printf("}%s\n", i + 1 < resultCount ? "," : "");
+    }
+
+    printf("  ]\n");
+    printf("}\n");
+}
+
+static void usage()
+{
+    printf("Usage: grwl_bench [--platform any|win32|cocoa|x11|wayland|null] [--scale N]\n");
+}
+
+int main(int argc, char** argv)
+{
+    int platform = GRWL_ANY_PLATFORM;
+    long scale = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--platform") == 0 && i + 1 < argc)
+        {
+            platform = parsePlatform(argv[++i]);
+            if (!platform)
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+        {
+            scale = atol(argv[++i]);
+            if (scale < 1)
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+        }
+        else
+        {
+            usage();
+            exit(strcmp(argv[i], "--help") == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+
+    grwlSetErrorCallback(errorCallback);
+
+    benchInit(platform, 10 * scale);
+
+    if (!init(platform))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    platform = grwlGetPlatform();
+
+    benchWindowCreation(100 * scale);
+
+    GRWLwindow* window = createWindow();
+    if (!window)
+    {
+        grwlTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    benchPollEvents(window, 10000 * scale);
+    benchMonitors(100000 * scale);
+    benchGamepads(100000 * scale);
+    benchImages(window, 100 * scale);
+    benchClipboard(10 * scale);
+#if defined(GRWL_BENCH_INTERNAL)
+    benchTranscoding(10 * scale);
+    benchUriList(100 * scale);
+#endif
+
+    grwlDestroyWindow(window);
+    printResults(platform);
+
+    grwlTerminate();
+    exit(EXIT_SUCCESS);
+}
@@ -336,6 +336,82 @@ extern "C"
 #define GRWL_HAT_LEFT_DOWN (GRWL_HAT_LEFT | GRWL_HAT_DOWN)
 /*! @} */
 
+/*! @defgroup event_types Event types
+ *  @brief Event types.
+ *
+ *  See [event queue](@ref event_queue) for how these are used.
+ *
+ *  @ingroup input
+ *  @{ */
+#define GRWL_EVENT_NONE 0
+#define GRWL_EVENT_KEY 1
+#define GRWL_EVENT_CHAR 2
+#define GRWL_EVENT_MOUSE_BUTTON 3
+#define GRWL_EVENT_CURSOR_POS 4
+#define GRWL_EVENT_CURSOR_ENTER 5
+#define GRWL_EVENT_SCROLL 6
+#define GRWL_EVENT_WINDOW_POS 7
+#define GRWL_EVENT_WINDOW_SIZE 8
+#define GRWL_EVENT_WINDOW_CLOSE 9
+#define GRWL_EVENT_WINDOW_REFRESH 10
+#define GRWL_EVENT_WINDOW_FOCUS 11
+#define GRWL_EVENT_WINDOW_ICONIFY 12
+#define GRWL_EVENT_WINDOW_MAXIMIZE 13
+#define GRWL_EVENT_FRAMEBUFFER_SIZE 14
+#define GRWL_EVENT_WINDOW_CONTENT_SCALE 15
+#define GRWL_EVENT_MONITOR 16
+#define GRWL_EVENT_JOYSTICK 17
+#define GRWL_EVENT_JOYSTICK_AXIS 18
+#define GRWL_EVENT_JOYSTICK_BUTTON 19
+#define GRWL_EVENT_JOYSTICK_HAT 20
+#define GRWL_EVENT_KEYBOARD_LAYOUT 21
+#define GRWL_EVENT_USER 22
+/*! @} */
+
+/*! @defgroup watch_events Watch events
+ *  @brief File descriptor watch event flags.
+ *
+ *  See [watching file descriptors](@ref events_watch) for how these are used.
+ *
+ *  @ingroup window
+ *  @{ */
+/*! @brief The file descriptor is readable.
+ */
+#define GRWL_WATCH_READ 0x0001
+/*! @brief The file descriptor is writable.
+ */
+#define GRWL_WATCH_WRITE 0x0002
+/*! @brief An error or hangup occurred on the file descriptor.
+ *
+ *  This is always reported and does not need to be requested.
+ */
+#define GRWL_WATCH_ERROR 0x0004
+/*! @} */
+
+/*! @defgroup image_formats Image formats
+ *  @brief Pixel formats of image data.
+ *
+ *  See [image formats](@ref image_formats_guide) for how these are used.
+ *
+ *  @ingroup window
+ *  @{ */
+/*! @brief Non-premultiplied RGBA, with the red channel first.
+ *
+ *  This is the default format of a @ref GRWLformattedimage with a zero format
+ *  member, and the format of all @ref GRWLimage pixels.
+ */
+#define GRWL_IMAGE_RGBA 0
+/*! @brief Non-premultiplied BGRA, with the blue channel first.
+ */
+#define GRWL_IMAGE_BGRA 1
+/*! @brief RGBA with the color channels premultiplied by alpha.
+ */
+#define GRWL_IMAGE_RGBA_PREMULTIPLIED 2
+/*! @brief BGRA with the color channels premultiplied by alpha.
+ */
+#define GRWL_IMAGE_BGRA_PREMULTIPLIED 3
+/*! @} */
+
 /*! @defgroup keys Keyboard keys
  *  @brief Keyboard key IDs.
  *
@@ -1334,6 +1410,16 @@ extern "C"
  *  Preedit candidate [init hint](@ref GRWL_MANAGE_PREEDIT_CANDIDATE_hint).
  */
 #define GRWL_MANAGE_PREEDIT_CANDIDATE 0x00050004
+/*! @brief Event queue init hint.
+ *
+ *  Event queue capacity [init hint](@ref GRWL_EVENT_QUEUE_CAPACITY_hint).
+ */
+#define GRWL_EVENT_QUEUE_CAPACITY 0x00050005
+/*! @brief Input thread init hint.
+ *
+ *  Input thread [init hint](@ref GRWL_INPUT_THREAD_hint).
+ */
+#define GRWL_INPUT_THREAD 0x00050006
 /*! @brief macOS specific init hint.
  *
  *  macOS specific [init hint](@ref GRWL_COCOA_CHDIR_RESOURCES_hint).
@@ -1359,6 +1445,11 @@ extern "C"
  *  Wayland specific [init hint](@ref GRWL_WAYLAND_LIBDECOR_hint).
  */
 #define GRWL_WAYLAND_LIBDECOR 0x00053001
+/*! @brief Null specific init hint.
+ *
+ *  Null specific [init hint](@ref GRWL_NULL_MONITOR_COUNT_hint).
+ */
+#define GRWL_NULL_MONITOR_COUNT 0x00054001
 /*! @} */
 
 /*! @addtogroup init
@@ -1586,6 +1677,27 @@ extern "C"
      */
     typedef void (*GRWLerrorfun)(int error_code, const char* description);
 
+    /*! @brief The function pointer type for trace stall callbacks.
+     *
+     *  This is the function pointer type for trace stall callbacks.  A trace stall
+     *  callback function has the following signature:
+     *  @code
+     *  void callback_name(const char* zone, double duration)
+     *  @endcode
+     *
+     *  @param[in] zone The name of the trace zone that exceeded the threshold.
+     *  @param[in] duration The time, in seconds, spent inside the zone.
+     *
+     *  @pointer_lifetime The zone name string is valid for the lifetime of the
+     *  library.
+     *
+     *  @sa @ref init_tracing
+     *  @sa @ref grwlSetTraceStallCallback
+     *
+     *  @ingroup init
+     */
+    typedef void (*GRWLtracestallfun)(const char* zone, double duration);
+
     /*! @brief The function pointer type for keyboard layout callbacks.
      *
      *  This is the function pointer type for keyboard layout callbacks.  A keyboard
@@ -1601,6 +1713,99 @@ extern "C"
      */
     typedef void (*GRWLkeyboardlayoutfun)();
 
+    /*! @brief The function pointer type for user event callbacks.
+     *
+     *  This is the function pointer type for user event callbacks.  A user event
+     *  callback function has the following signature:
+     *  @code
+     *  void callback_name(int type, void* payload)
+     *  @endcode
+     *
+     *  @param[in] type The application defined type passed to @ref
+     *  grwlPostUserEvent.
+     *  @param[in] payload The payload passed to @ref grwlPostUserEvent.
+     *
+     *  @sa @ref events_user
+     *  @sa @ref grwlSetUserEventCallback
+     *
+     *  @ingroup window
+     */
+    typedef void (*GRWLusereventfun)(int type, void* payload);
+
+    /*! @brief The function pointer type for main thread tasks.
+     *
+     *  This is the function pointer type for tasks run on the main thread.  A task
+     *  function has the following signature:
+     *  @code
+     *  void function_name(void* user)
+     *  @endcode
+     *
+     *  @param[in] user The pointer passed to @ref grwlRunOnMainThread.
+     *
+     *  @sa @ref events_user
+     *  @sa @ref grwlRunOnMainThread
+     *
+     *  @ingroup window
+     */
+    typedef void (*GRWLmainthreadfun)(void* user);
+
+    /*! @brief The function pointer type for context jobs.
+     *
+     *  This is the function pointer type for jobs run on a context worker
+     *  thread.  A job function has the following signature:
+     *  @code
+     *  void function_name(void* user)
+     *  @endcode
+     *
+     *  @param[in] user The pointer passed to @ref grwlSubmitContextJob.
+     *
+     *  @sa @ref context_workers
+     *  @sa @ref grwlSubmitContextJob
+     *
+     *  @ingroup context
+     */
+    typedef void (*GRWLcontextjobfun)(void* user);
+
+    /*! @brief The function pointer type for context job completion callbacks.
+     *
+     *  This is the function pointer type for the callbacks called on the main
+     *  thread when a context job has finished.  A completion callback function
+     *  has the following signature:
+     *  @code
+     *  void function_name(GRWLwindow* window, void* sync, void* user)
+     *  @endcode
+     *
+     *  @param[in] window The window whose worker ran the job.
+     *  @param[in] sync The `GLsync` fence object created after the job, or
+     *  `nullptr` if the context does not support sync objects.
+     *  @param[in] user The pointer passed to @ref grwlSubmitContextJob.
+     *
+     *  @sa @ref context_workers
+     *  @sa @ref grwlSubmitContextJob
+     *
+     *  @ingroup context
+     */
+    typedef void (*GRWLcontextjobdonefun)(GRWLwindow* window, void* sync, void* user);
+
+    /*! @brief The function pointer type for file descriptor watch callbacks.
+     *
+     *  This is the function pointer type for file descriptor watch callbacks.
+     *  A watch callback function has the following signature:
+     *  @code
+     *  void function_name(int fd, int events, void* user)
+     *  @endcode
+     *
+     *  @param[in] fd The watched file descriptor.
+     *  @param[in] events The [events](@ref watch_events) that occurred.
+     *  @param[in] user The pointer passed to @ref grwlAddWatchFd.
+     *
+     *  @sa @ref events_watch
+     *  @sa @ref grwlAddWatchFd
+     *
+     *  @ingroup window
+     */
+    typedef void (*GRWLwatchfun)(int fd, int events, void* user);
+
     /*! @brief The function pointer type for window position callbacks.
      *
      *  This is the function pointer type for window position callbacks.  A window
@@ -1993,6 +2198,28 @@ extern "C"
      */
     typedef void (*GRWLdropfun)(GRWLwindow* window, int path_count, const char* paths[]);
 
+    /*! @brief The function pointer type for clipboard string callbacks.
+     *
+     *  This is the function pointer type for clipboard string callbacks.  A
+     *  clipboard string callback function has the following signature:
+     *  @code
+     *  void function_name(const char* string, void* user)
+     *  @endcode
+     *
+     *  @param[in] string The contents of the clipboard as a UTF-8 encoded string,
+     *  or `nullptr` if the clipboard was empty or could not be converted.
+     *  @param[in] user The pointer passed to @ref grwlRequestClipboardString.
+     *
+     *  @pointer_lifetime The string is valid until the callback function
+     *  returns.
+     *
+     *  @sa @ref clipboard
+     *  @sa @ref grwlRequestClipboardString
+     *
+     *  @ingroup input
+     */
+    typedef void (*GRWLclipboardfun)(const char* string, void* user);
+
     /*! @brief The function pointer type for monitor configuration callbacks.
      *
      *  This is the function pointer type for monitor configuration callbacks.
@@ -2183,6 +2410,36 @@ extern "C"
         unsigned char* pixels;
     } GRWLimage;
 
+    /*! @brief Image data with a pixel format.
+     *
+     *  This describes a single 2D image with a specified pixel format and row
+     *  stride.  It is used by @ref grwlSetWindowIconFormatted and @ref
+     *  grwlCreateCursorFormatted.
+     *
+     *  @sa @ref image_formats_guide
+     *
+     *  @ingroup window
+     */
+    typedef struct GRWLformattedimage
+    {
+        /*! The width, in pixels, of this image.
+         */
+        int width;
+        /*! The height, in pixels, of this image.
+         */
+        int height;
+        /*! The pixel data of this image, arranged left-to-right, top-to-bottom.
+         */
+        unsigned char* pixels;
+        /*! The [format](@ref image_formats) of the pixel data.
+         */
+        int format;
+        /*! The distance, in bytes, between the starts of consecutive rows, or
+         *  zero if the rows are packed.
+         */
+        int stride;
+    } GRWLformattedimage;
+
     /*! @brief Gamepad input state
      *
      *  This describes the input state of a gamepad.
@@ -2220,6 +2477,192 @@ extern "C"
         void* user;
     } GRWLallocator;
 
+    /*! @brief Runtime statistics.
+     *
+     *  This describes the counters accumulated by the library since it was
+     *  initialized or since the last call to @ref grwlResetStatistics.
+     *
+     *  @sa @ref init_statistics
+     *  @sa @ref grwlGetStatistics
+     *
+     *  @ingroup init
+     */
+    typedef struct GRWLstatistics
+    {
+        /*! The number of native window system events processed.
+         */
+        uint64_t events;
+        /*! The number of times waiting for events was woken up by activity.
+         */
+        uint64_t pollWakeups;
+        /*! The number of synchronous requests made to the display server.
+         */
+        uint64_t roundTrips;
+        /*! The number of allocations and reallocations made by the library.
+         */
+        uint64_t allocations;
+        /*! The total size, in bytes, of all allocations and reallocations.
+         */
+        uint64_t allocatedBytes;
+        /*! The number of user callbacks called.
+         */
+        uint64_t callbacks;
+        /*! The time, in seconds, spent inside user callbacks.
+         */
+        double callbackTime;
+    } GRWLstatistics;
+
+    /*! @brief Queued event.
+     *
+     *  This describes a single event retrieved from the event queue.  The
+     *  [type](@ref event_types) member determines which member of the union is
+     *  valid.  Event types without a payload only use the common members.
+     *
+     *  @sa @ref event_queue
+     *  @sa @ref grwlGetEvents
+     *
+     *  @ingroup input
+     */
+    typedef struct GRWLevent
+    {
+        /*! The [type](@ref event_types) of this event.
+         */
+        int type;
+        /*! The window that received the event, or `NULL` for monitor, joystick,
+         *  keyboard layout and user events.
+         */
+        GRWLwindow* window;
+        /*! The time at which the event was generated, as a value of the raw
+         *  timer comparable with @ref grwlGetTimerValue.
+         */
+        uint64_t time;
+
+        union
+        {
+            /*! Payload of `GRWL_EVENT_KEY`.
+             */
+            struct
+            {
+                int key;
+                int scancode;
+                int action;
+                int mods;
+            } key;
+            /*! Payload of `GRWL_EVENT_CHAR`.
+             */
+            struct
+            {
+                unsigned int codepoint;
+                int mods;
+            } character;
+            /*! Payload of `GRWL_EVENT_MOUSE_BUTTON`.
+             */
+            struct
+            {
+                int button;
+                int action;
+                int mods;
+            } mouseButton;
+            /*! Payload of `GRWL_EVENT_CURSOR_POS`, in content area relative
+             *  screen coordinates.
+             */
+            struct
+            {
+                double x;
+                double y;
+            } cursorPos;
+            /*! Payload of `GRWL_EVENT_CURSOR_ENTER`.
+             */
+            struct
+            {
+                int entered;
+            } cursorEnter;
+            /*! Payload of `GRWL_EVENT_SCROLL`.
+             */
+            struct
+            {
+                double x;
+                double y;
+            } scroll;
+            /*! Payload of `GRWL_EVENT_WINDOW_POS`, in screen coordinates.
+             */
+            struct
+            {
+                int x;
+                int y;
+            } pos;
+            /*! Payload of `GRWL_EVENT_WINDOW_SIZE`, in screen coordinates, and of
+             *  `GRWL_EVENT_FRAMEBUFFER_SIZE`, in pixels.
+             */
+            struct
+            {
+                int width;
+                int height;
+            } size;
+            /*! Payload of `GRWL_EVENT_WINDOW_CONTENT_SCALE`.
+             */
+            struct
+            {
+                float x;
+                float y;
+            } scale;
+            /*! Payload of `GRWL_EVENT_WINDOW_FOCUS`, `GRWL_EVENT_WINDOW_ICONIFY`
+             *  and `GRWL_EVENT_WINDOW_MAXIMIZE`.  This is `true` if the window
+             *  gained focus, was iconified or was maximized, or `false` otherwise.
+             */
+            struct
+            {
+                int value;
+            } state;
+            /*! Payload of `GRWL_EVENT_MONITOR`.  The monitor is `NULL` for
+             *  disconnection events, as the monitor object no longer exists.
+             */
+            struct
+            {
+                GRWLmonitor* monitor;
+                int event;
+            } monitor;
+            /*! Payload of `GRWL_EVENT_JOYSTICK`.
+             */
+            struct
+            {
+                int jid;
+                int event;
+            } joystick;
+            /*! Payload of `GRWL_EVENT_JOYSTICK_AXIS`.
+             */
+            struct
+            {
+                int jid;
+                int axis;
+                float value;
+            } joystickAxis;
+            /*! Payload of `GRWL_EVENT_JOYSTICK_BUTTON`.
+             */
+            struct
+            {
+                int jid;
+                int button;
+                int action;
+            } joystickButton;
+            /*! Payload of `GRWL_EVENT_JOYSTICK_HAT`.
+             */
+            struct
+            {
+                int jid;
+                int hat;
+                int value;
+            } joystickHat;
+            /*! Payload of `GRWL_EVENT_USER`, as passed to @ref grwlPostUserEvent.
+             */
+            struct
+            {
+                int type;
+                void* payload;
+            } user;
+        };
+    } GRWLevent;
+
     /*************************************************************************
      * GRWL API functions
      *************************************************************************/
@@ -2593,6 +3036,138 @@ extern "C"
      */
     GRWLAPI int grwlPlatformSupported(int platform);
 
+    /*! @brief Retrieves the runtime statistics of the library.
+     *
+     *  This function retrieves the counters the library has accumulated since it
+     *  was initialized or since the last call to @ref grwlResetStatistics.  These
+     *  can be used to tell whether time is spent in the windowing layer or in user
+     *  callbacks.
+     *
+     *  Time spent in callbacks that are called from within other callbacks is only
+     *  counted once.
+     *
+     *  If an [error](@ref error_handling) occurs, all members of the structure are
+     *  set to zero.
+     *
+     *  @param[out] statistics Where to store the statistics.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref init_statistics
+     *  @sa @ref grwlResetStatistics
+     *
+     *  @ingroup init
+     */
+    GRWLAPI void grwlGetStatistics(GRWLstatistics* statistics);
+
+    /*! @brief Resets the runtime statistics of the library.
+     *
+     *  This function sets all counters reported by @ref grwlGetStatistics to zero.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref init_statistics
+     *  @sa @ref grwlGetStatistics
+     *
+     *  @ingroup init
+     */
+    GRWLAPI void grwlResetStatistics();
+
+    /*! @brief Writes the recorded trace zones to a Chrome trace file.
+     *
+     *  This function writes the trace zones recorded by all threads to the
+     *  specified file in the Chrome trace event JSON format, which can be opened
+     *  by Perfetto and `chrome://tracing`.  Each thread keeps a fixed number of
+     *  its most recent zones.
+     *
+     *  Zone timestamps are taken from the same monotonic clock as
+     *  `std::chrono::steady_clock` and the process and thread IDs are those of the
+     *  operating system, so the zones can be merged with other traces of the same
+     *  process.
+     *
+     *  Trace zones are only recorded if the library was compiled with the @ref
+     *  GRWL_BUILD_TRACING CMake option.
+     *
+     *  @param[in] path The UTF-8 encoded path of the file to write.
+     *  @param[in] seconds Only zones that ended within this many seconds are
+     *  written, or zero to write all recorded zones.
+     *  @return `true` if successful, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_INVALID_VALUE, @ref
+     *  GRWL_FEATURE_UNAVAILABLE and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @remark This function may be called before @ref grwlInit.
+     *
+     *  @thread_safety This function may be called from any thread.
+     *
+     *  @sa @ref init_tracing
+     *  @sa @ref grwlSetTraceStallCallback
+     *
+     *  @ingroup init
+     */
+    GRWLAPI int grwlWriteTrace(const char* path, double seconds);
+
+    /*! @brief Sets the duration above which a trace zone counts as a stall.
+     *
+     *  This function sets the duration above which a trace zone is reported to
+     *  the [trace stall callback](@ref grwlSetTraceStallCallback).  A threshold
+     *  of zero disables stall detection, which is the default.
+     *
+     *  @param[in] seconds The stall threshold, in seconds, or zero to disable.
+     *
+     *  @errors Possible errors include @ref GRWL_INVALID_VALUE.
+     *
+     *  @remark This function may be called before @ref grwlInit.
+     *
+     *  @thread_safety This function may be called from any thread.
+     *
+     *  @sa @ref init_tracing
+     *  @sa @ref grwlSetTraceStallCallback
+     *
+     *  @ingroup init
+     */
+    GRWLAPI void grwlSetTraceStallThreshold(double seconds);
+
+    /*! @brief Sets the trace stall callback.
+     *
+     *  This function sets the trace stall callback, which is called when a trace
+     *  zone exceeds the [stall threshold](@ref grwlSetTraceStallThreshold).  The
+     *  zone has already been recorded when the callback is called, so calling
+     *  @ref grwlWriteTrace from the callback captures the stall along with the
+     *  zones leading up to it.
+     *
+     *  @param[in] callback The new callback, or `nullptr` to remove the currently
+     *  set callback.
+     *  @return The previously set callback, or `nullptr` if no callback was set.
+     *
+     *  @callback_signature
+     *  @code
+     *  void function_name(const char* zone, double duration)
+     *  @endcode
+     *  For more information about the callback parameters, see the
+     *  [callback pointer type](@ref GRWLtracestallfun).
+     *
+     *  @errors None.
+     *
+     *  @remark This function may be called before @ref grwlInit.
+     *
+     *  @remark The callback is called on the thread that recorded the zone, which
+     *  may not be the main thread.
+     *
+     *  @thread_safety This function may be called from any thread.
+     *
+     *  @sa @ref init_tracing
+     *  @sa @ref grwlSetTraceStallThreshold
+     *
+     *  @ingroup init
+     */
+    GRWLAPI GRWLtracestallfun grwlSetTraceStallCallback(GRWLtracestallfun callback);
+
     /*! @brief Returns the currently connected monitors.
      *
      *  This function returns an array of handles for all currently connected
@@ -3273,11 +3848,42 @@ extern "C"
      *  @thread_safety This function must only be called from the main thread.
      *
      *  @sa @ref window_icon
+     *  @sa @ref grwlSetWindowIconFormatted
      *
      *  @ingroup window
      */
     GRWLAPI void grwlSetWindowIcon(GRWLwindow* window, int count, const GRWLimage* images);
 
+    /*! @brief Sets the icon for the specified window from images with a pixel
+     *  format.
+     *
+     *  This function behaves like @ref grwlSetWindowIcon, except that each image
+     *  specifies the [format](@ref image_formats) of its pixels and the stride of
+     *  its rows.  Images in the native format of the platform are copied without
+     *  conversion.
+     *
+     *  @param[in] window The window whose icon to set.
+     *  @param[in] count The number of images in the specified array, or zero to
+     *  revert to the default window icon.
+     *  @param[in] images The images to create the icon from.  This is ignored if
+     *  count is zero.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_ENUM, @ref GRWL_INVALID_VALUE, @ref GRWL_PLATFORM_ERROR and
+     *  @ref GRWL_FEATURE_UNAVAILABLE (see remarks of @ref grwlSetWindowIcon).
+     *
+     *  @pointer_lifetime The specified image data is copied before this function
+     *  returns.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref image_formats_guide
+     *  @sa @ref grwlSetWindowIcon
+     *
+     *  @ingroup window
+     */
+    GRWLAPI void grwlSetWindowIconFormatted(GRWLwindow* window, int count, const GRWLformattedimage* images);
+
     /*! @brief Sets the dock or taskbar progress indicator for the specified window.
      *
      *  This function sets the dock or taskbar progress indicator of the specified window.
@@ -4531,32 +5137,295 @@ extern "C"
      */
     GRWLAPI void grwlPostEmptyEvent();
 
-    /*! @brief Returns the value of an input option for the specified window.
+    /*! @brief Posts a user event to the main thread.
      *
-     *  This function returns the value of an input option for the specified window.
-     *  The mode must be one of @ref GRWL_CURSOR, @ref GRWL_STICKY_KEYS,
-     *  @ref GRWL_STICKY_MOUSE_BUTTONS, @ref GRWL_LOCK_KEY_MODS,
-     *  @ref GRWL_RAW_MOUSE_MOTION or @ref GRWL_IME.
+     *  This function posts an application defined event from the current thread
+     *  and wakes up @ref grwlWaitEvents or @ref grwlWaitEventsTimeout.  The event
+     *  is delivered to the [user event callback](@ref grwlSetUserEventCallback)
+     *  and the [event queue](@ref event_queue) by the next call to @ref
+     *  grwlPollEvents, @ref grwlWaitEvents or @ref grwlWaitEventsTimeout on the
+     *  main thread.
      *
-     *  @param[in] window The window to query.
-     *  @param[in] mode One of `GRWL_CURSOR`, `GRWL_STICKY_KEYS`,
-     *  `GRWL_STICKY_MOUSE_BUTTONS`, `GRWL_LOCK_KEY_MODS`, `GRWL_RAW_MOUSE_MOTION`,
-     *  or `GRWL_IME`.
+     *  Events and tasks are delivered in the order they were posted.  Posting does
+     *  not lock or allocate, and posting many events before the main thread
+     *  processes them wakes it only once.
+     *
+     *  @param[in] type An application defined event type.
+     *  @param[in] payload An application defined pointer.
+     *  @return `true` if the event was posted, or `false` if too many events and
+     *  tasks are already pending or an [error](@ref error_handling) occurred.
      *
      *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
-     *  GRWL_INVALID_ENUM.
+     *  GRWL_PLATFORM_ERROR.
      *
-     *  @thread_safety This function must only be called from the main thread.
+     *  @thread_safety This function may be called from any thread.
      *
-     *  @sa @ref grwlSetInputMode
+     *  @sa @ref events_user
+     *  @sa @ref grwlRunOnMainThread
      *
-     *  @ingroup input
+     *  @ingroup window
      */
-    GRWLAPI int grwlGetInputMode(GRWLwindow* window, int mode);
+    GRWLAPI int grwlPostUserEvent(int type, void* payload);
 
-    /*! @brief Sets an input option for the specified window.
+    /*! @brief Runs a function on the main thread.
      *
-     *  This function sets an input mode option for the specified window.  The mode
+     *  This function queues a function to be called on the main thread and wakes
+     *  up @ref grwlWaitEvents or @ref grwlWaitEventsTimeout.  The function is
+     *  called by the next call to @ref grwlPollEvents, @ref grwlWaitEvents or @ref
+     *  grwlWaitEventsTimeout on the main thread.
+     *
+     *  @param[in] function The function to call.
+     *  @param[in] user The pointer to pass to the function.
+     *  @return `true` if the task was queued, or `false` if too many events and
+     *  tasks are already pending or an [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @thread_safety This function may be called from any thread.
+     *
+     *  @sa @ref events_user
+     *  @sa @ref grwlPostUserEvent
+     *
+     *  @ingroup window
+     */
+    GRWLAPI int grwlRunOnMainThread(GRWLmainthreadfun function, void* user);
+
+    /*! @brief Sets the user event callback.
+     *
+     *  This function sets the user event callback, which is called on the main
+     *  thread for each event posted with @ref grwlPostUserEvent.
+     *
+     *  @param[in] callback The new callback, or `NULL` to remove the currently set
+     *  callback.
+     *  @return The previously set callback, or `NULL` if no callback was set or the
+     *  library had not been [initialized](@ref intro_init).
+     *
+     *  @callback_signature
+     *  @code
+     *  void function_name(int type, void* payload)
+     *  @endcode
+     *  For more information about the callback parameters, see the
+     *  [function pointer type](@ref GRWLusereventfun).
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref events_user
+     *
+     *  @ingroup window
+     */
+    GRWLAPI GRWLusereventfun grwlSetUserEventCallback(GRWLusereventfun callback);
+
+    /*! @brief Returns a file descriptor that becomes readable when events arrive.
+     *
+     *  This function returns a file descriptor that becomes readable whenever
+     *  there are events for GRWL to process.  This includes window system
+     *  events, empty events posted with @ref grwlPostEmptyEvent, user events,
+     *  key repeat and cursor animation timers and joystick input.  It lets an
+     *  application wait for GRWL events in its own event loop, like one based
+     *  on `epoll`, `libuv` or `asio`, instead of calling @ref grwlWaitEvents.
+     *
+     *  When the file descriptor is readable, call @ref grwlPollEvents to process
+     *  the events.  The file descriptor is level-triggered and remains readable
+     *  until the events have been processed.  Call @ref grwlPollEvents once
+     *  before waiting on the file descriptor, as some window systems may already
+     *  have read events that are waiting to be processed.
+     *
+     *  Do not read from or close the file descriptor.  It remains valid until
+     *  the library is terminated.
+     *
+     *  @return The file descriptor, or `-1` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_FEATURE_UNAVAILABLE.
+     *
+     *  @remark This function is only available on Linux with the X11, Wayland
+     *  and Null platforms.  On other platforms it emits @ref
+     *  GRWL_FEATURE_UNAVAILABLE.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref events_fd
+     *  @sa @ref grwlPollEvents
+     *
+     *  @ingroup window
+     */
+    GRWLAPI int grwlGetEventFd();
+
+    /*! @brief Adds a file descriptor to the set waited on by event processing.
+     *
+     *  This function makes @ref grwlPollEvents, @ref grwlWaitEvents and @ref
+     *  grwlWaitEventsTimeout also wait on the specified file descriptor, like
+     *  a socket, pipe or timer, and call the specified callback when any of the
+     *  specified events occur on it.  The wait functions return after calling
+     *  the callback.
+     *
+     *  The file descriptor is level-triggered, so the callback is called by
+     *  every event processing call for as long as the events are pending.
+     *  Read or write the file descriptor in the callback, or remove the watch.
+     *
+     *  Each file descriptor may only be watched once.  Remove the watch with
+     *  @ref grwlRemoveWatchFd before closing the file descriptor.  All watches
+     *  are removed when the library is terminated.
+     *
+     *  @param[in] fd The file descriptor to watch.
+     *  @param[in] events The [events](@ref watch_events) to watch for.  @ref
+     *  GRWL_WATCH_ERROR is always watched for.
+     *  @param[in] callback The function to call when the events occur.
+     *  @param[in] user A pointer passed to the callback.
+     *  @return `true` if successful, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE, @ref GRWL_FEATURE_UNAVAILABLE and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @remark This function is only available with the X11, Wayland and Null
+     *  platforms.  On other platforms it emits @ref GRWL_FEATURE_UNAVAILABLE.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref events_watch
+     *  @sa @ref grwlRemoveWatchFd
+     *
+     *  @ingroup window
+     */
+    GRWLAPI int grwlAddWatchFd(int fd, int events, GRWLwatchfun callback, void* user);
+
+    /*! @brief Removes a file descriptor from the set waited on by event processing.
+     *
+     *  This function removes a file descriptor watch added with @ref
+     *  grwlAddWatchFd.  It may be called from the watch callback.
+     *
+     *  @param[in] fd The file descriptor to stop watching.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_INVALID_VALUE.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref events_watch
+     *  @sa @ref grwlAddWatchFd
+     *
+     *  @ingroup window
+     */
+    GRWLAPI void grwlRemoveWatchFd(int fd);
+
+    /*! @brief Starts recording input events to a file.
+     *
+     *  This function starts serializing every window, keyboard, mouse, IME and
+     *  joystick event that GRWL processes into a compact binary log at the
+     *  specified path, along with the time of each event.  The log is
+     *  memory-mapped and only ever appended to, so recording adds little
+     *  overhead to event processing.  Any existing file at the path is
+     *  replaced.
+     *
+     *  The log can later be fed back through the same event processing with
+     *  @ref grwlReplayInput.
+     *
+     *  @param[in] path The UTF-8 encoded path of the log file to create.
+     *  @return `true` if recording was started, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @remark Monitor connection events and preedit candidate lists are not
+     *  recorded.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref grwlStopInputRecording
+     *  @sa @ref grwlReplayInput
+     *
+     *  @ingroup input
+     */
+    GRWLAPI int grwlStartInputRecording(const char* path);
+
+    /*! @brief Stops recording input events.
+     *
+     *  This function stops any recording started with @ref
+     *  grwlStartInputRecording and trims the log file to the recorded events.
+     *  If no recording is active, this function does nothing.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @remark Recording is also stopped by @ref grwlTerminate.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref grwlStartInputRecording
+     *
+     *  @ingroup input
+     */
+    GRWLAPI void grwlStopInputRecording();
+
+    /*! @brief Replays a recorded input log.
+     *
+     *  This function feeds the events of a log created with @ref
+     *  grwlStartInputRecording back through the same event processing used for
+     *  platform events, calling any callbacks that are set.  It returns once
+     *  every event in the log has been replayed.
+     *
+     *  Recorded windows are matched to existing windows in order of creation,
+     *  so the first window seen in the log is replayed into the oldest window.
+     *  Events for recorded windows without a match are skipped, as are joystick
+     *  events for joysticks that are not present.
+     *
+     *  @param[in] path The UTF-8 encoded path of the log file to replay.
+     *  @param[in] speed The playback speed relative to the recorded timing,
+     *  where `1.0` replays at recorded speed and zero replays as fast as
+     *  possible.
+     *  @return The number of events replayed, or -1 if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @remark When replaying at recorded speed, this function waits between
+     *  events with @ref grwlWaitEventsTimeout, so platform events are processed
+     *  during the replay.
+     *
+     *  @reentrancy This function must not be called from a callback.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref grwlStartInputRecording
+     *
+     *  @ingroup input
+     */
+    GRWLAPI int grwlReplayInput(const char* path, double speed);
+
+    /*! @brief Returns the value of an input option for the specified window.
+     *
+     *  This function returns the value of an input option for the specified window.
+     *  The mode must be one of @ref GRWL_CURSOR, @ref GRWL_STICKY_KEYS,
+     *  @ref GRWL_STICKY_MOUSE_BUTTONS, @ref GRWL_LOCK_KEY_MODS,
+     *  @ref GRWL_RAW_MOUSE_MOTION or @ref GRWL_IME.
+     *
+     *  @param[in] window The window to query.
+     *  @param[in] mode One of `GRWL_CURSOR`, `GRWL_STICKY_KEYS`,
+     *  `GRWL_STICKY_MOUSE_BUTTONS`, `GRWL_LOCK_KEY_MODS`, `GRWL_RAW_MOUSE_MOTION`,
+     *  or `GRWL_IME`.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_INVALID_ENUM.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref grwlSetInputMode
+     *
+     *  @ingroup input
+     */
+    GRWLAPI int grwlGetInputMode(GRWLwindow* window, int mode);
+
+    /*! @brief Sets an input option for the specified window.
+     *
+     *  This function sets an input mode option for the specified window.  The mode
      *  must be one of @ref GRWL_CURSOR, @ref GRWL_STICKY_KEYS,
      *  @ref GRWL_STICKY_MOUSE_BUTTONS, @ref GRWL_LOCK_KEY_MODS,
      *  @ref GRWL_RAW_MOUSE_MOTION or @ref GRWL_IME.
@@ -4967,11 +5836,40 @@ extern "C"
      *  @sa @ref cursor_object
      *  @sa @ref grwlDestroyCursor
      *  @sa @ref grwlCreateStandardCursor
+     *  @sa @ref grwlCreateCursorFormatted
      *
      *  @ingroup input
      */
     GRWLAPI GRWLcursor* grwlCreateCursor(const GRWLimage* image, int xhot, int yhot);
 
+    /*! @brief Creates a custom cursor from an image with a pixel format.
+     *
+     *  This function behaves like @ref grwlCreateCursor, except that the image
+     *  specifies the [format](@ref image_formats) of its pixels and the stride of
+     *  its rows.  Images in the native format of the platform are copied without
+     *  conversion.
+     *
+     *  @param[in] image The desired cursor image.
+     *  @param[in] xhot The desired x-coordinate, in pixels, of the cursor hotspot.
+     *  @param[in] yhot The desired y-coordinate, in pixels, of the cursor hotspot.
+     *  @return The handle of the created cursor, or `nullptr` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_ENUM, @ref GRWL_INVALID_VALUE and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @pointer_lifetime The specified image data is copied before this function
+     *  returns.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref image_formats_guide
+     *  @sa @ref grwlCreateCursor
+     *
+     *  @ingroup input
+     */
+    GRWLAPI GRWLcursor* grwlCreateCursorFormatted(const GRWLformattedimage* image, int xhot, int yhot);
+
     /*! @brief Creates a cursor with a standard shape.
      *
      *  Returns a cursor with a standard shape, that can be set for a window with
@@ -6142,11 +7040,111 @@ extern "C"
      *
      *  @sa @ref clipboard
      *  @sa @ref grwlSetClipboardString
+     *  @sa @ref grwlRequestClipboardString
      *
      *  @ingroup input
      */
     GRWLAPI const char* grwlGetClipboardString(GRWLwindow* window);
 
+    /*! @brief Requests the contents of the clipboard as a string.
+     *
+     *  This function requests the contents of the system clipboard without
+     *  waiting for them.  The specified callback is called with the contents
+     *  during event processing, once they have been received and converted to
+     *  a UTF-8 encoded string.  If the clipboard is empty or if its contents
+     *  cannot be converted, the callback is called with `nullptr` and a @ref
+     *  GRWL_FORMAT_UNAVAILABLE error is generated.
+     *
+     *  Requests made while another is pending share its transfer and their
+     *  callbacks are called in the order the requests were made.
+     *
+     *  @param[in] callback The function to call with the clipboard string.
+     *  @param[in] user A pointer passed to the callback.
+     *  @return `true` if the request was made, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_OUT_OF_MEMORY and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @remark @x11 @wayland The clipboard contents are read as they arrive, so
+     *  the event loop keeps running during large transfers.  If @ref
+     *  grwlGetClipboardString is called while a request is pending, it finishes
+     *  the transfer and the callbacks are called before it returns.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref clipboard
+     *  @sa @ref grwlGetClipboardString
+     *
+     *  @ingroup input
+     */
+    GRWLAPI int grwlRequestClipboardString(GRWLclipboardfun callback, void* user);
+
+    /*! @brief Sets the clipboard to the specified data.
+     *
+     *  This function sets the system clipboard to the specified binary data,
+     *  offered as the specified MIME type.  This replaces any string or other
+     *  data on the clipboard.
+     *
+     *  @param[in] mime_type The MIME type of the data, for example `image/png`.
+     *  @param[in] data The data to place on the clipboard.
+     *  @param[in] size The size, in bytes, of the data.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE and @ref GRWL_PLATFORM_ERROR.
+     *
+     *  @pointer_lifetime The specified MIME type and data are copied before this
+     *  function returns.
+     *
+     *  @remark @win32 The MIME type is used as the name of a registered
+     *  clipboard format.
+     *
+     *  @remark @macos The MIME type is used as the pasteboard type.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref clipboard_data
+     *  @sa @ref grwlGetClipboardData
+     *
+     *  @ingroup input
+     */
+    GRWLAPI void grwlSetClipboardData(const char* mime_type, const void* data, size_t size);
+
+    /*! @brief Returns the contents of the clipboard as the specified MIME type.
+     *
+     *  This function returns the contents of the system clipboard as the
+     *  specified MIME type, if it is available in that type.  If it is not,
+     *  `nullptr` is returned and a @ref GRWL_FORMAT_UNAVAILABLE error is
+     *  generated.
+     *
+     *  @param[in] mime_type The MIME type of the data, for example `image/png`.
+     *  @param[out] size Where to store the size, in bytes, of the data.
+     *  @return The contents of the clipboard, or `nullptr` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE, @ref GRWL_FORMAT_UNAVAILABLE and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @pointer_lifetime The returned data is allocated and freed by GRWL.  You
+     *  should not free it yourself and must not write to it.  It is valid until
+     *  the next call to @ref grwlGetClipboardData or @ref grwlSetClipboardData,
+     *  or until the library is terminated.
+     *
+     *  @remark @wayland The data is received into a memory file without passing
+     *  through a user space buffer and returned as a read-only mapping of it.
+     *
+     *  @remark @x11 Large data is received incrementally with the INCR protocol.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref clipboard_data
+     *  @sa @ref grwlSetClipboardData
+     *
+     *  @ingroup input
+     */
+    GRWLAPI const void* grwlGetClipboardData(const char* mime_type, size_t* size);
+
     /*! @brief Returns the GRWL time.
      *
      *  This function returns the current GRWL time, in seconds.  Unless the time
@@ -6223,6 +7221,72 @@ extern "C"
      */
     GRWLAPI uint64_t grwlGetTimerValue();
 
+    /*! @brief Returns the time at which the current event was generated.
+     *
+     *  This function returns the time at which the event currently being
+     *  delivered to a callback was generated, as a value of the raw timer
+     *  comparable with @ref grwlGetTimerValue.  This is the timestamp provided by
+     *  the window system or kernel, which may be noticeably earlier than the time
+     *  the callback is called.
+     *
+     *  If the platform did not provide a timestamp for the event, or if no event
+     *  is being processed, this function returns the current value of the raw
+     *  timer.
+     *
+     *  @return The time the event was generated, in 1&nbsp;/&nbsp;frequency
+     *  seconds, or zero if an [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED.
+     *
+     *  @remark @x11 @wayland Timestamps are only used if they are from the same
+     *  monotonic clock as the raw timer.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref event_time
+     *  @sa @ref grwlGetTimerValue
+     *
+     *  @ingroup input
+     */
+    GRWLAPI uint64_t grwlGetEventTime();
+
+    /*! @brief Retrieves queued events.
+     *
+     *  This function moves up to the specified number of events from the event
+     *  queue into the provided array, oldest first, and returns how many were
+     *  moved.  Events remaining in the queue are returned by later calls.
+     *
+     *  Events are only queued if the library was initialized with a non-zero
+     *  [GRWL_EVENT_QUEUE_CAPACITY](@ref GRWL_EVENT_QUEUE_CAPACITY_hint) init hint.
+     *  Events are queued as they are processed by @ref grwlPollEvents and the
+     *  other event processing functions, in addition to being delivered to any
+     *  callbacks that are set.
+     *
+     *  If the queue is full when a new event arrives, the oldest queued event is
+     *  discarded.  Queued events of a window are discarded when it is destroyed.
+     *
+     *  @param[out] events The array to move the events into.
+     *  @param[in] capacity The maximum number of events to move.
+     *  @return The number of events moved, or zero if the queue is empty or an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_INVALID_VALUE.
+     *
+     *  @remark File drop, preedit, IME status and gamepad state events are
+     *  only delivered to callbacks.
+     *
+     *  @pointer_lifetime The window handles in the returned events are valid
+     *  until the window is destroyed.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref event_queue
+     *
+     *  @ingroup input
+     */
+    GRWLAPI int grwlGetEvents(GRWLevent* events, int capacity);
+
     /*! @brief Returns the frequency, in Hz, of the raw timer.
      *
      *  This function returns the frequency, in Hz, of the raw timer.
@@ -6453,6 +7517,44 @@ extern "C"
      */
     GRWLAPI GRWLglproc grwlGetProcAddress(const char* procname);
 
+    /*! @brief Returns the addresses of the specified functions for the current
+     *  context.
+     *
+     *  This function retrieves the addresses of the specified OpenGL or OpenGL ES
+     *  [core or extension functions](@ref context_glext) in a single call, as if
+     *  by calling @ref grwlGetProcAddress for each name.  Addresses are looked up
+     *  once per context and remembered, so loading the same functions again is
+     *  cheap.
+     *
+     *  A context must be current on the calling thread.  Calling this function
+     *  without a current context will cause a @ref GRWL_NO_CURRENT_CONTEXT error.
+     *
+     *  @param[in] names The ASCII encoded names of the functions.
+     *  @param[out] procs Where to store the address of each function, or
+     *  `nullptr` for functions that were not found.
+     *  @param[in] count The number of elements in `names` and `procs`.
+     *  @return The number of functions that were found, or zero if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_NO_CURRENT_CONTEXT, @ref GRWL_INVALID_VALUE and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @remark The same caveats as for @ref grwlGetProcAddress apply to each
+     *  returned address.
+     *
+     *  @pointer_lifetime The returned function pointers are valid until the
+     *  context is destroyed or the library is terminated.
+     *
+     *  @thread_safety This function may be called from any thread.
+     *
+     *  @sa @ref context_glext
+     *  @sa @ref grwlGetProcAddress
+     *
+     *  @ingroup context
+     */
+    GRWLAPI int grwlLoadProcs(const char** names, GRWLglproc* procs, int count);
+
     /*! @brief Create a new OpenGL or OpenGL ES user context for a window
      *
      *  This function creates a new OpenGL or OpenGL ES user context for a
@@ -6585,6 +7687,120 @@ extern "C"
      */
     GRWLAPI GRWLusercontext* grwlGetCurrentUserContext();
 
+    /*! @brief Starts worker threads with contexts shared with the window.
+     *
+     *  This function starts the specified number of worker threads for the
+     *  window.  Each worker has its own [user context](@ref context_user) that
+     *  shares objects with the window context, and runs the jobs submitted with
+     *  @ref grwlSubmitContextJob with that context current.
+     *
+     *  If the window already has workers, they are stopped first as if by
+     *  calling this function with a count of zero.  Stopping the workers
+     *  discards the jobs that have not started and waits for the running ones.
+     *  The completion callbacks of finished jobs are called before this
+     *  function returns.  The workers are also stopped when the window is
+     *  destroyed.
+     *
+     *  @param[in] window The window whose context the workers share objects
+     *  with.
+     *  @param[in] count The number of worker threads, or zero to stop the
+     *  workers.
+     *  @return `true` if the workers were started or stopped, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_VALUE, @ref GRWL_NO_WINDOW_CONTEXT and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref context_workers
+     *  @sa @ref grwlSubmitContextJob
+     *
+     *  @ingroup context
+     */
+    GRWLAPI int grwlStartContextWorkers(GRWLwindow* window, int count);
+
+    /*! @brief Runs a job on a context worker thread of the window.
+     *
+     *  This function queues a job to be run by one of the workers started with
+     *  @ref grwlStartContextWorkers.  Jobs are started in the order they were
+     *  submitted.
+     *
+     *  After the job function returns, the worker creates a fence sync object
+     *  and flushes its context.  The completion callback is then called with the
+     *  fence from the event processing functions on the main thread.  Waiting
+     *  on the fence with `glWaitSync` makes the objects written by the job
+     *  safe to use in the window context.  The application owns the fence and
+     *  must delete it with `glDeleteSync`.
+     *
+     *  If the context does not support sync objects, the worker calls `glFinish`
+     *  instead and the callback is passed `nullptr`.  If no completion callback
+     *  is specified, the worker only flushes its context.
+     *
+     *  @param[in] window The window whose workers run the job.
+     *  @param[in] function The job function, called on a worker thread.
+     *  @param[in] done The completion callback, called on the main thread, or
+     *  `nullptr`.
+     *  @param[in] user The pointer passed to the job function and completion
+     *  callback.
+     *  @return `true` if the job was queued, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED and @ref
+     *  GRWL_INVALID_VALUE.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref context_workers
+     *  @sa @ref grwlStartContextWorkers
+     *
+     *  @ingroup context
+     */
+    GRWLAPI int grwlSubmitContextJob(GRWLwindow* window, GRWLcontextjobfun function, GRWLcontextjobdonefun done,
+                                     void* user);
+
+    /*! @brief Pre-creates contexts for windows created with the current hints.
+     *
+     *  This function starts creating the specified number of OpenGL or OpenGL ES
+     *  contexts on a background thread, using the current
+     *  [context](@ref window_hints_ctx) and [framebuffer](@ref window_hints_fb)
+     *  hints.  A window later created with matching hints and no share window
+     *  is given one of these contexts instead of creating its own, and the pool
+     *  is refilled in the background.
+     *
+     *  The pooled contexts all share objects with a root context owned by the
+     *  pool, and therefore with each other.
+     *
+     *  Calling this function again with the same hints changes the number of
+     *  contexts kept ready.  Calling it with different hints replaces the pool.
+     *  A count of zero destroys the pool and every context it holds.
+     *
+     *  Errors while creating the pooled contexts are reported on the pool
+     *  thread, after which the pool stops creating contexts.
+     *
+     *  @param[in] count The number of contexts to keep ready, or zero to
+     *  disable the pool.
+     *  @return `true` if the pool was set up, or `false` if an
+     *  [error](@ref error_handling) occurred.
+     *
+     *  @errors Possible errors include @ref GRWL_NOT_INITIALIZED, @ref
+     *  GRWL_INVALID_ENUM, @ref GRWL_INVALID_VALUE, @ref GRWL_API_UNAVAILABLE,
+     *  @ref GRWL_VERSION_UNAVAILABLE, @ref GRWL_FORMAT_UNAVAILABLE and @ref
+     *  GRWL_PLATFORM_ERROR.
+     *
+     *  @remark Context pools are supported for GLX and EGL contexts.  Other
+     *  context creation APIs emit @ref GRWL_API_UNAVAILABLE.
+     *
+     *  @thread_safety This function must only be called from the main thread.
+     *
+     *  @sa @ref context_pool
+     *  @sa @ref grwlCreateWindow
+     *
+     *  @ingroup context
+     */
+    GRWLAPI int grwlPrewarmContexts(int count);
+
     /*! @brief Returns whether the Vulkan loader and an ICD have been found.
      *
      *  This function returns whether the Vulkan loader and any minimally functional
@@ -6718,6 +7934,10 @@ extern "C"
      *  `VK_MVK_macos_surface` and `VK_EXT_metal_surface` extensions do not provide
      *  a `vkGetPhysicalDevice*PresentationSupport` type function.
      *
+     *  @remark __Null:__ This function returns `true` whenever the
+     *  `VK_EXT_headless_surface` extension is available, as it does not provide
+     *  a `vkGetPhysicalDevice*PresentationSupport` type function either.
+     *
      *  @thread_safety This function may be called from any thread.  For
      *  synchronization details of Vulkan objects, see the Vulkan specification.
      *
@@ -6786,6 +8006,10 @@ extern "C"
      *  hint.  The name of the selected extension, if any, is included in the array
      *  returned by @ref grwlGetRequiredInstanceExtensions.
      *
+     *  @remark __Null:__ GRWL creates surfaces with the `VK_EXT_headless_surface`
+     *  extension.  Their swapchain images are never displayed, but otherwise
+     *  behave like those of any other surface.
+     *
      *  @thread_safety This function may be called from any thread.  For
      *  synchronization details of Vulkan objects, see the Vulkan specification.
      *
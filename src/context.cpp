@@ -294,6 +294,392 @@ const _GRWLfbconfig* _grwlChooseFBConfig(const _GRWLfbconfig* desired, const _GR
     return closest;
 }
 
+// Returns whether the specified framebuffer configs have the same attributes
+//
+static bool isSameFBConfig(const _GRWLfbconfig* a, const _GRWLfbconfig* b)
+{
+    return a->redBits == b->redBits && a->greenBits == b->greenBits && a->blueBits == b->blueBits &&
+           a->alphaBits == b->alphaBits && a->depthBits == b->depthBits && a->stencilBits == b->stencilBits &&
+           a->accumRedBits == b->accumRedBits && a->accumGreenBits == b->accumGreenBits &&
+           a->accumBlueBits == b->accumBlueBits && a->accumAlphaBits == b->accumAlphaBits &&
+           a->auxBuffers == b->auxBuffers && a->stereo == b->stereo && a->samples == b->samples &&
+           a->sRGB == b->sRGB && a->doublebuffer == b->doublebuffer && a->transparent == b->transparent;
+}
+
+// Looks up the native config previously chosen for the specified hints
+//
+bool _grwlFindFBConfigChoice(const _GRWLfbconfigcache* cache, const _GRWLfbconfig* desired, int key,
+                             uintptr_t* handle)
+{
+    for (int i = 0; i < cache->choiceCount; i++)
+    {
+        const _GRWLfbchoice* choice = cache->choices + i;
+
+        if (choice->key == key && isSameFBConfig(&choice->desired, desired))
+        {
+            *handle = choice->handle;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Remembers the native config chosen for the specified hints
+//
+void _grwlAddFBConfigChoice(_GRWLfbconfigcache* cache, const _GRWLfbconfig* desired, int key, uintptr_t handle)
+{
+    _GRWLfbchoice* choices = (_GRWLfbchoice*)_grwlReserveBuffer(cache->choices, &cache->choiceArraySize,
+                                                                (cache->choiceCount + 1) * sizeof(_GRWLfbchoice));
+    if (!choices)
+    {
+        // The choice is only remembered to save time
+        return;
+    }
+
+    cache->choices = choices;
+    choices[cache->choiceCount].desired = *desired;
+    choices[cache->choiceCount].key = key;
+    choices[cache->choiceCount].handle = handle;
+    cache->choiceCount++;
+}
+
+// Frees the translated configs and remembered choices of the specified cache
+//
+void _grwlFreeFBConfigCache(_GRWLfbconfigcache* cache)
+{
+    _grwl_free(cache->configs);
+    _grwl_free(cache->flags);
+    _grwl_free(cache->choices);
+    memset(cache, 0, sizeof(_GRWLfbconfigcache));
+}
+
+// Returns whether the specified context configs have the same attributes,
+// ignoring the share window
+//
+static bool isSameContextConfig(const _GRWLctxconfig* a, const _GRWLctxconfig* b)
+{
+    return a->client == b->client && a->source == b->source && a->major == b->major && a->minor == b->minor &&
+           a->forward == b->forward && a->debug == b->debug && a->noerror == b->noerror &&
+           a->profile == b->profile && a->robustness == b->robustness && a->release == b->release &&
+           a->nsgl.offline == b->nsgl.offline;
+}
+
+// Creates contexts for the pool until it is full or asked to stop
+// This runs on the pool thread, which is the only user of the root context
+// while it runs
+//
+static void contextPoolMain(void* user)
+{
+    _GRWLcontextpool* pool = (_GRWLcontextpool*)user;
+
+    if (!pool->root)
+    {
+        if (!pool->create(pool->config, &pool->ctxconfig, 0, &pool->root))
+        {
+            _grwlPlatformLockMutex(&pool->mutex);
+            pool->target = 0;
+            pool->running = false;
+            _grwlPlatformUnlockMutex(&pool->mutex);
+            return;
+        }
+    }
+
+    for (;;)
+    {
+        _grwlPlatformLockMutex(&pool->mutex);
+
+        if (pool->stopping || pool->count >= pool->target)
+        {
+            pool->running = false;
+            _grwlPlatformUnlockMutex(&pool->mutex);
+            return;
+        }
+
+        _grwlPlatformUnlockMutex(&pool->mutex);
+
+        uintptr_t context;
+
+        if (!pool->create(pool->config, &pool->ctxconfig, pool->root, &context))
+        {
+            // Do not keep retrying hints the driver has rejected
+            _grwlPlatformLockMutex(&pool->mutex);
+            pool->target = 0;
+            pool->running = false;
+            _grwlPlatformUnlockMutex(&pool->mutex);
+            return;
+        }
+
+        // The array was sized for the target on the main thread, so that this
+        // thread never calls the allocator
+        _grwlPlatformLockMutex(&pool->mutex);
+        pool->contexts[pool->count++] = context;
+        _grwlPlatformUnlockMutex(&pool->mutex);
+    }
+}
+
+// Starts the pool thread if the pool is below its target and it is not running
+//
+static void fillContextPool(_GRWLcontextpool* pool)
+{
+    _grwlPlatformLockMutex(&pool->mutex);
+    const bool start = !pool->running && pool->count < pool->target;
+    const bool join = !pool->running;
+    if (start)
+    {
+        pool->running = true;
+    }
+    _grwlPlatformUnlockMutex(&pool->mutex);
+
+    if (join)
+    {
+        // Reap the previous run, if any, before the thread object is reused
+        _grwlPlatformJoinThread(&pool->thread);
+    }
+
+    if (start)
+    {
+        if (!_grwlPlatformCreateThread(&pool->thread, contextPoolMain, pool))
+        {
+            _grwlPlatformLockMutex(&pool->mutex);
+            pool->running = false;
+            _grwlPlatformUnlockMutex(&pool->mutex);
+        }
+    }
+}
+
+// Hashes the specified number of characters of a name with 64-bit FNV-1a
+//
+static uint64_t hashName(const char* name, size_t length)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+// Returns the slot holding the specified name, or the empty slot where it
+// would be inserted
+//
+static _GRWLnameentry* findNameSlot(const _GRWLnametable* table, const char* name, size_t length, uint64_t hash)
+{
+    size_t index = (size_t)hash & (table->size - 1);
+
+    for (;;)
+    {
+        _GRWLnameentry* entry = table->entries + index;
+        if (!entry->name)
+        {
+            return entry;
+        }
+
+        if (entry->hash == hash)
+        {
+            const char* other = table->strings + entry->name - 1;
+            if (strncmp(other, name, length) == 0 && other[length] == '\0')
+            {
+                return entry;
+            }
+        }
+
+        index = (index + 1) & (table->size - 1);
+    }
+}
+
+// Grows the table so that it can hold the specified number of names while at
+// most half full
+//
+static bool reserveNameTable(_GRWLnametable* table, size_t count)
+{
+    if (count * 2 <= table->size)
+    {
+        return true;
+    }
+
+    size_t size = table->size ? table->size : 64;
+    while (size < count * 2)
+    {
+        size *= 2;
+    }
+
+    _GRWLnameentry* entries = (_GRWLnameentry*)_grwl_calloc(size, sizeof(_GRWLnameentry));
+    if (!entries)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < table->size; i++)
+    {
+        const _GRWLnameentry* entry = table->entries + i;
+        if (entry->name)
+        {
+            size_t index = (size_t)entry->hash & (size - 1);
+            while (entries[index].name)
+            {
+                index = (index + 1) & (size - 1);
+            }
+
+            entries[index] = *entry;
+        }
+    }
+
+    _grwl_free(table->entries);
+    table->entries = entries;
+    table->size = size;
+    return true;
+}
+
+// Sets the value of the specified name, adding the name if necessary
+//
+static bool insertName(_GRWLnametable* table, const char* name, size_t length, uintptr_t value)
+{
+    if (!reserveNameTable(table, table->count + 1))
+    {
+        return false;
+    }
+
+    const uint64_t hash = hashName(name, length);
+    _GRWLnameentry* entry = findNameSlot(table, name, length, hash);
+
+    if (!entry->name)
+    {
+        char* strings = (char*)_grwlReserveBuffer(table->strings, &table->stringsArraySize,
+                                                  table->stringsLength + length + 1);
+        if (!strings)
+        {
+            return false;
+        }
+
+        table->strings = strings;
+        memcpy(strings + table->stringsLength, name, length);
+        strings[table->stringsLength + length] = '\0';
+
+        entry->hash = hash;
+        entry->name = table->stringsLength + 1;
+        table->stringsLength += length + 1;
+        table->count++;
+    }
+
+    entry->value = value;
+    return true;
+}
+
+// Retrieves the value of the specified name, if the name is in the table
+//
+static bool findName(const _GRWLnametable* table, const char* name, uintptr_t* value)
+{
+    if (!table->count)
+    {
+        return false;
+    }
+
+    const size_t length = strlen(name);
+    const _GRWLnameentry* entry = findNameSlot(table, name, length, hashName(name, length));
+    if (!entry->name)
+    {
+        return false;
+    }
+
+    *value = entry->value;
+    return true;
+}
+
+static void freeNameTable(_GRWLnametable* table)
+{
+    _grwl_free(table->entries);
+    _grwl_free(table->strings);
+    memset(table, 0, sizeof(_GRWLnametable));
+}
+
+// Adds the client API extensions of the current context to its extension table
+//
+static bool loadExtensionTable(_GRWLwindow* window)
+{
+    _GRWLnametable* table = &window->context.extensions;
+
+    if (window->context.major >= 3)
+    {
+        GLint count;
+
+        // Extensions are in the modern OpenGL extensions string list
+
+        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        if (count > 0 && !reserveNameTable(table, (size_t)count))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            const char* en = (const char*)window->context.GetStringi(GL_EXTENSIONS, i);
+            if (!en)
+            {
+                _grwlInputError(GRWL_PLATFORM_ERROR, "Extension string retrieval is broken");
+                return false;
+            }
+
+            if (!insertName(table, en, strlen(en), true))
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        // Extensions are in the old style OpenGL extensions string
+
+        const char* extensions = (const char*)window->context.GetString(GL_EXTENSIONS);
+        if (!extensions)
+        {
+            _grwlInputError(GRWL_PLATFORM_ERROR, "Extension string retrieval is broken");
+            return false;
+        }
+
+        for (;;)
+        {
+            extensions += strspn(extensions, " ");
+            if (*extensions == '\0')
+            {
+                break;
+            }
+
+            const size_t length = strcspn(extensions, " ");
+            if (!insertName(table, extensions, length, true))
+            {
+                return false;
+            }
+
+            extensions += length;
+        }
+    }
+
+    return true;
+}
+
+// Returns the specified entry point of the context, looking it up only once
+//
+static GRWLglproc loadProc(_GRWLwindow* window, const char* procname)
+{
+    uintptr_t cached;
+
+    if (findName(&window->context.procs, procname, &cached))
+    {
+        return (GRWLglproc)cached;
+    }
+
+    const GRWLglproc proc = window->context.getProcAddress(procname);
+
+    // Failing to remember the entry point only costs time
+    insertName(&window->context.procs, procname, strlen(procname), (uintptr_t)proc);
+    return proc;
+}
+
 // Retrieves the attributes of the current context
 //
 bool _grwlRefreshContextAttribs(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig)
@@ -400,6 +786,14 @@ bool _grwlRefreshContextAttribs(_GRWLwindow* window, const _GRWLctxconfig* ctxco
         }
     }
 
+    // The extensions are hashed once, as they do not change during the lifetime
+    // of the context
+    if (!loadExtensionTable(window))
+    {
+        grwlMakeContextCurrent((GRWLwindow*)previous);
+        return false;
+    }
+
     if (window->context.client == GRWL_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -527,6 +921,72 @@ bool _grwlRefreshContextAttribs(_GRWLwindow* window, const _GRWLctxconfig* ctxco
     return true;
 }
 
+// Frees the extension and entry point tables of the specified context
+//
+void _grwlFreeContextTables(_GRWLcontext* context)
+{
+    freeNameTable(&context->extensions);
+    freeNameTable(&context->procs);
+}
+
+// Removes a pooled context matching the specified hints and native config, if
+// one is ready, and starts refilling the pool
+//
+bool _grwlTakePooledContext(const _GRWLctxconfig* ctxconfig, uintptr_t config, uintptr_t* context)
+{
+    _GRWLcontextpool* pool = &_grwl.contextPool;
+
+    // Pooled contexts share objects with each other, not with a share window
+    if (!pool->create || ctxconfig->share || pool->config != config ||
+        !isSameContextConfig(&pool->ctxconfig, ctxconfig))
+    {
+        return false;
+    }
+
+    _grwlPlatformLockMutex(&pool->mutex);
+    const bool found = pool->count > 0;
+    if (found)
+    {
+        *context = pool->contexts[--pool->count];
+    }
+    _grwlPlatformUnlockMutex(&pool->mutex);
+
+    fillContextPool(pool);
+    return found;
+}
+
+// Stops the pool thread and destroys every context that was not taken
+//
+void _grwlTerminateContextPool()
+{
+    _GRWLcontextpool* pool = &_grwl.contextPool;
+
+    if (!pool->create)
+    {
+        return;
+    }
+
+    _grwlPlatformLockMutex(&pool->mutex);
+    pool->stopping = true;
+    _grwlPlatformUnlockMutex(&pool->mutex);
+
+    _grwlPlatformJoinThread(&pool->thread);
+
+    for (int i = 0; i < pool->count; i++)
+    {
+        pool->destroy(pool->contexts[i]);
+    }
+
+    if (pool->root)
+    {
+        pool->destroy(pool->root);
+    }
+
+    _grwl_free(pool->contexts);
+    _grwlPlatformDestroyMutex(&pool->mutex);
+    memset(pool, 0, sizeof(_GRWLcontextpool));
+}
+
 // Searches an extension string for the specified extension
 //
 bool _grwlStringInExtensionString(const char* string, const char* extensions)
@@ -570,6 +1030,11 @@ GRWLAPI void grwlMakeContextCurrent(GRWLwindow* handle)
 
     _GRWL_REQUIRE_INIT();
 
+    if (window)
+    {
+        _GRWL_REQUIRE_WINDOW(window);
+    }
+
     _grwlPlatformSetTls(&_grwl.usercontextSlot, nullptr);
     previous = (_GRWLwindow*)_grwlPlatformGetTls(&_grwl.contextSlot);
 
@@ -580,6 +1045,8 @@ GRWLAPI void grwlMakeContextCurrent(GRWLwindow* handle)
         return;
     }
 
+    _GRWL_TRACE_ZONE("grwlMakeContextCurrent");
+
     if (previous)
     {
         if (!window || window->context.source != previous->context.source)
@@ -606,6 +1073,7 @@ GRWLAPI void grwlSwapBuffers(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->context.client == GRWL_NO_API)
     {
@@ -614,6 +1082,7 @@ GRWLAPI void grwlSwapBuffers(GRWLwindow* handle)
         return;
     }
 
+    _GRWL_TRACE_ZONE("grwlSwapBuffers");
     window->context.swapBuffers(window);
 }
 
@@ -655,66 +1124,173 @@ GRWLAPI int grwlExtensionSupported(const char* extension)
         return false;
     }
 
-    if (window->context.major >= 3)
+    // Check if extension is a client API extension or a platform extension
+    // that was looked up before
+    uintptr_t supported;
+    if (findName(&window->context.extensions, extension, &supported))
     {
-        GLint count;
+        return (int)supported;
+    }
 
-        // Check if extension is in the modern OpenGL extensions string list
+    // Check if extension is in the platform-specific string
+    // The answer is remembered, as it does not change during the lifetime of
+    // the context
+    supported = window->context.extensionSupported(extension);
+    insertName(&window->context.extensions, extension, strlen(extension), supported);
+    return (int)supported;
+}
 
-        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+GRWLAPI GRWLglproc grwlGetProcAddress(const char* procname)
+{
+    _GRWLwindow* window;
+    assert(procname != nullptr);
 
-        for (int i = 0; i < count; i++)
-        {
-            const char* en = (const char*)window->context.GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _grwlInputError(GRWL_PLATFORM_ERROR, "Extension string retrieval is broken");
-                return false;
-            }
+    _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
 
-            if (strcmp(en, extension) == 0)
-            {
-                return true;
-            }
+    window = (_GRWLwindow*)_grwlPlatformGetTls(&_grwl.contextSlot);
+    if (!window)
+    {
+        _grwlInputError(GRWL_NO_CURRENT_CONTEXT,
+                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
+        return nullptr;
+    }
+
+    return loadProc(window, procname);
+}
+
+GRWLAPI int grwlLoadProcs(const char** names, GRWLglproc* procs, int count)
+{
+    _GRWLwindow* window;
+    assert(names != nullptr);
+    assert(procs != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid entry point count %i", count);
+        return 0;
+    }
+
+    window = (_GRWLwindow*)_grwlPlatformGetTls(&_grwl.contextSlot);
+    if (!window)
+    {
+        _grwlInputError(GRWL_NO_CURRENT_CONTEXT,
+                        "Cannot query entry points without a current OpenGL or OpenGL ES context");
+        return 0;
+    }
+
+    // Grow the table once for the whole batch instead of once per doubling
+    reserveNameTable(&window->context.procs, window->context.procs.count + (size_t)count);
+
+    int loaded = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        assert(names[i] != nullptr);
+
+        procs[i] = loadProc(window, names[i]);
+        if (procs[i])
+        {
+            loaded++;
         }
     }
-    else
+
+    return loaded;
+}
+
+GRWLAPI int grwlPrewarmContexts(int count)
+{
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+
+    if (count < 0)
     {
-        // Check if extension is in the old style OpenGL extensions string
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid context count %i", count);
+        return false;
+    }
 
-        const char* extensions = (const char*)window->context.GetString(GL_EXTENSIONS);
-        if (!extensions)
+    _GRWLcontextpool* pool = &_grwl.contextPool;
+
+    if (count == 0)
+    {
+        _grwlTerminateContextPool();
+        return true;
+    }
+
+    _GRWLctxconfig ctxconfig = _grwl.hints.context;
+    ctxconfig.share = nullptr;
+
+    if (ctxconfig.client == GRWL_NO_API)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Cannot pre-create contexts without a client API");
+        return false;
+    }
+
+    if (!_grwlIsValidContextConfig(&ctxconfig))
+    {
+        return false;
+    }
+
+    _GRWLcontextpool next;
+    memset(&next, 0, sizeof(next));
+    next.ctxconfig = ctxconfig;
+
+    if (ctxconfig.source == GRWL_EGL_CONTEXT_API ||
+        (ctxconfig.source == GRWL_NATIVE_CONTEXT_API && (_grwl.platform.platformID == GRWL_PLATFORM_WAYLAND ||
+                                                         _grwl.platform.platformID == GRWL_PLATFORM_NULL)))
+    {
+        if (!_grwlInitContextPoolEGL(&next, &_grwl.hints.framebuffer))
+        {
+            return false;
+        }
+    }
+#if defined(_GRWL_X11)
+    else if (ctxconfig.source == GRWL_NATIVE_CONTEXT_API && _grwl.platform.platformID == GRWL_PLATFORM_X11)
+    {
+        if (!_grwlInitContextPoolGLX(&next, &_grwl.hints.framebuffer))
         {
-            _grwlInputError(GRWL_PLATFORM_ERROR, "Extension string retrieval is broken");
             return false;
         }
+    }
+#endif
+    else
+    {
+        _grwlInputError(GRWL_API_UNAVAILABLE, "Context pools are not supported for this context creation API");
+        return false;
+    }
 
-        if (_grwlStringInExtensionString(extension, extensions))
+    if (!pool->create || pool->config != next.config || pool->create != next.create ||
+        !isSameContextConfig(&pool->ctxconfig, &next.ctxconfig))
+    {
+        _grwlTerminateContextPool();
+
+        if (!_grwlPlatformCreateMutex(&next.mutex))
         {
-            return true;
+            return false;
         }
+
+        *pool = next;
     }
 
-    // Check if extension is in the platform-specific string
-    return window->context.extensionSupported(extension);
-}
+    _grwlPlatformLockMutex(&pool->mutex);
 
-GRWLAPI GRWLglproc grwlGetProcAddress(const char* procname)
-{
-    _GRWLwindow* window;
-    assert(procname != nullptr);
+    uintptr_t* contexts =
+        (uintptr_t*)_grwlReserveBuffer(pool->contexts, &pool->arraySize, (size_t)count * sizeof(uintptr_t));
+    if (contexts)
+    {
+        pool->contexts = contexts;
+        pool->target = count;
+    }
 
-    _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _grwlPlatformUnlockMutex(&pool->mutex);
 
-    window = (_GRWLwindow*)_grwlPlatformGetTls(&_grwl.contextSlot);
-    if (!window)
+    if (!contexts)
     {
-        _grwlInputError(GRWL_NO_CURRENT_CONTEXT,
-                        "Cannot query entry point without a current OpenGL or OpenGL ES context");
-        return nullptr;
+        return false;
     }
 
-    return window->context.getProcAddress(procname);
+    fillContextPool(pool);
+    return true;
 }
 
 GRWLAPI GRWLusercontext* grwlCreateUserContext(GRWLwindow* handle)
@@ -724,7 +1300,7 @@ GRWLAPI GRWLusercontext* grwlCreateUserContext(GRWLwindow* handle)
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
 
-    if (!window)
+    if (!_grwlIsWindowAlive(window))
     {
         _grwlInputError(GRWL_INVALID_VALUE, "Cannot create a user context without a valid window handle");
         return nullptr;
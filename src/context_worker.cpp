@@ -0,0 +1,381 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+// Set by the workers when a job has finished, so that the event processing
+// functions only look for completed jobs when there are some
+//
+static std::atomic<bool> _grwlContextJobsDone;
+
+// Removes the oldest job from the specified list
+//
+static _GRWLcontextjob* popJob(_GRWLcontextjob** head, _GRWLcontextjob** tail)
+{
+    _GRWLcontextjob* job = *head;
+    if (job)
+    {
+        *head = job->next;
+        if (!*head)
+        {
+            *tail = nullptr;
+        }
+
+        job->next = nullptr;
+    }
+
+    return job;
+}
+
+// Appends a job to the specified list
+//
+static void pushJob(_GRWLcontextjob** head, _GRWLcontextjob** tail, _GRWLcontextjob* job)
+{
+    job->next = nullptr;
+
+    if (*tail)
+    {
+        (*tail)->next = job;
+    }
+    else
+    {
+        *head = job;
+    }
+
+    *tail = job;
+}
+
+// Runs jobs with the user context of the worker current until stopped
+//
+static void workerMain(void* user)
+{
+    _GRWLcontextworker* worker = (_GRWLcontextworker*)user;
+    _GRWLworkerpool* pool = worker->pool;
+    const _GRWLcontext* context = &pool->window->context;
+
+    grwlMakeUserContextCurrent((GRWLusercontext*)worker->context);
+
+    PFNGLFENCESYNCPROC FenceSync = nullptr;
+    if (pool->sync)
+    {
+        FenceSync = (PFNGLFENCESYNCPROC)context->getProcAddress("glFenceSync");
+    }
+
+    PFNGLFLUSHPROC Flush = (PFNGLFLUSHPROC)context->getProcAddress("glFlush");
+    PFNGLFINISHPROC Finish = (PFNGLFINISHPROC)context->getProcAddress("glFinish");
+
+    for (;;)
+    {
+        _grwlPlatformLockMutex(&pool->mutex);
+
+        while (!pool->stopping && !pool->pendingHead)
+        {
+            _grwlPlatformWaitCondition(&pool->condition, &pool->mutex);
+        }
+
+        if (pool->stopping)
+        {
+            _grwlPlatformUnlockMutex(&pool->mutex);
+            break;
+        }
+
+        _GRWLcontextjob* job = popJob(&pool->pendingHead, &pool->pendingTail);
+
+        _grwlPlatformUnlockMutex(&pool->mutex);
+
+        job->function(job->user);
+
+        // Make the results of the job visible to the other contexts of the
+        // share group
+        if (!job->done)
+        {
+            Flush();
+        }
+        else if (FenceSync)
+        {
+            job->sync = FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            Flush();
+        }
+        else
+        {
+            Finish();
+        }
+
+        _grwlPlatformLockMutex(&pool->mutex);
+        pushJob(&pool->completedHead, &pool->completedTail, job);
+        _grwlPlatformUnlockMutex(&pool->mutex);
+
+        // Only wake the event loop once until it has looked for completed jobs
+        if (!_grwlContextJobsDone.exchange(true, std::memory_order_acq_rel))
+        {
+            _grwl.platform.postEmptyEvent();
+        }
+    }
+
+    grwlMakeUserContextCurrent(nullptr);
+}
+
+// Calls the completion callback of a finished job and frees it
+//
+static void finishJob(_GRWLwindow* window, _GRWLcontextjob* job)
+{
+    if (job->done)
+    {
+        _grwlBeginCallback();
+        job->done((GRWLwindow*)window, job->sync, job->user);
+        _grwlEndCallback();
+    }
+
+    _grwl_free(job);
+}
+
+// Stops the workers of the pool and destroys their contexts
+//
+static void destroyWorkerPool(_GRWLworkerpool* pool)
+{
+    _grwlPlatformLockMutex(&pool->mutex);
+    pool->stopping = true;
+    _grwlPlatformBroadcastCondition(&pool->condition);
+    _grwlPlatformUnlockMutex(&pool->mutex);
+
+    for (int i = 0; i < pool->workerCount; i++)
+    {
+        _GRWLcontextworker* worker = pool->workers + i;
+
+        _grwlPlatformJoinThread(&worker->thread);
+
+        if (worker->context)
+        {
+            worker->context->destroy(worker->context);
+        }
+    }
+
+    // Jobs that have not started are discarded without calling their callbacks
+    _GRWLcontextjob* job;
+    while ((job = popJob(&pool->pendingHead, &pool->pendingTail)))
+    {
+        _grwl_free(job);
+    }
+
+    // The application owns the fences of finished jobs, so it is still told
+    // about them
+    while ((job = popJob(&pool->completedHead, &pool->completedTail)))
+    {
+        finishJob(pool->window, job);
+    }
+
+    _grwlPlatformDestroyCondition(&pool->condition);
+    _grwlPlatformDestroyMutex(&pool->mutex);
+    _grwl_free(pool->workers);
+    _grwl_free(pool);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Stops the context workers of the window, if it has any
+//
+void _grwlStopContextWorkers(_GRWLwindow* window)
+{
+    _GRWLworkerpool* pool = window->workerPool;
+    if (!pool)
+    {
+        return;
+    }
+
+    // Jobs cannot be submitted from completion callbacks once stopping begins
+    window->workerPool = nullptr;
+    destroyWorkerPool(pool);
+}
+
+// Calls the completion callbacks of finished context jobs
+//
+void _grwlProcessContextJobs()
+{
+    if (!_grwlContextJobsDone.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    const int windowCount = _grwl.windowCount;
+
+    for (int i = 0; i < _grwl.windowCount; i++)
+    {
+        // Window objects are never freed before termination, so the window may
+        // be read after a callback has destroyed it
+        _GRWLwindow* window = _grwl.windows[i];
+
+        for (;;)
+        {
+            _GRWLworkerpool* pool = window->workerPool;
+            if (!pool)
+            {
+                break;
+            }
+
+            _grwlPlatformLockMutex(&pool->mutex);
+            _GRWLcontextjob* job = popJob(&pool->completedHead, &pool->completedTail);
+            _grwlPlatformUnlockMutex(&pool->mutex);
+
+            if (!job)
+            {
+                break;
+            }
+
+            finishJob(window, job);
+        }
+    }
+
+    // A callback destroyed windows, which may have moved others past the loop
+    if (_grwl.windowCount != windowCount)
+    {
+        if (!_grwlContextJobsDone.exchange(true, std::memory_order_acq_rel))
+        {
+            _grwl.platform.postEmptyEvent();
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GRWL public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GRWLAPI int grwlStartContextWorkers(GRWLwindow* handle, int count)
+{
+    _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, false);
+
+    if (count < 0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid worker count %i", count);
+        return false;
+    }
+
+    if (window->context.client == GRWL_NO_API)
+    {
+        _grwlInputError(GRWL_NO_WINDOW_CONTEXT,
+                        "Cannot start context workers for a window that has no OpenGL or OpenGL ES context");
+        return false;
+    }
+
+    _grwlStopContextWorkers(window);
+
+    if (count == 0)
+    {
+        return true;
+    }
+
+    _GRWLworkerpool* pool = (_GRWLworkerpool*)_grwl_calloc(1, sizeof(_GRWLworkerpool));
+    if (!pool)
+    {
+        return false;
+    }
+
+    pool->window = window;
+    pool->workers = (_GRWLcontextworker*)_grwl_calloc(count, sizeof(_GRWLcontextworker));
+    if (!pool->workers)
+    {
+        _grwl_free(pool);
+        return false;
+    }
+
+    if (window->context.client == GRWL_OPENGL_ES_API)
+    {
+        pool->sync = window->context.major >= 3;
+    }
+    else
+    {
+        pool->sync = window->context.major > 3 || (window->context.major == 3 && window->context.minor >= 2);
+    }
+
+    if (!_grwlPlatformCreateMutex(&pool->mutex))
+    {
+        _grwl_free(pool->workers);
+        _grwl_free(pool);
+        return false;
+    }
+
+    if (!_grwlPlatformCreateCondition(&pool->condition))
+    {
+        _grwlPlatformDestroyMutex(&pool->mutex);
+        _grwl_free(pool->workers);
+        _grwl_free(pool);
+        return false;
+    }
+
+    // All contexts are created before any worker starts, as creating a user
+    // context may use the window context
+    for (int i = 0; i < count; i++)
+    {
+        _GRWLcontextworker* worker = pool->workers + i;
+
+        worker->pool = pool;
+        worker->context = _grwl.platform.createUserContext(window);
+        pool->workerCount++;
+
+        if (!worker->context)
+        {
+            destroyWorkerPool(pool);
+            return false;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        _GRWLcontextworker* worker = pool->workers + i;
+
+        if (!_grwlPlatformCreateThread(&worker->thread, workerMain, worker))
+        {
+            destroyWorkerPool(pool);
+            return false;
+        }
+    }
+
+    window->workerPool = pool;
+    return true;
+}
+
+GRWLAPI int grwlSubmitContextJob(GRWLwindow* handle, GRWLcontextjobfun function, GRWLcontextjobdonefun done,
+                                 void* user)
+{
+    _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+    assert(function != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, false);
+
+    _GRWLworkerpool* pool = window->workerPool;
+    if (!pool)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Cannot submit a job to a window without context workers");
+        return false;
+    }
+
+    _GRWLcontextjob* job = (_GRWLcontextjob*)_grwl_calloc(1, sizeof(_GRWLcontextjob));
+    if (!job)
+    {
+        return false;
+    }
+
+    job->function = function;
+    job->done = done;
+    job->user = user;
+
+    _grwlPlatformLockMutex(&pool->mutex);
+    pushJob(&pool->pendingHead, &pool->pendingTail, job);
+    _grwlPlatformSignalCondition(&pool->condition);
+    _grwlPlatformUnlockMutex(&pool->mutex);
+
+    return true;
+}
@@ -60,37 +60,18 @@ static int getEGLConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return the EGLConfig most closely matching the specified hints
+// Translates every usable EGLConfig of the display into the config cache
+// This is done once, as there may be hundreds of configs with many attributes
 //
-static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig* fbconfig, EGLConfig* result)
+static bool cacheEGLConfigs()
 {
     EGLConfig* nativeConfigs;
-    _GRWLfbconfig* usableConfigs;
-    const _GRWLfbconfig* closest;
-    int nativeCount, usableCount, apiBit;
-    bool wrongApiAvailable = false;
+    _GRWLfbconfig* configs;
+    int* flags;
+    int nativeCount, count;
 
-    if (ctxconfig->client == GRWL_OPENGL_ES_API)
-    {
-        if (ctxconfig->major == 1)
-        {
-            apiBit = EGL_OPENGL_ES_BIT;
-        }
-        else
-        {
-            apiBit = EGL_OPENGL_ES2_BIT;
-        }
-    }
-    else
-    {
-        apiBit = EGL_OPENGL_BIT;
-    }
-
-    if (fbconfig->stereo)
-    {
-        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
-        return false;
-    }
+    // Without a native window the default framebuffer is a pbuffer
+    const EGLint surfaceBit = _grwl.platform.platformID == GRWL_PLATFORM_NULL ? EGL_PBUFFER_BIT : EGL_WINDOW_BIT;
 
     eglGetConfigs(_grwl.egl.display, nullptr, 0, &nativeCount);
     if (!nativeCount)
@@ -102,13 +83,14 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
     nativeConfigs = (EGLConfig*)_grwl_calloc(nativeCount, sizeof(EGLConfig));
     eglGetConfigs(_grwl.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
-    usableConfigs = (_GRWLfbconfig*)_grwl_calloc(nativeCount, sizeof(_GRWLfbconfig));
-    usableCount = 0;
+    configs = (_GRWLfbconfig*)_grwl_calloc(nativeCount, sizeof(_GRWLfbconfig));
+    flags = (int*)_grwl_calloc(nativeCount, sizeof(int));
+    count = 0;
 
     for (int i = 0; i < nativeCount; i++)
     {
         const EGLConfig n = nativeConfigs[i];
-        _GRWLfbconfig* u = usableConfigs + usableCount;
+        _GRWLfbconfig* u = configs + count;
 
         // Only consider RGB(A) EGLConfigs
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
@@ -116,8 +98,8 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
             continue;
         }
 
-        // Only consider window EGLConfigs
-        if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_WINDOW_BIT))
+        // Only consider EGLConfigs usable for the default framebuffer
+        if (!(getEGLConfigAttrib(n, EGL_SURFACE_TYPE) & surfaceBit))
         {
             continue;
         }
@@ -134,24 +116,17 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
                 continue;
             }
 
-            if (fbconfig->transparent)
+            int visualCount;
+            XVisualInfo* vis = XGetVisualInfo(_grwl.x11.display, VisualIDMask, &vi, &visualCount);
+            if (vis)
             {
-                int count;
-                XVisualInfo* vis = XGetVisualInfo(_grwl.x11.display, VisualIDMask, &vi, &count);
-                if (vis)
-                {
-                    u->transparent = _grwlIsVisualTransparentX11(vis[0].visual);
-                    XFree(vis);
-                }
+                u->transparent = _grwlIsVisualTransparentX11(vis[0].visual);
+                XFree(vis);
             }
         }
 #endif // _GRWL_X11
 
-        if (!(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE) & apiBit))
-        {
-            wrongApiAvailable = true;
-            continue;
-        }
+        flags[count] = getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE);
 
         u->redBits = getEGLConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getEGLConfigAttrib(n, EGL_GREEN_SIZE);
@@ -161,6 +136,80 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
         u->depthBits = getEGLConfigAttrib(n, EGL_DEPTH_SIZE);
         u->stencilBits = getEGLConfigAttrib(n, EGL_STENCIL_SIZE);
 
+        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+
+        u->handle = (uintptr_t)n;
+        count++;
+    }
+
+    _grwl_free(nativeConfigs);
+
+    _grwl.egl.fbconfigs.configs = configs;
+    _grwl.egl.fbconfigs.flags = flags;
+    _grwl.egl.fbconfigs.count = count;
+    return true;
+}
+
+// Return the EGLConfig most closely matching the specified hints
+//
+static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig* fbconfig, EGLConfig* result)
+{
+    _GRWLfbconfigcache* cache = &_grwl.egl.fbconfigs;
+    _GRWLfbconfig* usableConfigs;
+    const _GRWLfbconfig* closest;
+    int usableCount, apiBit;
+    bool wrongApiAvailable = false;
+    uintptr_t handle;
+
+    if (ctxconfig->client == GRWL_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+        {
+            apiBit = EGL_OPENGL_ES_BIT;
+        }
+        else
+        {
+            apiBit = EGL_OPENGL_ES2_BIT;
+        }
+    }
+    else
+    {
+        apiBit = EGL_OPENGL_BIT;
+    }
+
+    if (fbconfig->stereo)
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
+        return false;
+    }
+
+    if (_grwlFindFBConfigChoice(cache, fbconfig, apiBit, &handle))
+    {
+        *result = (EGLConfig)handle;
+        return true;
+    }
+
+    if (!cache->configs)
+    {
+        if (!cacheEGLConfigs())
+        {
+            return false;
+        }
+    }
+
+    usableConfigs = (_GRWLfbconfig*)_grwl_calloc(cache->count ? cache->count : 1, sizeof(_GRWLfbconfig));
+    usableCount = 0;
+
+    for (int i = 0; i < cache->count; i++)
+    {
+        const _GRWLfbconfig* c = cache->configs + i;
+
+        if (!(cache->flags[i] & apiBit))
+        {
+            wrongApiAvailable = true;
+            continue;
+        }
+
 #if defined(_GRWL_WAYLAND)
         if (_grwl.platform.platformID == GRWL_PLATFORM_WAYLAND)
         {
@@ -170,7 +219,7 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
             //       with an alpha channel to ensure the buffer is opaque
             if (!_grwl.egl.EXT_present_opaque)
             {
-                if (!fbconfig->transparent && u->alphaBits > 0)
+                if (!fbconfig->transparent && c->alphaBits > 0)
                 {
                     continue;
                 }
@@ -178,10 +227,16 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
         }
 #endif // _GRWL_WAYLAND
 
-        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+        _GRWLfbconfig* u = usableConfigs + usableCount;
+        *u = *c;
         u->doublebuffer = fbconfig->doublebuffer;
 
-        u->handle = (uintptr_t)n;
+        // Transparency only counts when it was requested
+        if (!fbconfig->transparent)
+        {
+            u->transparent = false;
+        }
+
         usableCount++;
     }
 
@@ -189,6 +244,7 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
     if (closest)
     {
         *result = (EGLConfig)closest->handle;
+        _grwlAddFBConfigChoice(cache, fbconfig, apiBit, closest->handle);
     }
     else
     {
@@ -216,7 +272,6 @@ static bool chooseEGLConfig(const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig
         }
     }
 
-    _grwl_free(nativeConfigs);
     _grwl_free(usableConfigs);
 
     return closest != nullptr;
@@ -430,6 +485,11 @@ bool _grwlInitEGL()
         _grwl.egl.EXT_platform_base = _grwlStringInExtensionString("EGL_EXT_platform_base", extensions);
         _grwl.egl.EXT_platform_x11 = _grwlStringInExtensionString("EGL_EXT_platform_x11", extensions);
         _grwl.egl.EXT_platform_wayland = _grwlStringInExtensionString("EGL_EXT_platform_wayland", extensions);
+        _grwl.egl.EXT_platform_device = _grwlStringInExtensionString("EGL_EXT_platform_device", extensions) &&
+                                        (_grwlStringInExtensionString("EGL_EXT_device_enumeration", extensions) ||
+                                         _grwlStringInExtensionString("EGL_EXT_device_base", extensions));
+        _grwl.egl.MESA_platform_surfaceless =
+            _grwlStringInExtensionString("EGL_MESA_platform_surfaceless", extensions);
         _grwl.egl.ANGLE_platform_angle = _grwlStringInExtensionString("EGL_ANGLE_platform_angle", extensions);
         _grwl.egl.ANGLE_platform_angle_opengl =
             _grwlStringInExtensionString("EGL_ANGLE_platform_angle_opengl", extensions);
@@ -448,6 +508,11 @@ bool _grwlInitEGL()
             (PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC)eglGetProcAddress("eglCreatePlatformWindowSurfaceEXT");
     }
 
+    if (_grwl.egl.EXT_platform_device)
+    {
+        _grwl.egl.QueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+    }
+
     _grwl.egl.platform = _grwl.platform.getEGLPlatform(&attribs);
     if (_grwl.egl.platform)
     {
@@ -490,6 +555,8 @@ bool _grwlInitEGL()
 //
 void _grwlTerminateEGL()
 {
+    _grwlFreeFBConfigCache(&_grwl.egl.fbconfigs);
+
     if (_grwl.egl.display)
     {
         eglTerminate(_grwl.egl.display);
@@ -510,13 +577,14 @@ void _grwlTerminateEGL()
         attribs[index++] = v;                                               \
     }
 
-// Create the OpenGL or OpenGL ES context for the window eglConfig
+// Create the OpenGL or OpenGL ES context for the specified EGLConfig
+// This may be called from the context pool thread
 //
-bool _grwlCreateContextForConfigEGL(EGLConfig eglConfig, const _GRWLctxconfig* ctxconfig, EGLContext* context)
+static bool createContextForShareEGL(EGLConfig eglConfig, const _GRWLctxconfig* ctxconfig, EGLContext share,
+                                     EGLContext* context)
 {
     EGLint attribs[40];
     int index = 0;
-    EGLContext share = nullptr;
 
     if (!_grwl.egl.display)
     {
@@ -524,11 +592,6 @@ bool _grwlCreateContextForConfigEGL(EGLConfig eglConfig, const _GRWLctxconfig* c
         return false;
     }
 
-    if (ctxconfig->share)
-    {
-        share = ctxconfig->share->context.egl.handle;
-    }
-
     if (ctxconfig->client == GRWL_OPENGL_ES_API)
     {
         if (!eglBindAPI(EGL_OPENGL_ES_API))
@@ -645,6 +708,85 @@ bool _grwlCreateContextForConfigEGL(EGLConfig eglConfig, const _GRWLctxconfig* c
     return true;
 }
 
+// Create the OpenGL or OpenGL ES context for the window eglConfig
+//
+bool _grwlCreateContextForConfigEGL(EGLConfig eglConfig, const _GRWLctxconfig* ctxconfig, EGLContext* context)
+{
+    EGLContext share = nullptr;
+
+    if (ctxconfig->share)
+    {
+        share = ctxconfig->share->context.egl.handle;
+    }
+
+    return createContextForShareEGL(eglConfig, ctxconfig, share, context);
+}
+
+// Creates a context for the context pool, on the pool thread
+//
+static bool createPooledContextEGL(uintptr_t config, const _GRWLctxconfig* ctxconfig, uintptr_t share,
+                                   uintptr_t* context)
+{
+    EGLContext handle;
+
+    if (!createContextForShareEGL((EGLConfig)config, ctxconfig, (EGLContext)share, &handle))
+    {
+        return false;
+    }
+
+    *context = (uintptr_t)handle;
+    return true;
+}
+
+static void destroyPooledContextEGL(uintptr_t context)
+{
+    eglDestroyContext(_grwl.egl.display, (EGLContext)context);
+}
+
+// Chooses the EGLConfig of a context pool for the specified hints
+//
+bool _grwlInitContextPoolEGL(_GRWLcontextpool* pool, const _GRWLfbconfig* fbconfig)
+{
+    EGLConfig native;
+
+    if (!_grwlInitEGL())
+    {
+        return false;
+    }
+
+    if (!chooseEGLConfig(&pool->ctxconfig, fbconfig, &native))
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "EGL: Failed to find a suitable EGLConfig");
+        return false;
+    }
+
+    pool->config = (uintptr_t)native;
+    pool->create = createPooledContextEGL;
+    pool->destroy = destroyPooledContextEGL;
+    return true;
+}
+
+// Creates the pbuffer used as the default framebuffer of an offscreen window
+//
+static EGLSurface createOffscreenSurfaceEGL(_GRWLwindow* window, int width, int height)
+{
+    EGLint attribs[40];
+    int index = 0;
+
+    // Pbuffers cannot be empty, unlike windows
+    SET_ATTRIB(EGL_WIDTH, width > 0 ? width : 1);
+    SET_ATTRIB(EGL_HEIGHT, height > 0 ? height : 1);
+
+    if (window->context.egl.colorspace)
+    {
+        SET_ATTRIB(EGL_GL_COLORSPACE_KHR, window->context.egl.colorspace);
+    }
+
+    SET_ATTRIB(EGL_NONE, EGL_NONE);
+
+    return eglCreatePbufferSurface(_grwl.egl.display, window->context.egl.config, attribs);
+}
+
 // Create the OpenGL or OpenGL ES context
 //
 bool _grwlCreateContextEGL(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig* fbconfig)
@@ -659,7 +801,13 @@ bool _grwlCreateContextEGL(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig,
         return false;
     }
 
-    if (!_grwlCreateContextForConfigEGL(window->context.egl.config, ctxconfig, &window->context.egl.handle))
+    uintptr_t pooled;
+
+    if (_grwlTakePooledContext(ctxconfig, (uintptr_t)window->context.egl.config, &pooled))
+    {
+        window->context.egl.handle = (EGLContext)pooled;
+    }
+    else if (!_grwlCreateContextForConfigEGL(window->context.egl.config, ctxconfig, &window->context.egl.handle))
     {
         return false;
     }
@@ -686,9 +834,24 @@ bool _grwlCreateContextEGL(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig,
     SET_ATTRIB(EGL_NONE, EGL_NONE);
 
     native = _grwl.platform.getEGLNativeWindow(window);
+    if (_grwl.platform.platformID == GRWL_PLATFORM_NULL)
+    {
+        int width, height;
+        _grwl.platform.getFramebufferSize(window, &width, &height);
+
+        // There is no native window, so a pbuffer of the same size is used as
+        // the default framebuffer
+        window->context.egl.offscreen = true;
+        if (fbconfig->sRGB && _grwl.egl.KHR_gl_colorspace)
+        {
+            window->context.egl.colorspace = EGL_GL_COLORSPACE_SRGB_KHR;
+        }
+
+        window->context.egl.surface = createOffscreenSurfaceEGL(window, width, height);
+    }
     // HACK: ANGLE does not implement eglCreatePlatformWindowSurfaceEXT
     //       despite reporting EGL_EXT_platform_base
-    if (_grwl.egl.platform && _grwl.egl.platform != EGL_PLATFORM_ANGLE_ANGLE)
+    else if (_grwl.egl.platform && _grwl.egl.platform != EGL_PLATFORM_ANGLE_ANGLE)
     {
         window->context.egl.surface =
             eglCreatePlatformWindowSurfaceEXT(_grwl.egl.display, window->context.egl.config, native, attribs);
@@ -808,6 +971,35 @@ bool _grwlCreateContextEGL(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig,
 
 #undef SET_ATTRIB
 
+// Replaces the pbuffer of an offscreen window with one of the specified size
+//
+void _grwlResizeOffscreenSurfaceEGL(_GRWLwindow* window, int width, int height)
+{
+    if (!window->context.egl.offscreen)
+    {
+        return;
+    }
+
+    const EGLSurface surface = createOffscreenSurfaceEGL(window, width, height);
+    if (surface == EGL_NO_SURFACE)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "EGL: Failed to resize offscreen surface: %s",
+                        getEGLErrorString(eglGetError()));
+        return;
+    }
+
+    const EGLSurface previous = window->context.egl.surface;
+    window->context.egl.surface = surface;
+
+    // The previous pbuffer is only freed once it is no longer current
+    if (_grwlPlatformGetTls(&_grwl.contextSlot) == window)
+    {
+        makeContextCurrentEGL(window);
+    }
+
+    eglDestroySurface(_grwl.egl.display, previous);
+}
+
 // Returns the Visual and depth of the chosen EGLConfig
 //
 #if defined(_GRWL_X11)
@@ -891,7 +1083,7 @@ _GRWLusercontext* _grwlCreateUserContextEGL(_GRWLwindow* window)
         free(context);
         return nullptr;
     }
-    if (grwlExtensionSupported("EGL_KHR_surfaceless_context"))
+    if (extensionSupportedEGL("EGL_KHR_surfaceless_context"))
     {
         context->egl.surface = EGL_NO_SURFACE;
     }
@@ -937,6 +1129,7 @@ GRWLAPI EGLContext grwlGetEGLContext(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(EGL_NO_CONTEXT);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, EGL_NO_CONTEXT);
 
     if (window->context.source != GRWL_EGL_CONTEXT_API)
     {
@@ -951,6 +1144,7 @@ GRWLAPI EGLSurface grwlGetEGLSurface(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(EGL_NO_SURFACE);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, EGL_NO_SURFACE);
 
     if (window->context.source != GRWL_EGL_CONTEXT_API)
     {
@@ -965,6 +1159,7 @@ GRWLAPI EGLConfig grwlGetEGLConfig(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(EGL_NO_SURFACE);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, EGL_NO_SURFACE);
 
     if (window->context.source != GRWL_EGL_CONTEXT_API)
     {
@@ -0,0 +1,133 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cassert>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Allocates the event queue if requested by the init hint
+//
+bool _grwlInitEventQueue()
+{
+    if (_grwl.hints.init.eventQueueCapacity <= 0)
+    {
+        return true;
+    }
+
+    _grwl.queue.events = (GRWLevent*)_grwl_calloc((size_t)_grwl.hints.init.eventQueueCapacity, sizeof(GRWLevent));
+    if (!_grwl.queue.events)
+    {
+        return false;
+    }
+
+    _grwl.queue.capacity = _grwl.hints.init.eventQueueCapacity;
+    return true;
+}
+
+// Frees the event queue
+//
+void _grwlTerminateEventQueue()
+{
+    _grwl_free(_grwl.queue.events);
+    memset(&_grwl.queue, 0, sizeof(_grwl.queue));
+}
+
+// Appends an event to the queue and returns it for the caller to fill in
+//
+GRWLevent* _grwlQueueEvent(int type, _GRWLwindow* window)
+{
+    assert(_grwl.queue.events != nullptr);
+
+    // Discard the oldest event rather than the newest, as the newest reflects
+    // the current state
+    if (_grwl.queue.count == _grwl.queue.capacity)
+    {
+        _grwl.queue.head = (_grwl.queue.head + 1) % _grwl.queue.capacity;
+        _grwl.queue.count--;
+    }
+
+    const int index = (_grwl.queue.head + _grwl.queue.count) % _grwl.queue.capacity;
+    _grwl.queue.count++;
+
+    GRWLevent* event = _grwl.queue.events + index;
+    memset(event, 0, sizeof(GRWLevent));
+    event->type = type;
+    event->window = (GRWLwindow*)window;
+    event->time = _grwlGetEventTime();
+    return event;
+}
+
+// Removes all queued events of the specified window
+//
+void _grwlDiscardQueuedEvents(_GRWLwindow* window)
+{
+    int count = 0;
+
+    for (int i = 0; i < _grwl.queue.count; i++)
+    {
+        const GRWLevent* event = _grwl.queue.events + (_grwl.queue.head + i) % _grwl.queue.capacity;
+        if (event->window == (GRWLwindow*)window)
+        {
+            continue;
+        }
+
+        _grwl.queue.events[(_grwl.queue.head + count) % _grwl.queue.capacity] = *event;
+        count++;
+    }
+
+    _grwl.queue.count = count;
+}
+
+// Clears the monitor of queued monitor events referring to a monitor about to
+// be freed
+//
+void _grwlForgetQueuedMonitor(_GRWLmonitor* monitor)
+{
+    for (int i = 0; i < _grwl.queue.count; i++)
+    {
+        GRWLevent* event = _grwl.queue.events + (_grwl.queue.head + i) % _grwl.queue.capacity;
+        if (event->type == GRWL_EVENT_MONITOR && event->monitor.monitor == (GRWLmonitor*)monitor)
+        {
+            event->monitor.monitor = nullptr;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GRWL public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GRWLAPI int grwlGetEvents(GRWLevent* events, int capacity)
+{
+    assert(events != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(0);
+
+    if (capacity < 0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid event count %i", capacity);
+        return 0;
+    }
+
+    const int count = capacity < _grwl.queue.count ? capacity : _grwl.queue.count;
+    if (!count)
+    {
+        return 0;
+    }
+
+    // Copy in at most two contiguous runs, as the queue may wrap around
+    const int first = _grwl.queue.capacity - _grwl.queue.head < count ? _grwl.queue.capacity - _grwl.queue.head : count;
+    memcpy(events, _grwl.queue.events + _grwl.queue.head, (size_t)first * sizeof(GRWLevent));
+    memcpy(events + first, _grwl.queue.events, (size_t)(count - first) * sizeof(GRWLevent));
+
+    _grwl.queue.count -= count;
+    _grwl.queue.head = _grwl.queue.count ? (_grwl.queue.head + count) % _grwl.queue.capacity : 0;
+    return count;
+}
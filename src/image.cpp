@@ -0,0 +1,340 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define _GRWL_IMAGE_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define _GRWL_IMAGE_AVX2
+    #include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+    #define _GRWL_IMAGE_NEON
+    #include <arm_neon.h>
+#endif
+
+// Divides by 255 with rounding, for values up to 255 * 255
+//
+static unsigned char divide255(unsigned int value)
+{
+    value += 128;
+    return (unsigned char)((value + (value >> 8)) >> 8);
+}
+
+// Retrieves the byte offsets of the red, green, blue and alpha channels of a
+// pixel in the specified format
+//
+static void getChannelOffsets(int format, int offsets[4])
+{
+    const int color = (format & _GRWL_IMAGE_ALPHA_FIRST) ? 1 : 0;
+
+    if (format & _GRWL_IMAGE_BLUE_FIRST)
+    {
+        offsets[0] = color + 2;
+        offsets[2] = color;
+    }
+    else
+    {
+        offsets[0] = color;
+        offsets[2] = color + 2;
+    }
+
+    offsets[1] = color + 1;
+    offsets[3] = (format & _GRWL_IMAGE_ALPHA_FIRST) ? 0 : 3;
+}
+
+// Converts pixels between any two formats
+//
+static void convertPixelsGeneric(unsigned char* target, int targetFormat, const unsigned char* source,
+                                 int sourceFormat, int count)
+{
+    int from[4], to[4];
+    getChannelOffsets(sourceFormat, from);
+    getChannelOffsets(targetFormat, to);
+
+    const bool sourcePremultiplied = sourceFormat & _GRWL_IMAGE_PREMULTIPLIED;
+    const bool targetPremultiplied = targetFormat & _GRWL_IMAGE_PREMULTIPLIED;
+    const bool premultiply = !sourcePremultiplied && targetPremultiplied;
+    const bool unpremultiply = sourcePremultiplied && !targetPremultiplied;
+
+    for (int i = 0; i < count; i++, source += 4, target += 4)
+    {
+        const unsigned int alpha = source[from[3]];
+
+        for (int j = 0; j < 3; j++)
+        {
+            unsigned int value = source[from[j]];
+
+            if (premultiply)
+            {
+                value = divide255(value * alpha);
+            }
+            else if (unpremultiply && alpha)
+            {
+                value = (value * 255 + alpha / 2) / alpha;
+                if (value > 255)
+                {
+                    value = 255;
+                }
+            }
+
+            target[to[j]] = (unsigned char)value;
+        }
+
+        target[to[3]] = (unsigned char)alpha;
+    }
+}
+
+// Converts pixels between RGBA and BGRA, swapping red and blue and optionally
+// premultiplying the color channels
+//
+static void convertPixelsScalar(unsigned char* target, const unsigned char* source, int count, bool swap,
+                                bool premultiply)
+{
+    const int red = swap ? 2 : 0;
+    const int blue = swap ? 0 : 2;
+
+    for (int i = 0; i < count; i++, source += 4, target += 4)
+    {
+        const unsigned int alpha = source[3];
+
+        if (premultiply)
+        {
+            target[red] = divide255(source[0] * alpha);
+            target[1] = divide255(source[1] * alpha);
+            target[blue] = divide255(source[2] * alpha);
+        }
+        else
+        {
+            target[red] = source[0];
+            target[1] = source[1];
+            target[blue] = source[2];
+        }
+
+        target[3] = (unsigned char)alpha;
+    }
+}
+
+#if defined(_GRWL_IMAGE_SSE2)
+
+// Premultiplies the color channels of two pixels widened to 16 bits
+//
+static __m128i premultiplySSE2(__m128i pixels)
+{
+    // Each pixel's alpha is multiplied by 255 to leave it unchanged
+    const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaMask = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, 0xff), 0xff);
+    alpha = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaMask);
+
+    __m128i value = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+    value = _mm_add_epi16(value, _mm_srli_epi16(value, 8));
+    return _mm_srli_epi16(value, 8);
+}
+
+static void convertPixelsSSE2(unsigned char* target, const unsigned char* source, int count, bool swap,
+                              bool premultiply)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i greenAlpha = _mm_set1_epi32((int)0xff00ff00);
+    const __m128i redBlue = _mm_set1_epi32(0x00ff00ff);
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i*)(source + i * 4));
+
+        if (premultiply)
+        {
+            const __m128i low = premultiplySSE2(_mm_unpacklo_epi8(pixels, zero));
+            const __m128i high = premultiplySSE2(_mm_unpackhi_epi8(pixels, zero));
+            pixels = _mm_packus_epi16(low, high);
+        }
+
+        if (swap)
+        {
+            const __m128i colors = _mm_and_si128(pixels, redBlue);
+            pixels = _mm_or_si128(_mm_and_si128(pixels, greenAlpha),
+                                  _mm_or_si128(_mm_slli_epi32(colors, 16), _mm_srli_epi32(colors, 16)));
+        }
+
+        _mm_storeu_si128((__m128i*)(target + i * 4), pixels);
+    }
+
+    convertPixelsScalar(target + i * 4, source + i * 4, count - i, swap, premultiply);
+}
+
+#endif // _GRWL_IMAGE_SSE2
+
+#if defined(_GRWL_IMAGE_AVX2)
+
+// Premultiplies the color channels of four pixels widened to 16 bits
+//
+__attribute__((target("avx2"))) static __m256i premultiplyAVX2(__m256i pixels)
+{
+    // Each pixel's alpha is multiplied by 255 to leave it unchanged
+    const __m256i colorMask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alphaMask = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pixels, 0xff), 0xff);
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, colorMask), alphaMask);
+
+    __m256i value = _mm256_add_epi16(_mm256_mullo_epi16(pixels, alpha), _mm256_set1_epi16(128));
+    value = _mm256_add_epi16(value, _mm256_srli_epi16(value, 8));
+    return _mm256_srli_epi16(value, 8);
+}
+
+__attribute__((target("avx2"))) static void convertPixelsAVX2(unsigned char* target, const unsigned char* source,
+                                                               int count, bool swap, bool premultiply)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5,
+                                             4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i pixels = _mm256_loadu_si256((const __m256i*)(source + i * 4));
+
+        if (premultiply)
+        {
+            // Unpacking and packing both work within 128-bit lanes, so the
+            // pixels end up in their original order
+            const __m256i low = premultiplyAVX2(_mm256_unpacklo_epi8(pixels, zero));
+            const __m256i high = premultiplyAVX2(_mm256_unpackhi_epi8(pixels, zero));
+            pixels = _mm256_packus_epi16(low, high);
+        }
+
+        if (swap)
+        {
+            pixels = _mm256_shuffle_epi8(pixels, swizzle);
+        }
+
+        _mm256_storeu_si256((__m256i*)(target + i * 4), pixels);
+    }
+
+    convertPixelsScalar(target + i * 4, source + i * 4, count - i, swap, premultiply);
+}
+
+#endif // _GRWL_IMAGE_AVX2
+
+#if defined(_GRWL_IMAGE_NEON)
+
+// Premultiplies a color channel of sixteen pixels
+//
+static uint8x16_t premultiplyNEON(uint8x16_t color, uint8x16_t alpha)
+{
+    uint16x8_t low = vmull_u8(vget_low_u8(color), vget_low_u8(alpha));
+    uint16x8_t high = vmull_u8(vget_high_u8(color), vget_high_u8(alpha));
+    low = vrsraq_n_u16(low, low, 8);
+    high = vrsraq_n_u16(high, high, 8);
+    return vcombine_u8(vrshrn_n_u16(low, 8), vrshrn_n_u16(high, 8));
+}
+
+static void convertPixelsNEON(unsigned char* target, const unsigned char* source, int count, bool swap,
+                              bool premultiply)
+{
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(source + i * 4);
+
+        if (premultiply)
+        {
+            pixels.val[0] = premultiplyNEON(pixels.val[0], pixels.val[3]);
+            pixels.val[1] = premultiplyNEON(pixels.val[1], pixels.val[3]);
+            pixels.val[2] = premultiplyNEON(pixels.val[2], pixels.val[3]);
+        }
+
+        if (swap)
+        {
+            const uint8x16_t red = pixels.val[0];
+            pixels.val[0] = pixels.val[2];
+            pixels.val[2] = red;
+        }
+
+        vst4q_u8(target + i * 4, pixels);
+    }
+
+    convertPixelsScalar(target + i * 4, source + i * 4, count - i, swap, premultiply);
+}
+
+#endif // _GRWL_IMAGE_NEON
+
+// Converts a row of pixels between formats
+//
+static void convertRow(unsigned char* target, int targetFormat, const unsigned char* source, int sourceFormat,
+                       int count)
+{
+    if (targetFormat == sourceFormat)
+    {
+        memcpy(target, source, (size_t)count * 4);
+        return;
+    }
+
+    // Only swapping red and blue and premultiplying have fast paths, as the
+    // other conversions are not needed by any platform on common hardware
+    if ((targetFormat | sourceFormat) & _GRWL_IMAGE_ALPHA_FIRST ||
+        ((sourceFormat & _GRWL_IMAGE_PREMULTIPLIED) && !(targetFormat & _GRWL_IMAGE_PREMULTIPLIED)))
+    {
+        convertPixelsGeneric(target, targetFormat, source, sourceFormat, count);
+        return;
+    }
+
+    const bool swap = (targetFormat ^ sourceFormat) & _GRWL_IMAGE_BLUE_FIRST;
+    const bool premultiply = (targetFormat ^ sourceFormat) & _GRWL_IMAGE_PREMULTIPLIED;
+
+#if defined(_GRWL_IMAGE_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        convertPixelsAVX2(target, source, count, swap, premultiply);
+        return;
+    }
+#endif
+
+#if defined(_GRWL_IMAGE_SSE2)
+    convertPixelsSSE2(target, source, count, swap, premultiply);
+#elif defined(_GRWL_IMAGE_NEON)
+    convertPixelsNEON(target, source, count, swap, premultiply);
+#else
+    convertPixelsScalar(target, source, count, swap, premultiply);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Converts the pixels of an image to packed rows of the specified format
+//
+void _grwlConvertImage(void* target, int format, const GRWLformattedimage* image)
+{
+    const size_t rowSize = (size_t)image->width * 4;
+    const size_t stride = image->stride ? (size_t)image->stride : rowSize;
+    const unsigned char* source = image->pixels;
+    unsigned char* output = (unsigned char*)target;
+
+    if (format == image->format && stride == rowSize)
+    {
+        memcpy(output, source, rowSize * image->height);
+        return;
+    }
+
+    for (int y = 0; y < image->height; y++)
+    {
+        convertRow(output, format, source, image->format, image->width);
+        output += rowSize;
+        source += stride;
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <cstddef>
 #include <cstdio>
 #include <cstdarg>
 #include <cassert>
@@ -21,7 +22,7 @@ _GRWLlibrary _grwl = { false };
 // These are outside of _grwl so they can be used before initialization and
 // after termination without special handling when _grwl is cleared to zero
 //
-static _GRWLerror _grwlMainThreadError;
+static thread_local _GRWLerror _grwlError;
 static GRWLerrorfun _grwlErrorCallback;
 static GRWLallocator _grwlInitAllocator;
 static _GRWLinitconfig _grwlInitHints = {
@@ -29,6 +30,8 @@ static _GRWLinitconfig _grwlInitHints = {
     GRWL_ANGLE_PLATFORM_TYPE_NONE, // ANGLE backend
     GRWL_ANY_PLATFORM,             // preferred platform
     false,                         // whether to manage preedit candidate
+    0,                             // event queue capacity
+    false,                         // whether to read input on a separate thread
     nullptr,                       // vkGetInstanceProcAddr function
     {
         true, // macOS menu bar
@@ -41,6 +44,9 @@ static _GRWLinitconfig _grwlInitHints = {
     {
         GRWL_WAYLAND_PREFER_LIBDECOR // Wayland libdecor mode
     },
+    {
+        1 // Null virtual monitor count
+    },
 };
 
 // The allocation function used when no custom allocator is set
@@ -70,11 +76,20 @@ static void terminate()
 {
     memset(&_grwl.callbacks, 0, sizeof(_grwl.callbacks));
 
-    while (_grwl.windowListHead)
+    _grwlStopInputRecording();
+
+    _grwl_free(_grwl.record.serials);
+    _grwl.record.serials = nullptr;
+    _grwl.record.serialArraySize = 0;
+
+    while (_grwl.windowCount)
     {
-        grwlDestroyWindow((GRWLwindow*)_grwl.windowListHead);
+        grwlDestroyWindow((GRWLwindow*)_grwl.windows[_grwl.windowCount - 1]);
     }
 
+    _grwlTerminateWindows();
+    _grwlTerminateContextPool();
+
     while (_grwl.cursorListHead)
     {
         grwlDestroyCursor((GRWLcursor*)_grwl.cursorListHead);
@@ -94,142 +109,352 @@ static void terminate()
     _grwl.mappings = nullptr;
     _grwl.mappingCount = 0;
 
+    // Pending clipboard requests are dropped without calling their callbacks
+    _grwl_free(_grwl.clipboardRequests);
+    _grwl.clipboardRequests = nullptr;
+    _grwl.clipboardRequestCount = 0;
+
+    _grwlTerminateEventQueue();
+    _grwlTerminateMessageQueue();
+
     _grwlTerminateVulkan();
     _grwl.platform.terminateJoysticks();
     _grwl.platform.terminate();
+    _grwlTerminateArena();
 
     _grwl.initialized = false;
 
-    while (_grwl.errorListHead)
-    {
-        _GRWLerror* error = _grwl.errorListHead;
-        _grwl.errorListHead = error->next;
-        _grwl_free(error);
-    }
-
     _grwlPlatformDestroyTls(&_grwl.usercontextSlot);
     _grwlPlatformDestroyTls(&_grwl.contextSlot);
-    _grwlPlatformDestroyTls(&_grwl.errorSlot);
-    _grwlPlatformDestroyMutex(&_grwl.errorLock);
 
     memset(&_grwl, 0, sizeof(_grwl));
 }
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GRWL internal API                      //////
-//////////////////////////////////////////////////////////////////////////
+// Returns the description of an error reported without a format
+//
+static const char* getDefaultDescription(int code)
+{
+    switch (code)
+    {
+        case GRWL_NOT_INITIALIZED:
+            return "The GRWL library is not initialized";
+        case GRWL_NO_CURRENT_CONTEXT:
+            return "There is no current context";
+        case GRWL_INVALID_ENUM:
+            return "Invalid argument for enum parameter";
+        case GRWL_INVALID_VALUE:
+            return "Invalid value for parameter";
+        case GRWL_OUT_OF_MEMORY:
+            return "Out of memory";
+        case GRWL_API_UNAVAILABLE:
+            return "The requested API is unavailable";
+        case GRWL_VERSION_UNAVAILABLE:
+            return "The requested API version is unavailable";
+        case GRWL_PLATFORM_ERROR:
+            return "A platform-specific error occurred";
+        case GRWL_FORMAT_UNAVAILABLE:
+            return "The requested format is unavailable";
+        case GRWL_NO_WINDOW_CONTEXT:
+            return "The specified window has no context";
+        case GRWL_CURSOR_UNAVAILABLE:
+            return "The specified cursor shape is unavailable";
+        case GRWL_FEATURE_UNAVAILABLE:
+            return "The requested feature cannot be implemented for this platform";
+        case GRWL_FEATURE_UNIMPLEMENTED:
+            return "The requested feature has not yet been implemented for this platform";
+        case GRWL_PLATFORM_UNAVAILABLE:
+            return "The requested platform is unavailable";
+        default:
+            return "ERROR: UNKNOWN GRWL ERROR";
+    }
+}
+
+// The types of error description arguments
+//
+enum
+{
+    _GRWL_ERROR_ARG_NONE,
+    _GRWL_ERROR_ARG_INT,
+    _GRWL_ERROR_ARG_LONG,
+    _GRWL_ERROR_ARG_LONG_LONG,
+    _GRWL_ERROR_ARG_SIZE,
+    _GRWL_ERROR_ARG_INTMAX,
+    _GRWL_ERROR_ARG_PTRDIFF,
+    _GRWL_ERROR_ARG_DOUBLE,
+    _GRWL_ERROR_ARG_LONG_DOUBLE,
+    _GRWL_ERROR_ARG_POINTER,
+    _GRWL_ERROR_ARG_STRING
+};
 
-// Encode a Unicode code point to a UTF-8 stream
-// Based on cutef8 by Jeff Bezanson (Public Domain)
+// Parses the printf conversion specification starting at the percent sign and
+// returns the type of its argument, or -1 if it cannot be recorded
 //
-size_t _grwlEncodeUTF8(char* s, uint32_t codepoint)
+static int parseConversion(const char* spec, size_t* length)
 {
-    size_t count = 0;
+    const char* c = spec + 1;
+    int type = _GRWL_ERROR_ARG_INT;
 
-    if (codepoint < 0x80)
+    c += strspn(c, "-+ #0123456789.");
+
+    if (c[0] == 'h')
+    {
+        c += (c[1] == 'h') ? 2 : 1;
+    }
+    else if (c[0] == 'l' && c[1] == 'l')
     {
-        s[count++] = (char)codepoint;
+        type = _GRWL_ERROR_ARG_LONG_LONG;
+        c += 2;
     }
-    else if (codepoint < 0x800)
+    else if (c[0] == 'l')
     {
-        s[count++] = (codepoint >> 6) | 0xc0;
-        s[count++] = (codepoint & 0x3f) | 0x80;
+        type = _GRWL_ERROR_ARG_LONG;
+        c++;
     }
-    else if (codepoint < 0x10000)
+    else if (c[0] == 'z')
     {
-        s[count++] = (codepoint >> 12) | 0xe0;
-        s[count++] = ((codepoint >> 6) & 0x3f) | 0x80;
-        s[count++] = (codepoint & 0x3f) | 0x80;
+        type = _GRWL_ERROR_ARG_SIZE;
+        c++;
     }
-    else if (codepoint < 0x110000)
+    else if (c[0] == 'j')
     {
-        s[count++] = (codepoint >> 18) | 0xf0;
-        s[count++] = ((codepoint >> 12) & 0x3f) | 0x80;
-        s[count++] = ((codepoint >> 6) & 0x3f) | 0x80;
-        s[count++] = (codepoint & 0x3f) | 0x80;
+        type = _GRWL_ERROR_ARG_INTMAX;
+        c++;
+    }
+    else if (c[0] == 't')
+    {
+        type = _GRWL_ERROR_ARG_PTRDIFF;
+        c++;
+    }
+    else if (c[0] == 'L')
+    {
+        type = _GRWL_ERROR_ARG_LONG_DOUBLE;
+        c++;
+    }
+
+    *length = (size_t)(c - spec) + 1;
+    if (*length >= 32)
+    {
+        return -1;
     }
 
-    return count;
+    switch (*c)
+    {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            return type == _GRWL_ERROR_ARG_LONG_DOUBLE ? -1 : type;
+        case 'c':
+            return type == _GRWL_ERROR_ARG_INT ? type : -1;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            return type == _GRWL_ERROR_ARG_LONG_DOUBLE ? type : _GRWL_ERROR_ARG_DOUBLE;
+        case 'p':
+            return _GRWL_ERROR_ARG_POINTER;
+        case 's':
+            return type == _GRWL_ERROR_ARG_INT ? _GRWL_ERROR_ARG_STRING : -1;
+        case '%':
+            return *length == 2 ? _GRWL_ERROR_ARG_NONE : -1;
+        default:
+            return -1;
+    }
 }
 
-// Decode a Unicode code point from a UTF-8 stream
-// Based on cutef8 by Jeff Bezanson (Public Domain)
+// Records the arguments of an error description for formatting it later
+// Returns false if the format uses a conversion that cannot be recorded
 //
-uint32_t _grwlDecodeUTF8(const char** s)
+static bool recordArguments(_GRWLerror* error, const char* format, va_list vl)
 {
-    uint32_t codepoint = 0, count = 0;
-    static const uint32_t offsets[] = { 0x00000000u, 0x00003080u, 0x000e2080u, 0x03c82080u, 0xfa082080u, 0x82082080u };
+    error->argCount = 0;
+    error->stringSize = 0;
 
-    do
+    for (const char* c = strchr(format, '%'); c; c = strchr(c, '%'))
     {
-        codepoint = (codepoint << 6) + (unsigned char)**s;
-        (*s)++;
-        count++;
-    } while ((**s & 0xc0) == 0x80);
+        size_t length;
+        const int type = parseConversion(c, &length);
+        c += length;
+
+        if (type == _GRWL_ERROR_ARG_NONE)
+        {
+            continue;
+        }
+
+        if (type < 0 || error->argCount == _GRWL_ERROR_ARG_COUNT)
+        {
+            return false;
+        }
 
-    assert(count <= 6);
-    return codepoint - offsets[count - 1];
+        _GRWLerrorarg* arg = error->args + error->argCount++;
+        arg->type = type;
+
+        switch (type)
+        {
+            case _GRWL_ERROR_ARG_INT:
+                arg->integer = va_arg(vl, unsigned int);
+                break;
+            case _GRWL_ERROR_ARG_LONG:
+                arg->integer = va_arg(vl, unsigned long);
+                break;
+            case _GRWL_ERROR_ARG_LONG_LONG:
+                arg->integer = va_arg(vl, unsigned long long);
+                break;
+            case _GRWL_ERROR_ARG_SIZE:
+                arg->integer = va_arg(vl, size_t);
+                break;
+            case _GRWL_ERROR_ARG_INTMAX:
+                arg->integer = va_arg(vl, uintmax_t);
+                break;
+            case _GRWL_ERROR_ARG_PTRDIFF:
+                arg->integer = (uintmax_t)va_arg(vl, ptrdiff_t);
+                break;
+            case _GRWL_ERROR_ARG_DOUBLE:
+                arg->real = va_arg(vl, double);
+                break;
+            case _GRWL_ERROR_ARG_LONG_DOUBLE:
+                arg->longReal = va_arg(vl, long double);
+                break;
+            case _GRWL_ERROR_ARG_POINTER:
+                arg->pointer = va_arg(vl, void*);
+                break;
+            case _GRWL_ERROR_ARG_STRING:
+            {
+                const char* string = va_arg(vl, const char*);
+                if (!string)
+                {
+                    string = "(null)";
+                }
+
+                const size_t size = strlen(string) + 1;
+                if (size > sizeof(error->strings) - error->stringSize)
+                {
+                    return false;
+                }
+
+                memcpy(error->strings + error->stringSize, string, size);
+                arg->integer = error->stringSize;
+                error->stringSize += size;
+                break;
+            }
+        }
+    }
+
+    return true;
 }
 
-// Splits and translates a text/uri-list into separate file paths
-// NOTE: This function destroys the provided string
+// Formats an error description from its format and recorded arguments
 //
-char** _grwlParseUriList(char* text, int* count)
+static void formatDescription(_GRWLerror* error)
 {
-    const char* prefix = "file://";
-    char** paths = nullptr;
-    char* line;
-
-    *count = 0;
+    char* output = error->buffer;
+    size_t remaining = sizeof(error->buffer);
+    const char* c = error->format;
+    int index = 0;
 
-    while ((line = strtok(text, "\r\n")))
+    while (*c && remaining > 1)
     {
-        char* path;
-
-        text = nullptr;
-
-        if (line[0] == '#')
+        if (*c != '%')
         {
+            *output++ = *c++;
+            remaining--;
             continue;
         }
 
-        if (strncmp(line, prefix, strlen(prefix)) == 0)
+        char spec[32];
+        size_t length;
+        const int type = parseConversion(c, &length);
+        memcpy(spec, c, length);
+        spec[length] = '\0';
+        c += length;
+
+        if (type == _GRWL_ERROR_ARG_NONE)
         {
-            line += strlen(prefix);
-            // TODO: Validate hostname
-            while (*line != '/')
-            {
-                line++;
-            }
+            *output++ = '%';
+            remaining--;
+            continue;
         }
 
-        (*count)++;
+        const _GRWLerrorarg* arg = error->args + index++;
+        int count = 0;
 
-        path = (char*)_grwl_calloc(strlen(line) + 1, 1);
-        paths = (char**)_grwl_realloc(paths, *count * sizeof(char*));
-        paths[*count - 1] = path;
+        switch (type)
+        {
+            case _GRWL_ERROR_ARG_INT:
+                count = snprintf(output, remaining, spec, (unsigned int)arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_LONG:
+                count = snprintf(output, remaining, spec, (unsigned long)arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_LONG_LONG:
+                count = snprintf(output, remaining, spec, (unsigned long long)arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_SIZE:
+                count = snprintf(output, remaining, spec, (size_t)arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_INTMAX:
+                count = snprintf(output, remaining, spec, arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_PTRDIFF:
+                count = snprintf(output, remaining, spec, (ptrdiff_t)arg->integer);
+                break;
+            case _GRWL_ERROR_ARG_DOUBLE:
+                count = snprintf(output, remaining, spec, arg->real);
+                break;
+            case _GRWL_ERROR_ARG_LONG_DOUBLE:
+                count = snprintf(output, remaining, spec, arg->longReal);
+                break;
+            case _GRWL_ERROR_ARG_POINTER:
+                count = snprintf(output, remaining, spec, arg->pointer);
+                break;
+            case _GRWL_ERROR_ARG_STRING:
+                count = snprintf(output, remaining, spec, error->strings + arg->integer);
+                break;
+        }
 
-        while (*line)
+        if (count < 0)
         {
-            if (line[0] == '%' && line[1] && line[2])
-            {
-                const char digits[3] = { line[1], line[2], '\0' };
-                *path = (char)strtol(digits, nullptr, 16);
-                line += 2;
-            }
-            else
-            {
-                *path = *line;
-            }
+            break;
+        }
 
-            path++;
-            line++;
+        if ((size_t)count >= remaining)
+        {
+            output += remaining - 1;
+            remaining = 1;
+            break;
         }
+
+        output += count;
+        remaining -= (size_t)count;
+    }
+
+    *output = '\0';
+}
+
+// Returns the description of an error, formatting it if necessary
+//
+static const char* getDescription(_GRWLerror* error)
+{
+    if (error->format)
+    {
+        formatDescription(error);
+        error->format = nullptr;
+        error->description = error->buffer;
     }
 
-    return paths;
+    return error->description;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
 char* _grwl_strdup(const char* source)
 {
     const size_t length = strlen(source);
@@ -303,6 +528,8 @@ void* _grwl_calloc(size_t count, size_t size)
         block = _grwl.allocator.allocate(count * size, _grwl.allocator.user);
         if (block)
         {
+            _grwl.stats.allocations++;
+            _grwl.stats.allocatedBytes += count * size;
             return memset(block, 0, count * size);
         }
         else
@@ -324,6 +551,8 @@ void* _grwl_realloc(void* block, size_t size)
         void* resized = _grwl.allocator.reallocate(block, size, _grwl.allocator.user);
         if (resized)
         {
+            _grwl.stats.allocations++;
+            _grwl.stats.allocatedBytes += size;
             return resized;
         }
         else
@@ -351,114 +580,177 @@ void _grwl_free(void* block)
     }
 }
 
+// Grows the specified buffer to hold at least the specified number of bytes,
+// keeping its contents
+// Returns the possibly moved buffer, or nullptr if it could not be grown, in
+// which case the original buffer is left untouched
+//
+void* _grwlReserveBuffer(void* buffer, size_t* capacity, size_t size)
+{
+    if (size <= *capacity)
+    {
+        return buffer;
+    }
+
+    size_t newCapacity = *capacity ? *capacity : 64;
+    while (newCapacity < size)
+    {
+        newCapacity *= 2;
+    }
+
+    void* resized = _grwl_realloc(buffer, newCapacity);
+    if (!resized)
+    {
+        return nullptr;
+    }
+
+    *capacity = newCapacity;
+    return resized;
+}
+
+// Allocates zeroed memory that remains valid until the next event processing
+// call
+// Once the arena has grown to fit the working set this does not use the heap
+//
+void* _grwlArenaAlloc(size_t size)
+{
+    const size_t alignment = alignof(std::max_align_t);
+    size = (size + alignment - 1) & ~(alignment - 1);
+
+    if (_grwl.arena.size - _grwl.arena.used >= size)
+    {
+        unsigned char* block = _grwl.arena.block + _grwl.arena.used;
+        _grwl.arena.used += size;
+        return memset(block, 0, size);
+    }
+
+    // The allocation is linked into the overflow list through its header and
+    // the block is grown to fit it on the next reset
+    unsigned char* block = (unsigned char*)_grwl_calloc(1, alignment + size);
+    if (!block)
+    {
+        return nullptr;
+    }
+
+    *(void**)block = _grwl.arena.overflow;
+    _grwl.arena.overflow = block;
+    _grwl.arena.overflowSize += size;
+    return block + alignment;
+}
+
+// Frees everything allocated from the arena
+//
+void _grwlResetArena()
+{
+    while (_grwl.arena.overflow)
+    {
+        void* next = *(void**)_grwl.arena.overflow;
+        _grwl_free(_grwl.arena.overflow);
+        _grwl.arena.overflow = next;
+    }
+
+    if (_grwl.arena.overflowSize)
+    {
+        size_t size = _grwl.arena.size ? _grwl.arena.size : 4096;
+        while (size < _grwl.arena.used + _grwl.arena.overflowSize)
+        {
+            size *= 2;
+        }
+
+        _grwl_free(_grwl.arena.block);
+        _grwl.arena.block = (unsigned char*)_grwl_calloc(1, size);
+        _grwl.arena.size = _grwl.arena.block ? size : 0;
+        _grwl.arena.overflowSize = 0;
+    }
+
+    _grwl.arena.used = 0;
+}
+
+// Frees the arena
+//
+void _grwlTerminateArena()
+{
+    _grwlResetArena();
+    _grwl_free(_grwl.arena.block);
+    memset(&_grwl.arena, 0, sizeof(_grwl.arena));
+}
+
+// Marks the start of a call into a user callback
+// Time spent in nested callbacks is only counted once
+//
+void _grwlBeginCallback()
+{
+    _grwl.stats.callbacks++;
+
+    if (_grwl.stats.callbackDepth++ == 0)
+    {
+        _grwl.stats.callbackStart = _grwlPlatformGetTimerValue();
+    }
+}
+
+// Marks the end of a call into a user callback
+//
+void _grwlEndCallback()
+{
+    if (--_grwl.stats.callbackDepth == 0)
+    {
+        _grwl.stats.callbackTicks += _grwlPlatformGetTimerValue() - _grwl.stats.callbackStart;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GRWL event API                       //////
 //////////////////////////////////////////////////////////////////////////
 
 // Notifies shared code of an error
+// Only the format and its arguments are recorded, as most descriptions are never
+// requested
 //
 void _grwlInputError(int code, const char* format, ...)
 {
-    _GRWLerror* error;
-    char description[_GRWL_MESSAGE_SIZE];
+    _GRWLerror* error = &_grwlError;
 
-    if (format)
-    {
-        va_list vl;
-
-        va_start(vl, format);
-        vsnprintf(description, sizeof(description), format, vl);
-        va_end(vl);
+    error->code = code;
+    error->format = nullptr;
 
-        description[sizeof(description) - 1] = '\0';
+    if (!format)
+    {
+        error->description = getDefaultDescription(code);
+    }
+    else if (!strchr(format, '%'))
+    {
+        error->description = format;
     }
     else
     {
-        if (code == GRWL_NOT_INITIALIZED)
-        {
-            strcpy(description, "The GRWL library is not initialized");
-        }
-        else if (code == GRWL_NO_CURRENT_CONTEXT)
-        {
-            strcpy(description, "There is no current context");
-        }
-        else if (code == GRWL_INVALID_ENUM)
-        {
-            strcpy(description, "Invalid argument for enum parameter");
-        }
-        else if (code == GRWL_INVALID_VALUE)
-        {
-            strcpy(description, "Invalid value for parameter");
-        }
-        else if (code == GRWL_OUT_OF_MEMORY)
-        {
-            strcpy(description, "Out of memory");
-        }
-        else if (code == GRWL_API_UNAVAILABLE)
-        {
-            strcpy(description, "The requested API is unavailable");
-        }
-        else if (code == GRWL_VERSION_UNAVAILABLE)
-        {
-            strcpy(description, "The requested API version is unavailable");
-        }
-        else if (code == GRWL_PLATFORM_ERROR)
-        {
-            strcpy(description, "A platform-specific error occurred");
-        }
-        else if (code == GRWL_FORMAT_UNAVAILABLE)
-        {
-            strcpy(description, "The requested format is unavailable");
-        }
-        else if (code == GRWL_NO_WINDOW_CONTEXT)
-        {
-            strcpy(description, "The specified window has no context");
-        }
-        else if (code == GRWL_CURSOR_UNAVAILABLE)
-        {
-            strcpy(description, "The specified cursor shape is unavailable");
-        }
-        else if (code == GRWL_FEATURE_UNAVAILABLE)
-        {
-            strcpy(description, "The requested feature cannot be implemented for this platform");
-        }
-        else if (code == GRWL_FEATURE_UNIMPLEMENTED)
-        {
-            strcpy(description, "The requested feature has not yet been implemented for this platform");
-        }
-        else if (code == GRWL_PLATFORM_UNAVAILABLE)
+        va_list vl, args;
+
+        va_start(vl, format);
+        va_copy(args, vl);
+
+        if (recordArguments(error, format, args))
         {
-            strcpy(description, "The requested platform is unavailable");
+            error->format = format;
         }
         else
         {
-            strcpy(description, "ERROR: UNKNOWN GRWL ERROR");
+            vsnprintf(error->buffer, sizeof(error->buffer), format, vl);
+            error->buffer[sizeof(error->buffer) - 1] = '\0';
+            error->description = error->buffer;
         }
-    }
 
-    if (_grwl.initialized)
-    {
-        error = (_GRWLerror*)_grwlPlatformGetTls(&_grwl.errorSlot);
-        if (!error)
-        {
-            error = (_GRWLerror*)_grwl_calloc(1, sizeof(_GRWLerror));
-            _grwlPlatformSetTls(&_grwl.errorSlot, error);
-            _grwlPlatformLockMutex(&_grwl.errorLock);
-            error->next = _grwl.errorListHead;
-            _grwl.errorListHead = error;
-            _grwlPlatformUnlockMutex(&_grwl.errorLock);
-        }
-    }
-    else
-    {
-        error = &_grwlMainThreadError;
+        va_end(args);
+        va_end(vl);
     }
 
-    error->code = code;
-    strcpy(error->description, description);
-
     if (_grwlErrorCallback)
     {
+        // The callback gets its own copy of the description, as an error
+        // reported from inside the callback replaces the one in the slot
+        char description[_GRWL_MESSAGE_SIZE];
+        strncpy(description, getDescription(error), sizeof(description) - 1);
+        description[sizeof(description) - 1] = '\0';
+
         _grwlErrorCallback(code, description);
     }
 }
@@ -469,6 +761,8 @@ void _grwlInputError(int code, const char* format, ...)
 
 GRWLAPI int grwlInit()
 {
+    _GRWL_TRACE_ZONE("grwlInit");
+
     if (_grwl.initialized)
     {
         return true;
@@ -496,20 +790,23 @@ GRWLAPI int grwlInit()
         return false;
     }
 
-    if (!_grwlPlatformCreateMutex(&_grwl.errorLock) || !_grwlPlatformCreateTls(&_grwl.errorSlot) ||
-        !_grwlPlatformCreateTls(&_grwl.contextSlot) || !_grwlPlatformCreateTls(&_grwl.usercontextSlot))
+    if (!_grwlPlatformCreateTls(&_grwl.contextSlot) || !_grwlPlatformCreateTls(&_grwl.usercontextSlot))
     {
         terminate();
         return false;
     }
 
-    _grwlPlatformSetTls(&_grwl.errorSlot, &_grwlMainThreadError);
-
     _grwlInitGamepadMappings();
 
     _grwlPlatformInitTimer();
     _grwl.timer.offset = _grwlPlatformGetTimerValue();
 
+    if (!_grwlInitEventQueue() || !_grwlInitMessageQueue())
+    {
+        terminate();
+        return false;
+    }
+
     _grwl.initialized = true;
 
     grwlDefaultWindowHints();
@@ -542,6 +839,12 @@ GRWLAPI void grwlInitHint(int hint, int value)
         case GRWL_MANAGE_PREEDIT_CANDIDATE:
             _grwlInitHints.managePreeditCandidate = value;
             return;
+        case GRWL_EVENT_QUEUE_CAPACITY:
+            _grwlInitHints.eventQueueCapacity = value;
+            return;
+        case GRWL_INPUT_THREAD:
+            _grwlInitHints.inputThread = value;
+            return;
         case GRWL_COCOA_CHDIR_RESOURCES:
             _grwlInitHints.ns.chdir = value;
             return;
@@ -557,6 +860,9 @@ GRWLAPI void grwlInitHint(int hint, int value)
         case GRWL_WAYLAND_LIBDECOR:
             _grwlInitHints.wl.libdecorMode = value;
             return;
+        case GRWL_NULL_MONITOR_COUNT:
+            _grwlInitHints.null.monitorCount = value;
+            return;
     }
 
     _grwlInputError(GRWL_INVALID_ENUM, "Invalid init hint 0x%08X", hint);
@@ -604,36 +910,53 @@ GRWLAPI void grwlGetVersion(int* major, int* minor, int* rev)
 
 GRWLAPI int grwlGetError(const char** description)
 {
-    _GRWLerror* error;
-    int code = GRWL_NO_ERROR;
+    _GRWLerror* error = &_grwlError;
+    const int code = error->code;
 
     if (description)
     {
         *description = nullptr;
     }
 
-    if (_grwl.initialized)
-    {
-        error = (_GRWLerror*)_grwlPlatformGetTls(&_grwl.errorSlot);
-    }
-    else
-    {
-        error = &_grwlMainThreadError;
-    }
-
-    if (error)
+    error->code = GRWL_NO_ERROR;
+    if (description && code)
     {
-        code = error->code;
-        error->code = GRWL_NO_ERROR;
-        if (description && code)
-        {
-            *description = error->description;
-        }
+        *description = getDescription(error);
     }
 
     return code;
 }
 
+GRWLAPI void grwlGetStatistics(GRWLstatistics* statistics)
+{
+    assert(statistics != nullptr);
+
+    memset(statistics, 0, sizeof(GRWLstatistics));
+
+    _GRWL_REQUIRE_INIT();
+
+    statistics->events = _grwl.stats.events;
+    statistics->pollWakeups = _grwl.stats.pollWakeups;
+    statistics->roundTrips = _grwl.stats.roundTrips;
+    statistics->allocations = _grwl.stats.allocations;
+    statistics->allocatedBytes = _grwl.stats.allocatedBytes;
+    statistics->callbacks = _grwl.stats.callbacks;
+    statistics->callbackTime = _grwl.stats.callbackTicks / (double)_grwlPlatformGetTimerFrequency();
+}
+
+GRWLAPI void grwlResetStatistics()
+{
+    _GRWL_REQUIRE_INIT();
+
+    _grwl.stats.events = 0;
+    _grwl.stats.pollWakeups = 0;
+    _grwl.stats.roundTrips = 0;
+    _grwl.stats.allocations = 0;
+    _grwl.stats.allocatedBytes = 0;
+    _grwl.stats.callbacks = 0;
+    _grwl.stats.callbackTicks = 0;
+}
+
 GRWLAPI int grwlIsInitialized()
 {
     return _grwl.initialized;
@@ -20,9 +20,6 @@
 #define _GRWL_JOYSTICK_BUTTON 2
 #define _GRWL_JOYSTICK_HATBIT 3
 
-#define GRWL_MOD_MASK \
-    (GRWL_MOD_SHIFT | GRWL_MOD_CONTROL | GRWL_MOD_ALT | GRWL_MOD_SUPER | GRWL_MOD_CAPS_LOCK | GRWL_MOD_NUM_LOCK)
-
 // Initializes the platform joystick API if it has not been already
 //
 static bool initJoysticks()
@@ -318,6 +315,13 @@ static bool parseMapping(_GRWLmapping* mapping, const char* string)
     return true;
 }
 
+// Reads the clipboard synchronously and delivers it to the pending requests
+//
+static void deliverClipboardString(void* user)
+{
+    _grwlInputClipboardString(_grwl.platform.getClipboardString());
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GRWL event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -326,9 +330,21 @@ static bool parseMapping(_GRWLmapping* mapping, const char* string)
 //
 void _grwlInputKeyboardLayout()
 {
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInput(_GRWL_RECORD_KEYBOARD_LAYOUT, 0, nullptr, 0);
+    }
+
+    if (_grwl.queue.events)
+    {
+        _grwlQueueEvent(GRWL_EVENT_KEYBOARD_LAYOUT, nullptr);
+    }
+
     if (_grwl.callbacks.layout)
     {
+        _grwlBeginCallback();
         _grwl.callbacks.layout();
+        _grwlEndCallback();
     }
 }
 
@@ -342,6 +358,12 @@ void _grwlInputKey(_GRWLwindow* window, int key, int scancode, int action, int m
     assert(action == GRWL_PRESS || action == GRWL_RELEASE);
     assert(mods == (mods & GRWL_MOD_MASK));
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { key, scancode, action, mods };
+        _grwlRecordInput(_GRWL_RECORD_KEY, window->serial, data, sizeof(data));
+    }
+
     if (key >= 0 && key <= GRWL_KEY_LAST)
     {
         bool repeated = false;
@@ -376,9 +398,20 @@ void _grwlInputKey(_GRWLwindow* window, int key, int scancode, int action, int m
         mods &= ~(GRWL_MOD_CAPS_LOCK | GRWL_MOD_NUM_LOCK);
     }
 
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_KEY, window);
+        queued->key.key = key;
+        queued->key.scancode = scancode;
+        queued->key.action = action;
+        queued->key.mods = mods;
+    }
+
     if (window->callbacks.key)
     {
+        _grwlBeginCallback();
         window->callbacks.key((GRWLwindow*)window, key, scancode, action, mods);
+        _grwlEndCallback();
     }
 }
 
@@ -391,6 +424,12 @@ void _grwlInputChar(_GRWLwindow* window, uint32_t codepoint, int mods, bool plai
     assert(mods == (mods & GRWL_MOD_MASK));
     assert(plain == true || plain == false);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { (int)codepoint, mods, plain };
+        _grwlRecordInput(_GRWL_RECORD_CHAR, window->serial, data, sizeof(data));
+    }
+
     if (codepoint < 32 || (codepoint > 126 && codepoint < 160))
     {
         return;
@@ -403,14 +442,25 @@ void _grwlInputChar(_GRWLwindow* window, uint32_t codepoint, int mods, bool plai
 
     if (window->callbacks.charmods)
     {
+        _grwlBeginCallback();
         window->callbacks.charmods((GRWLwindow*)window, codepoint, mods);
+        _grwlEndCallback();
     }
 
     if (plain)
     {
+        if (_grwl.queue.events)
+        {
+            GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_CHAR, window);
+            queued->character.codepoint = codepoint;
+            queued->character.mods = mods;
+        }
+
         if (window->callbacks.character)
         {
+            _grwlBeginCallback();
             window->callbacks.character((GRWLwindow*)window, codepoint);
+            _grwlEndCallback();
         }
     }
 }
@@ -419,11 +469,18 @@ void _grwlInputChar(_GRWLwindow* window, uint32_t codepoint, int mods, bool plai
 //
 void _grwlInputPreedit(_GRWLwindow* window)
 {
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInputPreedit(window);
+    }
+
     if (window->callbacks.preedit)
     {
         _GRWLpreedit* preedit = &window->preedit;
+        _grwlBeginCallback();
         window->callbacks.preedit((GRWLwindow*)window, preedit->textCount, preedit->text, preedit->blockSizesCount,
                                   preedit->blockSizes, preedit->focusedBlockIndex, preedit->caretIndex);
+        _grwlEndCallback();
     }
 }
 
@@ -431,9 +488,16 @@ void _grwlInputPreedit(_GRWLwindow* window)
 //
 void _grwlInputIMEStatus(_GRWLwindow* window)
 {
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInput(_GRWL_RECORD_IME_STATUS, window->serial, nullptr, 0);
+    }
+
     if (window->callbacks.imestatus)
     {
+        _grwlBeginCallback();
         window->callbacks.imestatus((GRWLwindow*)window);
+        _grwlEndCallback();
     }
 }
 
@@ -444,8 +508,10 @@ void _grwlInputPreeditCandidate(_GRWLwindow* window)
     if (window->callbacks.preeditCandidate)
     {
         _GRWLpreedit* preedit = &window->preedit;
+        _grwlBeginCallback();
         window->callbacks.preeditCandidate((GRWLwindow*)window, preedit->candidateCount, preedit->candidateSelection,
                                            preedit->candidatePageStart, preedit->candidatePageSize);
+        _grwlEndCallback();
     }
 }
 
@@ -459,9 +525,24 @@ void _grwlInputScroll(_GRWLwindow* window, double xoffset, double yoffset)
     assert(yoffset > -FLT_MAX);
     assert(yoffset < FLT_MAX);
 
+    if (_grwl.record.recording)
+    {
+        const double data[] = { xoffset, yoffset };
+        _grwlRecordInput(_GRWL_RECORD_SCROLL, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_SCROLL, window);
+        queued->scroll.x = xoffset;
+        queued->scroll.y = yoffset;
+    }
+
     if (window->callbacks.scroll)
     {
+        _grwlBeginCallback();
         window->callbacks.scroll((GRWLwindow*)window, xoffset, yoffset);
+        _grwlEndCallback();
     }
 }
 
@@ -475,6 +556,12 @@ void _grwlInputMouseClick(_GRWLwindow* window, int button, int action, int mods)
     assert(action == GRWL_PRESS || action == GRWL_RELEASE);
     assert(mods == (mods & GRWL_MOD_MASK));
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { button, action, mods };
+        _grwlRecordInput(_GRWL_RECORD_MOUSE_CLICK, window->serial, data, sizeof(data));
+    }
+
     if (button < 0 || button > GRWL_MOUSE_BUTTON_LAST)
     {
         return;
@@ -494,9 +581,19 @@ void _grwlInputMouseClick(_GRWLwindow* window, int button, int action, int mods)
         window->mouseButtons[button] = (char)action;
     }
 
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_MOUSE_BUTTON, window);
+        queued->mouseButton.button = button;
+        queued->mouseButton.action = action;
+        queued->mouseButton.mods = mods;
+    }
+
     if (window->callbacks.mouseButton)
     {
+        _grwlBeginCallback();
         window->callbacks.mouseButton((GRWLwindow*)window, button, action, mods);
+        _grwlEndCallback();
     }
 }
 
@@ -516,12 +613,27 @@ void _grwlInputCursorPos(_GRWLwindow* window, double xpos, double ypos)
         return;
     }
 
+    if (_grwl.record.recording)
+    {
+        const double data[] = { xpos, ypos };
+        _grwlRecordInput(_GRWL_RECORD_CURSOR_POS, window->serial, data, sizeof(data));
+    }
+
     window->virtualCursorPosX = xpos;
     window->virtualCursorPosY = ypos;
 
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_CURSOR_POS, window);
+        queued->cursorPos.x = xpos;
+        queued->cursorPos.y = ypos;
+    }
+
     if (window->callbacks.cursorPos)
     {
+        _grwlBeginCallback();
         window->callbacks.cursorPos((GRWLwindow*)window, xpos, ypos);
+        _grwlEndCallback();
     }
 }
 
@@ -532,9 +644,23 @@ void _grwlInputCursorEnter(_GRWLwindow* window, bool entered)
     assert(window != nullptr);
     assert(entered == true || entered == false);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { entered };
+        _grwlRecordInput(_GRWL_RECORD_CURSOR_ENTER, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_CURSOR_ENTER, window);
+        queued->cursorEnter.entered = entered;
+    }
+
     if (window->callbacks.cursorEnter)
     {
+        _grwlBeginCallback();
         window->callbacks.cursorEnter((GRWLwindow*)window, entered);
+        _grwlEndCallback();
     }
 }
 
@@ -546,9 +672,48 @@ void _grwlInputDrop(_GRWLwindow* window, int count, const char** paths)
     assert(count > 0);
     assert(paths != nullptr);
 
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInputDrop(window, count, paths);
+    }
+
     if (window->callbacks.drop)
     {
+        _grwlBeginCallback();
         window->callbacks.drop((GRWLwindow*)window, count, paths);
+        _grwlEndCallback();
+    }
+}
+
+// Notifies shared code that a requested clipboard string has arrived, or that
+// the request failed if the string is nullptr
+//
+void _grwlInputClipboardString(const char* string)
+{
+    _GRWLclipboardrequest* requests = _grwl.clipboardRequests;
+    const int count = _grwl.clipboardRequestCount;
+    const size_t size = _grwl.clipboardRequestArraySize;
+
+    // Take the pending requests so that the callbacks can make new ones
+    _grwl.clipboardRequests = nullptr;
+    _grwl.clipboardRequestCount = 0;
+    _grwl.clipboardRequestArraySize = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        _grwlBeginCallback();
+        requests[i].callback(string, requests[i].user);
+        _grwlEndCallback();
+    }
+
+    if (_grwl.clipboardRequests)
+    {
+        _grwl_free(requests);
+    }
+    else
+    {
+        _grwl.clipboardRequests = requests;
+        _grwl.clipboardRequestArraySize = size;
     }
 }
 
@@ -567,7 +732,9 @@ void _grwlInputGamepad(_GRWLjoystick* js)
         const int jid = (int)(js - _grwl.joysticks);
         if (grwlGetGamepadState(jid, &state))
         {
+            _grwlBeginCallback();
             _grwl.callbacks.gamepad_state(jid, state.buttons, state.axes);
+            _grwlEndCallback();
         }
     }
 }
@@ -579,6 +746,12 @@ void _grwlInputJoystick(_GRWLjoystick* js, int event)
     assert(js != nullptr);
     assert(event == GRWL_CONNECTED || event == GRWL_DISCONNECTED);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { event };
+        _grwlRecordInput(_GRWL_RECORD_JOYSTICK, (unsigned int)(js - _grwl.joysticks), data, sizeof(data));
+    }
+
     if (event == GRWL_CONNECTED)
     {
         js->connected = true;
@@ -588,9 +761,18 @@ void _grwlInputJoystick(_GRWLjoystick* js, int event)
         js->connected = false;
     }
 
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_JOYSTICK, nullptr);
+        queued->joystick.jid = (int)(js - _grwl.joysticks);
+        queued->joystick.event = event;
+    }
+
     if (_grwl.callbacks.joystick)
     {
+        _grwlBeginCallback();
         _grwl.callbacks.joystick((int)(js - _grwl.joysticks), event);
+        _grwlEndCallback();
     }
 }
 
@@ -604,11 +786,31 @@ void _grwlInputJoystickAxis(_GRWLjoystick* js, int axis, float value)
 
     if (js->axes[axis] != value)
     {
+        if (_grwl.record.recording)
+        {
+            const struct
+            {
+                int axis;
+                float value;
+            } data = { axis, value };
+            _grwlRecordInput(_GRWL_RECORD_JOYSTICK_AXIS, (unsigned int)(js - _grwl.joysticks), &data, sizeof(data));
+        }
 
         js->axes[axis] = value;
+
+        if (_grwl.queue.events)
+        {
+            GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_JOYSTICK_AXIS, nullptr);
+            queued->joystickAxis.jid = (int)(js - _grwl.joysticks);
+            queued->joystickAxis.axis = axis;
+            queued->joystickAxis.value = value;
+        }
+
         if (_grwl.callbacks.joystick_axis)
         {
+            _grwlBeginCallback();
             _grwl.callbacks.joystick_axis((int)(js - _grwl.joysticks), axis, value);
+            _grwlEndCallback();
         }
     }
 }
@@ -624,10 +826,27 @@ void _grwlInputJoystickButton(_GRWLjoystick* js, int button, char value)
 
     if (js->buttons[button] != value)
     {
+        if (_grwl.record.recording)
+        {
+            const int data[] = { button, value };
+            _grwlRecordInput(_GRWL_RECORD_JOYSTICK_BUTTON, (unsigned int)(js - _grwl.joysticks), data, sizeof(data));
+        }
+
         js->buttons[button] = value;
+
+        if (_grwl.queue.events)
+        {
+            GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_JOYSTICK_BUTTON, nullptr);
+            queued->joystickButton.jid = (int)(js - _grwl.joysticks);
+            queued->joystickButton.button = button;
+            queued->joystickButton.action = value;
+        }
+
         if (_grwl.callbacks.joystick_button)
         {
+            _grwlBeginCallback();
             _grwl.callbacks.joystick_button((int)(js - _grwl.joysticks), button, value);
+            _grwlEndCallback();
         }
     }
 }
@@ -647,6 +866,12 @@ void _grwlInputJoystickHat(_GRWLjoystick* js, int hat, char value)
     assert((value & 0xf0) == 0);
     assert((value & ((value << 2) | (value >> 2))) == 0);
 
+    if (_grwl.record.recording && js->hats[hat] != value)
+    {
+        const int data[] = { hat, value };
+        _grwlRecordInput(_GRWL_RECORD_JOYSTICK_HAT, (unsigned int)(js - _grwl.joysticks), data, sizeof(data));
+    }
+
     base = js->buttonCount + hat * 4;
 
     js->buttons[base + 0] = (value & 0x01) ? GRWL_PRESS : GRWL_RELEASE;
@@ -657,9 +882,20 @@ void _grwlInputJoystickHat(_GRWLjoystick* js, int hat, char value)
     if (js->hats[hat] != value)
     {
         js->hats[hat] = value;
+
+        if (_grwl.queue.events)
+        {
+            GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_JOYSTICK_HAT, nullptr);
+            queued->joystickHat.jid = (int)(js - _grwl.joysticks);
+            queued->joystickHat.hat = hat;
+            queued->joystickHat.value = value;
+        }
+
         if (_grwl.callbacks.joystick_hat)
         {
+            _grwlBeginCallback();
             _grwl.callbacks.joystick_hat((int)(js - _grwl.joysticks), hat, value);
+            _grwlEndCallback();
         }
     }
 }
@@ -733,6 +969,14 @@ void _grwlCenterCursorInContentArea(_GRWLwindow* window)
     _grwl.platform.setCursorPos(window, width / 2.0, height / 2.0);
 }
 
+// Delivers the clipboard string with the next event processing, for platforms
+// where the clipboard can be read without waiting for another client
+//
+bool _grwlRequestClipboardStringDeferred()
+{
+    return grwlRunOnMainThread(deliverClipboardString, nullptr);
+}
+
 void _grwlPollAllJoysticks()
 {
     for (int jid = 0; jid <= GRWL_JOYSTICK_LAST; jid++)
@@ -744,6 +988,42 @@ void _grwlPollAllJoysticks()
     }
 }
 
+// Converts a 32-bit millisecond event timestamp to the timer domain
+// The timestamp is assumed to be from the same monotonic clock as the timer, as
+// is the case for X11 and Wayland on Linux, and is replaced by the current time
+// if it is implausibly old or from the future
+//
+uint64_t _grwlConvertEventTime(uint32_t time)
+{
+    const uint64_t now = _grwlPlatformGetTimerValue();
+    const uint64_t ticksPerMS = _grwlPlatformGetTimerFrequency() / 1000;
+    if (!ticksPerMS)
+    {
+        return now;
+    }
+
+    // The subtraction wraps along with the 32-bit timestamp
+    const uint32_t age = (uint32_t)(now / ticksPerMS) - time;
+    if (age > 10000 || age * ticksPerMS > now)
+    {
+        return now;
+    }
+
+    return now - age * ticksPerMS;
+}
+
+// Returns the time at which the event being processed was generated
+//
+uint64_t _grwlGetEventTime()
+{
+    if (_grwl.eventTime)
+    {
+        return _grwl.eventTime;
+    }
+
+    return _grwlPlatformGetTimerValue();
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                        GRWL public API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -754,6 +1034,7 @@ GRWLAPI int grwlGetInputMode(GRWLwindow* handle, int mode)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(0);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, 0);
 
     switch (mode)
     {
@@ -781,6 +1062,7 @@ GRWLAPI void grwlSetInputMode(GRWLwindow* handle, int mode, int value)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     switch (mode)
     {
@@ -944,6 +1226,7 @@ GRWLAPI int grwlGetKey(GRWLwindow* handle, int key)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(GRWL_RELEASE);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, GRWL_RELEASE);
 
     if (key < GRWL_KEY_SPACE || key > GRWL_KEY_LAST)
     {
@@ -967,6 +1250,7 @@ GRWLAPI int grwlGetMouseButton(GRWLwindow* handle, int button)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(GRWL_RELEASE);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, GRWL_RELEASE);
 
     if (button < GRWL_MOUSE_BUTTON_1 || button > GRWL_MOUSE_BUTTON_LAST)
     {
@@ -999,6 +1283,7 @@ GRWLAPI void grwlGetCursorPos(GRWLwindow* handle, double* xpos, double* ypos)
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->cursorMode == GRWL_CURSOR_DISABLED)
     {
@@ -1023,6 +1308,7 @@ GRWLAPI void grwlSetCursorPos(GRWLwindow* handle, double xpos, double ypos)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (xpos != xpos || xpos < -DBL_MAX || xpos > DBL_MAX || ypos != ypos || ypos < -DBL_MAX || ypos > DBL_MAX)
     {
@@ -1049,6 +1335,18 @@ GRWLAPI void grwlSetCursorPos(GRWLwindow* handle, double xpos, double ypos)
 }
 
 GRWLAPI GRWLcursor* grwlCreateCursor(const GRWLimage* image, int xhot, int yhot)
+{
+    assert(image != nullptr);
+
+    GRWLformattedimage formatted = {};
+    formatted.width = image->width;
+    formatted.height = image->height;
+    formatted.pixels = image->pixels;
+
+    return grwlCreateCursorFormatted(&formatted, xhot, yhot);
+}
+
+GRWLAPI GRWLcursor* grwlCreateCursorFormatted(const GRWLformattedimage* image, int xhot, int yhot)
 {
     _GRWLcursor* cursor;
 
@@ -1063,6 +1361,18 @@ GRWLAPI GRWLcursor* grwlCreateCursor(const GRWLimage* image, int xhot, int yhot)
         return nullptr;
     }
 
+    if (image->format < GRWL_IMAGE_RGBA || image->format > GRWL_IMAGE_BGRA_PREMULTIPLIED)
+    {
+        _grwlInputError(GRWL_INVALID_ENUM, "Invalid image format 0x%08X for cursor", image->format);
+        return nullptr;
+    }
+
+    if (image->stride != 0 && image->stride / 4 < image->width)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid image stride %i for cursor", image->stride);
+        return nullptr;
+    }
+
     cursor = (_GRWLcursor*)_grwl_calloc(1, sizeof(_GRWLcursor));
     cursor->next = _grwl.cursorListHead;
     _grwl.cursorListHead = cursor;
@@ -1117,8 +1427,9 @@ GRWLAPI void grwlDestroyCursor(GRWLcursor* handle)
 
     // Make sure the cursor is not being used by any window
     {
-        for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+        for (int i = 0; i < _grwl.windowCount; i++)
         {
+            _GRWLwindow* window = _grwl.windows[i];
             if (window->cursor == cursor)
             {
                 grwlSetCursor((GRWLwindow*)window, nullptr);
@@ -1150,6 +1461,7 @@ GRWLAPI void grwlSetCursor(GRWLwindow* windowHandle, GRWLcursor* cursorHandle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     window->cursor = cursor;
 
@@ -1159,6 +1471,28 @@ GRWLAPI void grwlSetCursor(GRWLwindow* windowHandle, GRWLcursor* cursorHandle)
 GRWLAPI void grwlGetPreeditCursorRectangle(GRWLwindow* handle, int* x, int* y, int* w, int* h)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+
+    if (x)
+    {
+        *x = 0;
+    }
+    if (y)
+    {
+        *y = 0;
+    }
+    if (w)
+    {
+        *w = 0;
+    }
+    if (h)
+    {
+        *h = 0;
+    }
+
+    _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
+
     _GRWLpreedit* preedit = &window->preedit;
     if (x)
     {
@@ -1181,6 +1515,11 @@ GRWLAPI void grwlGetPreeditCursorRectangle(GRWLwindow* handle, int* x, int* y, i
 GRWLAPI void grwlSetPreeditCursorRectangle(GRWLwindow* handle, int x, int y, int w, int h)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+
+    _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
+
     _GRWLpreedit* preedit = &window->preedit;
 
     if (x == preedit->cursorPosX && y == preedit->cursorPosY && w == preedit->cursorWidth && h == preedit->cursorHeight)
@@ -1199,15 +1538,29 @@ GRWLAPI void grwlSetPreeditCursorRectangle(GRWLwindow* handle, int x, int y, int
 GRWLAPI void grwlResetPreeditText(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+
+    _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.resetPreeditText(window);
 }
 
 GRWLAPI unsigned int* grwlGetPreeditCandidate(GRWLwindow* handle, int index, int* textCount)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
+    assert(window != nullptr);
+
+    if (textCount)
+    {
+        *textCount = 0;
+    }
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
+
     _GRWLpreedit* preedit = &window->preedit;
 
-    if (preedit->candidateCount <= index)
+    if (index < 0 || preedit->candidateCount <= index)
     {
         return nullptr;
     }
@@ -1226,6 +1579,7 @@ GRWLAPI GRWLkeyfun grwlSetKeyCallback(GRWLwindow* handle, GRWLkeyfun cbfun)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLkeyfun, window->callbacks.key, cbfun);
     return cbfun;
 }
@@ -1236,6 +1590,7 @@ GRWLAPI GRWLcharfun grwlSetCharCallback(GRWLwindow* handle, GRWLcharfun cbfun)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLcharfun, window->callbacks.character, cbfun);
     return cbfun;
 }
@@ -1246,6 +1601,7 @@ GRWLAPI GRWLcharmodsfun grwlSetCharModsCallback(GRWLwindow* handle, GRWLcharmods
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLcharmodsfun, window->callbacks.charmods, cbfun);
     return cbfun;
 }
@@ -1254,6 +1610,7 @@ GRWLAPI GRWLpreeditfun grwlSetPreeditCallback(GRWLwindow* handle, GRWLpreeditfun
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLpreeditfun, window->callbacks.preedit, cbfun);
     return cbfun;
 }
@@ -1262,6 +1619,7 @@ GRWLAPI GRWLimestatusfun grwlSetIMEStatusCallback(GRWLwindow* handle, GRWLimesta
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLimestatusfun, window->callbacks.imestatus, cbfun);
     return cbfun;
 }
@@ -1270,6 +1628,7 @@ GRWLAPI GRWLpreeditcandidatefun grwlSetPreeditCandidateCallback(GRWLwindow* hand
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLpreeditcandidatefun, window->callbacks.preeditCandidate, cbfun);
     return cbfun;
 }
@@ -1280,6 +1639,7 @@ GRWLAPI GRWLmousebuttonfun grwlSetMouseButtonCallback(GRWLwindow* handle, GRWLmo
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLmousebuttonfun, window->callbacks.mouseButton, cbfun);
     return cbfun;
 }
@@ -1290,6 +1650,7 @@ GRWLAPI GRWLcursorposfun grwlSetCursorPosCallback(GRWLwindow* handle, GRWLcursor
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLcursorposfun, window->callbacks.cursorPos, cbfun);
     return cbfun;
 }
@@ -1300,6 +1661,7 @@ GRWLAPI GRWLcursorenterfun grwlSetCursorEnterCallback(GRWLwindow* handle, GRWLcu
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLcursorenterfun, window->callbacks.cursorEnter, cbfun);
     return cbfun;
 }
@@ -1310,6 +1672,7 @@ GRWLAPI GRWLscrollfun grwlSetScrollCallback(GRWLwindow* handle, GRWLscrollfun cb
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLscrollfun, window->callbacks.scroll, cbfun);
     return cbfun;
 }
@@ -1320,6 +1683,7 @@ GRWLAPI GRWLdropfun grwlSetDropCallback(GRWLwindow* handle, GRWLdropfun cbfun)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLdropfun, window->callbacks.drop, cbfun);
     return cbfun;
 }
@@ -1874,6 +2238,71 @@ GRWLAPI const char* grwlGetClipboardString(GRWLwindow* handle)
     return _grwl.platform.getClipboardString();
 }
 
+GRWLAPI int grwlRequestClipboardString(GRWLclipboardfun callback, void* user)
+{
+    assert(callback != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+
+    _GRWLclipboardrequest* requests = (_GRWLclipboardrequest*)_grwlReserveBuffer(
+        _grwl.clipboardRequests, &_grwl.clipboardRequestArraySize,
+        (_grwl.clipboardRequestCount + 1) * sizeof(_GRWLclipboardrequest));
+    if (!requests)
+    {
+        return false;
+    }
+
+    _grwl.clipboardRequests = requests;
+
+    // Only the first pending request starts a transfer
+    if (_grwl.clipboardRequestCount == 0)
+    {
+        if (!_grwl.platform.requestClipboardString())
+        {
+            return false;
+        }
+    }
+
+    requests[_grwl.clipboardRequestCount].callback = callback;
+    requests[_grwl.clipboardRequestCount].user = user;
+    _grwl.clipboardRequestCount++;
+    return true;
+}
+
+GRWLAPI void grwlSetClipboardData(const char* mimeType, const void* data, size_t size)
+{
+    assert(mimeType != nullptr);
+    assert(data != nullptr || size == 0);
+
+    _GRWL_REQUIRE_INIT();
+
+    if (!strchr(mimeType, '/'))
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid MIME type %s", mimeType);
+        return;
+    }
+
+    _grwl.platform.setClipboardData(mimeType, data, size);
+}
+
+GRWLAPI const void* grwlGetClipboardData(const char* mimeType, size_t* size)
+{
+    assert(mimeType != nullptr);
+    assert(size != nullptr);
+
+    *size = 0;
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+
+    if (!strchr(mimeType, '/'))
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid MIME type %s", mimeType);
+        return nullptr;
+    }
+
+    return _grwl.platform.getClipboardData(mimeType, size);
+}
+
 GRWLAPI double grwlGetTime()
 {
     _GRWL_REQUIRE_INIT_OR_RETURN(0.0);
@@ -1899,6 +2328,12 @@ GRWLAPI uint64_t grwlGetTimerValue()
     return _grwlPlatformGetTimerValue();
 }
 
+GRWLAPI uint64_t grwlGetEventTime()
+{
+    _GRWL_REQUIRE_INIT_OR_RETURN(0);
+    return _grwlGetEventTime();
+}
+
 GRWLAPI uint64_t grwlGetTimerFrequency()
 {
     _GRWL_REQUIRE_INIT_OR_RETURN(0);
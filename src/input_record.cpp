@@ -0,0 +1,783 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <cstdlib>
+
+// The magic number identifying an input log, including the format version
+//
+static const char logMagic[8] = { 'G', 'R', 'W', 'L', 'I', 'N', 'P', '1' };
+
+// The initial size of the mapping of a new input log
+//
+#define _GRWL_RECORD_INITIAL_SIZE 65536
+
+// Input log file header
+//
+typedef struct _GRWLloghdr
+{
+    char magic[8];
+    uint64_t frequency;
+} _GRWLloghdr;
+
+// Input log record header, followed by a type specific payload
+//
+typedef struct _GRWLrecordhdr
+{
+    // Time since the start of the recording, in timer ticks
+    uint64_t time;
+    // Window serial or joystick ID the event applies to
+    uint32_t target;
+    uint16_t type;
+    // Payload size, or USHRT_MAX if the size follows the header as a uint32_t
+    uint16_t size;
+} _GRWLrecordhdr;
+
+// Appends a record to the input log, growing the mapping as needed
+//
+static void appendRecord(int type, unsigned int target, const void* first, size_t firstSize, const void* second,
+                         size_t secondSize, const void* third, size_t thirdSize)
+{
+    _GRWLmappedfile* file = &_grwl.record.file;
+    const size_t payloadSize = firstSize + secondSize + thirdSize;
+
+    if (payloadSize > UINT32_MAX)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Event of %zu bytes is too large to record", payloadSize);
+        return;
+    }
+
+    // Large payloads, like drops of many files, store their size after the header
+    const bool extended = payloadSize >= USHRT_MAX;
+    const size_t required =
+        _grwl.record.used + sizeof(_GRWLrecordhdr) + (extended ? sizeof(uint32_t) : 0) + payloadSize;
+
+    if (required > file->size)
+    {
+        size_t size = file->size;
+        while (size < required)
+        {
+            size *= 2;
+        }
+
+        if (!_grwlPlatformResizeMappedFile(file, size))
+        {
+            _grwl.record.recording = false;
+            _grwlPlatformCloseMappedFile(file);
+            return;
+        }
+    }
+
+    _GRWLrecordhdr header;
+    const uint64_t time = _grwlGetEventTime();
+    header.time = time > _grwl.record.start ? time - _grwl.record.start : 0;
+    header.target = target;
+    header.type = (uint16_t)type;
+    header.size = extended ? USHRT_MAX : (uint16_t)payloadSize;
+
+    unsigned char* dest = file->data + _grwl.record.used;
+    memcpy(dest, &header, sizeof(header));
+    dest += sizeof(header);
+
+    if (extended)
+    {
+        const uint32_t size = (uint32_t)payloadSize;
+        memcpy(dest, &size, sizeof(size));
+        dest += sizeof(size);
+    }
+
+    if (firstSize)
+    {
+        memcpy(dest, first, firstSize);
+        dest += firstSize;
+    }
+    if (secondSize)
+    {
+        memcpy(dest, second, secondSize);
+        dest += secondSize;
+    }
+    if (thirdSize)
+    {
+        memcpy(dest, third, thirdSize);
+    }
+
+    _grwl.record.used = required;
+}
+
+// Returns the live window with the specified serial, if any
+//
+static _GRWLwindow* findWindow(unsigned int serial)
+{
+    for (int i = 0; i < _grwl.windowCount; i++)
+    {
+        _GRWLwindow* window = _grwl.windows[i];
+        if (window->serial == serial)
+        {
+            return window;
+        }
+    }
+
+    return nullptr;
+}
+
+// Matches recorded window serials to live windows in order of creation
+//
+typedef struct _GRWLreplaymap
+{
+    unsigned int* recorded;
+    unsigned int* live;
+    int matched;
+    int count;
+} _GRWLreplaymap;
+
+static int compareSerials(const void* fp, const void* sp)
+{
+    const unsigned int fs = *(const unsigned int*)fp;
+    const unsigned int ss = *(const unsigned int*)sp;
+    return (fs > ss) - (fs < ss);
+}
+
+static bool initReplayMap(_GRWLreplaymap* map)
+{
+    memset(map, 0, sizeof(_GRWLreplaymap));
+
+    map->count = _grwl.windowCount;
+
+    if (!map->count)
+    {
+        return true;
+    }
+
+    // The serial arrays are kept between replays so that replaying does not
+    // allocate once the buffer fits the windows
+    unsigned int* serials = (unsigned int*)_grwlReserveBuffer(_grwl.record.serials, &_grwl.record.serialArraySize,
+                                                              map->count * 2 * sizeof(unsigned int));
+    if (!serials)
+    {
+        memset(map, 0, sizeof(_GRWLreplaymap));
+        return false;
+    }
+
+    _grwl.record.serials = serials;
+    map->recorded = serials;
+    map->live = serials + map->count;
+
+    for (int i = 0; i < _grwl.windowCount; i++)
+    {
+        map->live[i] = _grwl.windows[i]->serial;
+    }
+
+    qsort(map->live, map->count, sizeof(unsigned int), compareSerials);
+    return true;
+}
+
+static _GRWLwindow* mapWindow(_GRWLreplaymap* map, unsigned int serial)
+{
+    for (int i = 0; i < map->matched; i++)
+    {
+        if (map->recorded[i] == serial)
+        {
+            return findWindow(map->live[i]);
+        }
+    }
+
+    if (map->matched == map->count)
+    {
+        return nullptr;
+    }
+
+    map->recorded[map->matched] = serial;
+    return findWindow(map->live[map->matched++]);
+}
+
+// Replays the preedit text stored in a record
+//
+static void replayPreedit(_GRWLwindow* window, const unsigned char* payload, size_t size)
+{
+    _GRWLpreedit* preedit = &window->preedit;
+    int header[4];
+
+    if (size < sizeof(header))
+    {
+        return;
+    }
+
+    memcpy(header, payload, sizeof(header));
+
+    const int textCount = header[0];
+    const int blockSizesCount = header[1];
+
+    if (textCount < 0 || blockSizesCount < 0 ||
+        size != sizeof(header) + textCount * sizeof(unsigned int) + blockSizesCount * sizeof(int))
+    {
+        return;
+    }
+
+    if (preedit->textBufferCount < textCount + 1)
+    {
+        unsigned int* text = (unsigned int*)_grwl_realloc(preedit->text, sizeof(unsigned int) * (textCount + 1));
+        if (!text)
+        {
+            return;
+        }
+
+        preedit->text = text;
+        preedit->textBufferCount = textCount + 1;
+    }
+
+    if (preedit->blockSizesBufferCount < blockSizesCount)
+    {
+        int* blockSizes = (int*)_grwl_realloc(preedit->blockSizes, sizeof(int) * blockSizesCount);
+        if (!blockSizes)
+        {
+            return;
+        }
+
+        preedit->blockSizes = blockSizes;
+        preedit->blockSizesBufferCount = blockSizesCount;
+    }
+
+    payload += sizeof(header);
+    memcpy(preedit->text, payload, textCount * sizeof(unsigned int));
+    preedit->text[textCount] = 0;
+    payload += textCount * sizeof(unsigned int);
+    memcpy(preedit->blockSizes, payload, blockSizesCount * sizeof(int));
+
+    preedit->textCount = textCount;
+    preedit->blockSizesCount = blockSizesCount;
+    preedit->focusedBlockIndex = header[2];
+    preedit->caretIndex = header[3];
+
+    _grwlInputPreedit(window);
+}
+
+// Replays the dropped paths stored in a record
+//
+static void replayDrop(_GRWLwindow* window, const unsigned char* payload, size_t size)
+{
+    if (size == 0 || payload[size - 1] != '\0')
+    {
+        return;
+    }
+
+    int count = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (payload[i] == '\0')
+        {
+            count++;
+        }
+    }
+
+    const char** paths = (const char**)_grwlArenaAlloc(count * sizeof(char*));
+    if (!paths)
+    {
+        return;
+    }
+
+    const char* path = (const char*)payload;
+
+    for (int i = 0; i < count; i++)
+    {
+        paths[i] = path;
+        path += strlen(path) + 1;
+    }
+
+    _grwlInputDrop(window, count, paths);
+}
+
+// Replays a joystick record
+//
+static void replayJoystickEvent(int type, unsigned int jid, const unsigned char* payload, size_t size)
+{
+    if (jid > GRWL_JOYSTICK_LAST)
+    {
+        return;
+    }
+
+    _GRWLjoystick* js = _grwl.joysticks + jid;
+    if (!js->allocated)
+    {
+        return;
+    }
+
+    int data[2];
+    if (type == _GRWL_RECORD_JOYSTICK_AXIS)
+    {
+        float value;
+
+        if (size != sizeof(int) + sizeof(float))
+        {
+            return;
+        }
+
+        memcpy(data, payload, sizeof(int));
+        memcpy(&value, payload + sizeof(int), sizeof(float));
+
+        if (data[0] >= 0 && data[0] < js->axisCount)
+        {
+            _grwlInputJoystickAxis(js, data[0], value);
+        }
+
+        return;
+    }
+
+    if (type == _GRWL_RECORD_JOYSTICK)
+    {
+        if (size != sizeof(int))
+        {
+            return;
+        }
+
+        memcpy(data, payload, sizeof(int));
+
+        if (data[0] == GRWL_CONNECTED || data[0] == GRWL_DISCONNECTED)
+        {
+            _grwlInputJoystick(js, data[0]);
+        }
+
+        return;
+    }
+
+    if (size != sizeof(data))
+    {
+        return;
+    }
+
+    memcpy(data, payload, sizeof(data));
+
+    if (type == _GRWL_RECORD_JOYSTICK_BUTTON)
+    {
+        if (data[0] >= 0 && data[0] < js->buttonCount && (data[1] == GRWL_PRESS || data[1] == GRWL_RELEASE))
+        {
+            _grwlInputJoystickButton(js, data[0], (char)data[1]);
+        }
+    }
+    else if (type == _GRWL_RECORD_JOYSTICK_HAT)
+    {
+        if (data[0] >= 0 && data[0] < js->hatCount && (data[1] & 0xf0) == 0)
+        {
+            _grwlInputJoystickHat(js, data[0], (char)data[1]);
+        }
+    }
+}
+
+// Replays a window record
+//
+static void replayWindowEvent(int type, _GRWLwindow* window, const unsigned char* payload, size_t size)
+{
+    int ints[4];
+    double doubles[2];
+    float floats[2];
+
+    switch (type)
+    {
+        case _GRWL_RECORD_WINDOW_FOCUS:
+        case _GRWL_RECORD_WINDOW_ICONIFY:
+        case _GRWL_RECORD_WINDOW_MAXIMIZE:
+        case _GRWL_RECORD_CURSOR_ENTER:
+        {
+            if (size != sizeof(int))
+            {
+                return;
+            }
+
+            memcpy(ints, payload, sizeof(int));
+            const bool value = ints[0] ? true : false;
+
+            if (type == _GRWL_RECORD_WINDOW_FOCUS)
+            {
+                _grwlInputWindowFocus(window, value);
+            }
+            else if (type == _GRWL_RECORD_WINDOW_ICONIFY)
+            {
+                _grwlInputWindowIconify(window, value);
+            }
+            else if (type == _GRWL_RECORD_WINDOW_MAXIMIZE)
+            {
+                _grwlInputWindowMaximize(window, value);
+            }
+            else
+            {
+                _grwlInputCursorEnter(window, value);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_WINDOW_POS:
+        case _GRWL_RECORD_WINDOW_SIZE:
+        case _GRWL_RECORD_FRAMEBUFFER_SIZE:
+        {
+            if (size != sizeof(int) * 2)
+            {
+                return;
+            }
+
+            memcpy(ints, payload, sizeof(int) * 2);
+
+            if (type == _GRWL_RECORD_WINDOW_POS)
+            {
+                _grwlInputWindowPos(window, ints[0], ints[1]);
+            }
+            else if (ints[0] >= 0 && ints[1] >= 0)
+            {
+                if (type == _GRWL_RECORD_WINDOW_SIZE)
+                {
+                    _grwlInputWindowSize(window, ints[0], ints[1]);
+                }
+                else
+                {
+                    _grwlInputFramebufferSize(window, ints[0], ints[1]);
+                }
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_WINDOW_CONTENT_SCALE:
+        {
+            if (size != sizeof(floats))
+            {
+                return;
+            }
+
+            memcpy(floats, payload, sizeof(floats));
+
+            if (floats[0] > 0.f && floats[1] > 0.f)
+            {
+                _grwlInputWindowContentScale(window, floats[0], floats[1]);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_WINDOW_DAMAGE:
+            _grwlInputWindowDamage(window);
+            return;
+
+        case _GRWL_RECORD_WINDOW_CLOSE_REQUEST:
+            _grwlInputWindowCloseRequest(window);
+            return;
+
+        case _GRWL_RECORD_KEY:
+        {
+            if (size != sizeof(int) * 4)
+            {
+                return;
+            }
+
+            memcpy(ints, payload, sizeof(int) * 4);
+
+            if ((ints[0] == GRWL_KEY_UNKNOWN || (ints[0] >= 0 && ints[0] <= GRWL_KEY_LAST)) &&
+                (ints[2] == GRWL_PRESS || ints[2] == GRWL_RELEASE) && ints[3] == (ints[3] & GRWL_MOD_MASK))
+            {
+                _grwlInputKey(window, ints[0], ints[1], ints[2], ints[3]);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_CHAR:
+        {
+            if (size != sizeof(int) * 3)
+            {
+                return;
+            }
+
+            memcpy(ints, payload, sizeof(int) * 3);
+
+            if (ints[1] == (ints[1] & GRWL_MOD_MASK))
+            {
+                _grwlInputChar(window, (uint32_t)ints[0], ints[1], ints[2] ? true : false);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_PREEDIT:
+            replayPreedit(window, payload, size);
+            return;
+
+        case _GRWL_RECORD_IME_STATUS:
+            _grwlInputIMEStatus(window);
+            return;
+
+        case _GRWL_RECORD_SCROLL:
+        case _GRWL_RECORD_CURSOR_POS:
+        {
+            if (size != sizeof(doubles))
+            {
+                return;
+            }
+
+            memcpy(doubles, payload, sizeof(doubles));
+
+            if (type == _GRWL_RECORD_SCROLL)
+            {
+                _grwlInputScroll(window, doubles[0], doubles[1]);
+            }
+            else
+            {
+                _grwlInputCursorPos(window, doubles[0], doubles[1]);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_MOUSE_CLICK:
+        {
+            if (size != sizeof(int) * 3)
+            {
+                return;
+            }
+
+            memcpy(ints, payload, sizeof(int) * 3);
+
+            if (ints[0] >= 0 && ints[0] <= GRWL_MOUSE_BUTTON_LAST && (ints[1] == GRWL_PRESS || ints[1] == GRWL_RELEASE) &&
+                ints[2] == (ints[2] & GRWL_MOD_MASK))
+            {
+                _grwlInputMouseClick(window, ints[0], ints[1], ints[2]);
+            }
+
+            return;
+        }
+
+        case _GRWL_RECORD_DROP:
+            replayDrop(window, payload, size);
+            return;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Appends an event with a fixed size payload to the input log
+//
+void _grwlRecordInput(int type, unsigned int target, const void* data, size_t size)
+{
+    appendRecord(type, target, data, size, nullptr, 0, nullptr, 0);
+}
+
+// Appends a preedit event to the input log
+//
+void _grwlRecordInputPreedit(_GRWLwindow* window)
+{
+    const _GRWLpreedit* preedit = &window->preedit;
+    const int header[4] = { preedit->textCount, preedit->blockSizesCount, preedit->focusedBlockIndex,
+                            preedit->caretIndex };
+
+    appendRecord(_GRWL_RECORD_PREEDIT, window->serial, header, sizeof(header), preedit->text,
+                 preedit->textCount * sizeof(unsigned int), preedit->blockSizes,
+                 preedit->blockSizesCount * sizeof(int));
+}
+
+// Appends a drop event to the input log
+//
+void _grwlRecordInputDrop(_GRWLwindow* window, int count, const char** paths)
+{
+    size_t size = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        size += strlen(paths[i]) + 1;
+    }
+
+    char* buffer = (char*)_grwl_calloc(size ? size : 1, 1);
+    if (!buffer)
+    {
+        return;
+    }
+
+    char* target = buffer;
+
+    for (int i = 0; i < count; i++)
+    {
+        const size_t length = strlen(paths[i]) + 1;
+        memcpy(target, paths[i], length);
+        target += length;
+    }
+
+    appendRecord(_GRWL_RECORD_DROP, window->serial, buffer, size, nullptr, 0, nullptr, 0);
+    _grwl_free(buffer);
+}
+
+// Finishes any active input recording
+//
+void _grwlStopInputRecording()
+{
+    if (!_grwl.record.recording)
+    {
+        return;
+    }
+
+    _grwl.record.recording = false;
+
+    // Trim the log to the recorded events
+    _grwlPlatformResizeMappedFile(&_grwl.record.file, _grwl.record.used);
+    _grwlPlatformCloseMappedFile(&_grwl.record.file);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GRWL public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GRWLAPI int grwlStartInputRecording(const char* path)
+{
+    assert(path != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+
+    _grwlStopInputRecording();
+
+    if (!_grwlPlatformCreateMappedFile(&_grwl.record.file, path, _GRWL_RECORD_INITIAL_SIZE))
+    {
+        return false;
+    }
+
+    _GRWLloghdr header;
+    memcpy(header.magic, logMagic, sizeof(logMagic));
+    header.frequency = _grwlPlatformGetTimerFrequency();
+    memcpy(_grwl.record.file.data, &header, sizeof(header));
+
+    _grwl.record.used = sizeof(header);
+    _grwl.record.start = _grwlPlatformGetTimerValue();
+    _grwl.record.recording = true;
+    return true;
+}
+
+GRWLAPI void grwlStopInputRecording()
+{
+    _GRWL_REQUIRE_INIT();
+    _grwlStopInputRecording();
+}
+
+GRWLAPI int grwlReplayInput(const char* path, double speed)
+{
+    assert(path != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(-1);
+
+    if (speed < 0.0 || speed != speed)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid replay speed %f", speed);
+        return -1;
+    }
+
+    _GRWLmappedfile file;
+    memset(&file, 0, sizeof(file));
+
+    if (!_grwlPlatformOpenMappedFile(&file, path))
+    {
+        return -1;
+    }
+
+    _GRWLloghdr header;
+    if (file.size < sizeof(header))
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid input log %s", path);
+        _grwlPlatformCloseMappedFile(&file);
+        return -1;
+    }
+
+    memcpy(&header, file.data, sizeof(header));
+    if (memcmp(header.magic, logMagic, sizeof(logMagic)) != 0 || header.frequency == 0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid input log %s", path);
+        _grwlPlatformCloseMappedFile(&file);
+        return -1;
+    }
+
+    _GRWLreplaymap map;
+    if (!initReplayMap(&map))
+    {
+        _grwlPlatformCloseMappedFile(&file);
+        return -1;
+    }
+
+    const uint64_t start = _grwlPlatformGetTimerValue();
+    const double frequency = (double)_grwlPlatformGetTimerFrequency();
+    size_t offset = sizeof(header);
+    int count = 0;
+
+    while (offset + sizeof(_GRWLrecordhdr) <= file.size)
+    {
+        _GRWLrecordhdr record;
+        memcpy(&record, file.data + offset, sizeof(record));
+
+        offset += sizeof(record);
+
+        size_t size = record.size;
+        if (record.size == USHRT_MAX)
+        {
+            uint32_t extendedSize;
+            if (file.size - offset < sizeof(extendedSize))
+            {
+                break;
+            }
+
+            memcpy(&extendedSize, file.data + offset, sizeof(extendedSize));
+            offset += sizeof(extendedSize);
+            size = extendedSize;
+        }
+
+        if (file.size - offset < size)
+        {
+            break;
+        }
+
+        const unsigned char* payload = file.data + offset;
+        offset += size;
+
+        if (speed > 0.0)
+        {
+            const double due = (double)record.time / (double)header.frequency / speed;
+
+            for (;;)
+            {
+                const double elapsed = (double)(_grwlPlatformGetTimerValue() - start) / frequency;
+                if (elapsed >= due)
+                {
+                    break;
+                }
+
+                _grwl.platform.waitEventsTimeout(due - elapsed);
+            }
+
+            _grwl.eventTime = start + (uint64_t)(due * frequency);
+        }
+
+        if (record.type == _GRWL_RECORD_KEYBOARD_LAYOUT)
+        {
+            _grwlInputKeyboardLayout();
+        }
+        else if (record.type >= _GRWL_RECORD_JOYSTICK && record.type <= _GRWL_RECORD_JOYSTICK_HAT)
+        {
+            replayJoystickEvent(record.type, record.target, payload, size);
+        }
+        else
+        {
+            _GRWLwindow* window = mapWindow(&map, record.target);
+            if (!window)
+            {
+                _grwl.eventTime = 0;
+                continue;
+            }
+
+            replayWindowEvent(record.type, window, payload, size);
+        }
+
+        _grwl.eventTime = 0;
+        count++;
+    }
+
+    _grwlPlatformCloseMappedFile(&file);
+    return count;
+}
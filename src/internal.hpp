@@ -28,6 +28,48 @@
 #define _GRWL_POLL_ALL (_GRWL_POLL_AXES | _GRWL_POLL_BUTTONS)
 
 #define _GRWL_MESSAGE_SIZE 1024
+// The number of arguments an error may record for formatting its description
+// when it is requested
+#define _GRWL_ERROR_ARG_COUNT 8
+
+#define GRWL_MOD_MASK \
+    (GRWL_MOD_SHIFT | GRWL_MOD_CONTROL | GRWL_MOD_ALT | GRWL_MOD_SUPER | GRWL_MOD_CAPS_LOCK | GRWL_MOD_NUM_LOCK)
+
+// The public image formats are combinations of the first two of these bits
+#define _GRWL_IMAGE_BLUE_FIRST 1
+#define _GRWL_IMAGE_PREMULTIPLIED 2
+#define _GRWL_IMAGE_ALPHA_FIRST 4
+
+// The image format of native-endian 32-bit ARGB values
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define _GRWL_IMAGE_ARGB32 _GRWL_IMAGE_ALPHA_FIRST
+#else
+    #define _GRWL_IMAGE_ARGB32 GRWL_IMAGE_BGRA
+#endif
+
+#define _GRWL_RECORD_WINDOW_FOCUS 1
+#define _GRWL_RECORD_WINDOW_POS 2
+#define _GRWL_RECORD_WINDOW_SIZE 3
+#define _GRWL_RECORD_FRAMEBUFFER_SIZE 4
+#define _GRWL_RECORD_WINDOW_CONTENT_SCALE 5
+#define _GRWL_RECORD_WINDOW_ICONIFY 6
+#define _GRWL_RECORD_WINDOW_MAXIMIZE 7
+#define _GRWL_RECORD_WINDOW_DAMAGE 8
+#define _GRWL_RECORD_WINDOW_CLOSE_REQUEST 9
+#define _GRWL_RECORD_KEYBOARD_LAYOUT 10
+#define _GRWL_RECORD_KEY 11
+#define _GRWL_RECORD_CHAR 12
+#define _GRWL_RECORD_PREEDIT 13
+#define _GRWL_RECORD_IME_STATUS 14
+#define _GRWL_RECORD_SCROLL 15
+#define _GRWL_RECORD_MOUSE_CLICK 16
+#define _GRWL_RECORD_CURSOR_POS 17
+#define _GRWL_RECORD_CURSOR_ENTER 18
+#define _GRWL_RECORD_DROP 19
+#define _GRWL_RECORD_JOYSTICK 20
+#define _GRWL_RECORD_JOYSTICK_AXIS 21
+#define _GRWL_RECORD_JOYSTICK_BUTTON 22
+#define _GRWL_RECORD_JOYSTICK_HAT 23
 
 typedef void (*GRWLproc)();
 
@@ -36,20 +78,33 @@ typedef struct _GRWLinitconfig _GRWLinitconfig;
 typedef struct _GRWLwndconfig _GRWLwndconfig;
 typedef struct _GRWLctxconfig _GRWLctxconfig;
 typedef struct _GRWLfbconfig _GRWLfbconfig;
+typedef struct _GRWLfbchoice _GRWLfbchoice;
+typedef struct _GRWLfbconfigcache _GRWLfbconfigcache;
+typedef struct _GRWLnameentry _GRWLnameentry;
+typedef struct _GRWLnametable _GRWLnametable;
 typedef struct _GRWLcontext _GRWLcontext;
 typedef struct _GRWLpreedit _GRWLpreedit;
 typedef struct _GRWLpreeditcandidate _GRWLpreeditcandidate;
 typedef struct _GRWLwindow _GRWLwindow;
+typedef struct _GRWLwindowblock _GRWLwindowblock;
 typedef struct _GRWLplatform _GRWLplatform;
 typedef struct _GRWLlibrary _GRWLlibrary;
 typedef struct _GRWLmonitor _GRWLmonitor;
 typedef struct _GRWLcursor _GRWLcursor;
+typedef struct _GRWLclipboardrequest _GRWLclipboardrequest;
 typedef struct _GRWLmapelement _GRWLmapelement;
 typedef struct _GRWLmapping _GRWLmapping;
 typedef struct _GRWLusbinfo _GRWLusbinfo;
 typedef struct _GRWLjoystick _GRWLjoystick;
 typedef struct _GRWLtls _GRWLtls;
 typedef struct _GRWLmutex _GRWLmutex;
+typedef struct _GRWLthread _GRWLthread;
+typedef struct _GRWLcondition _GRWLcondition;
+typedef struct _GRWLcontextpool _GRWLcontextpool;
+typedef struct _GRWLcontextjob _GRWLcontextjob;
+typedef struct _GRWLcontextworker _GRWLcontextworker;
+typedef struct _GRWLworkerpool _GRWLworkerpool;
+typedef struct _GRWLmappedfile _GRWLmappedfile;
 typedef struct _GRWLusercontext _GRWLusercontext;
 
 #define GL_VERSION 0x1f02
@@ -70,6 +125,7 @@ typedef struct _GRWLusercontext _GRWLusercontext;
 #define GL_CONTEXT_RELEASE_BEHAVIOR 0x82fb
 #define GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH 0x82fc
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
 
 typedef int GLint;
 typedef unsigned int GLuint;
@@ -81,6 +137,9 @@ typedef void(APIENTRY* PFNGLCLEARPROC)(GLbitfield);
 typedef const GLubyte*(APIENTRY* PFNGLGETSTRINGPROC)(GLenum);
 typedef void(APIENTRY* PFNGLGETINTEGERVPROC)(GLenum, GLint*);
 typedef const GLubyte*(APIENTRY* PFNGLGETSTRINGIPROC)(GLenum, GLuint);
+typedef void(APIENTRY* PFNGLFLUSHPROC)();
+typedef void(APIENTRY* PFNGLFINISHPROC)();
+typedef void*(APIENTRY* PFNGLFENCESYNCPROC)(GLenum, GLbitfield);
 
 #if defined(_GRWL_WIN32)
     #define EGLAPIENTRY __stdcall
@@ -154,6 +213,8 @@ typedef const GLubyte*(APIENTRY* PFNGLGETSTRINGIPROC)(GLenum, GLuint);
 #define EGL_CONTEXT_RELEASE_BEHAVIOR_FLUSH_KHR 0x2098
 #define EGL_PLATFORM_X11_EXT 0x31d5
 #define EGL_PLATFORM_WAYLAND_EXT 0x31d8
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31dd
+#define EGL_PLATFORM_DEVICE_EXT 0x313f
 #define EGL_PRESENT_OPAQUE_EXT 0x31df
 #define EGL_PLATFORM_ANGLE_ANGLE 0x3202
 #define EGL_PLATFORM_ANGLE_TYPE_ANGLE 0x3203
@@ -215,8 +276,10 @@ typedef EGLBoolean(EGLAPIENTRY* PFN_eglChooseConfig)(EGLDisplay, EGLint const*,
 #define eglChooseConfig _grwl.egl.ChooseConfig
 
 typedef EGLDisplay(EGLAPIENTRY* PFNEGLGETPLATFORMDISPLAYEXTPROC)(EGLenum, void*, const EGLint*);
+typedef EGLBoolean(EGLAPIENTRY* PFNEGLQUERYDEVICESEXTPROC)(EGLint, void**, EGLint*);
 typedef EGLSurface(EGLAPIENTRY* PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC)(EGLDisplay, EGLConfig, void*, const EGLint*);
 #define eglGetPlatformDisplayEXT _grwl.egl.GetPlatformDisplayEXT
+#define eglQueryDevicesEXT _grwl.egl.QueryDevicesEXT
 #define eglCreatePlatformWindowSurfaceEXT _grwl.egl.CreatePlatformWindowSurfaceEXT
 
 #define VK_NULL_HANDLE 0
@@ -235,6 +298,7 @@ typedef enum VkStructureType
     VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR = 1000009000,
     VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK = 1000123000,
     VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT = 1000217000,
+    VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT = 1000256000,
     VK_STRUCTURE_TYPE_MAX_ENUM = 0x7FFFFFFF
 } VkStructureType;
 
@@ -280,6 +344,22 @@ typedef PFN_vkVoidFunction(APIENTRY* PFN_vkGetInstanceProcAddr)(VkInstance, cons
 typedef VkResult(APIENTRY* PFN_vkEnumerateInstanceExtensionProperties)(const char*, uint32_t*, VkExtensionProperties*);
 #define vkGetInstanceProcAddr _grwl.vk.GetInstanceProcAddr
 
+// The framebuffer configs of a context creation API, translated once, and the
+// configs chosen from them for each set of framebuffer hints
+// This is defined before the platform headers, as their context state has one
+//
+struct _GRWLfbconfigcache
+{
+    // Every usable native config, with transparency set where supported
+    _GRWLfbconfig* configs;
+    // API-specific bits of each config that are filtered on for each choice
+    int* flags;
+    int count;
+    _GRWLfbchoice* choices;
+    int choiceCount;
+    size_t choiceArraySize;
+};
+
 #include "platform.hpp"
 
 // Checks for whether the library has been initialized
@@ -296,6 +376,20 @@ typedef VkResult(APIENTRY* PFN_vkEnumerateInstanceExtensionProperties)(const cha
         return x;                                       \
     }
 
+// Checks that a window handle refers to a window that has not been destroyed
+#define _GRWL_REQUIRE_WINDOW(window)                                                    \
+    if (!_grwlIsWindowAlive(window))                                                    \
+    {                                                                                   \
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid window handle %p", (void*)window); \
+        return;                                                                         \
+    }
+#define _GRWL_REQUIRE_WINDOW_OR_RETURN(window, x)                                       \
+    if (!_grwlIsWindowAlive(window))                                                    \
+    {                                                                                   \
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid window handle %p", (void*)window); \
+        return x;                                                                       \
+    }
+
 // Swaps the provided pointers
 #define _GRWL_SWAP(type, x, y) \
     {                          \
@@ -305,13 +399,55 @@ typedef VkResult(APIENTRY* PFN_vkEnumerateInstanceExtensionProperties)(const cha
         y = t;                 \
     }
 
+// Records a trace zone spanning the rest of the enclosing scope
+#if defined(_GRWL_BUILD_TRACING)
+    #define _GRWL_TRACE_ZONE(name) _GRWLtracezone _grwlTraceZone(name)
+#else
+    #define _GRWL_TRACE_ZONE(name)
+#endif
+
+// Trace zone, recorded into the trace buffer of the calling thread when it
+// goes out of scope
+//
+struct _GRWLtracezone
+{
+    const char* name;
+    uint64_t start;
+
+    _GRWLtracezone(const char* name);
+    ~_GRWLtracezone();
+};
+
+// An argument recorded for formatting an error description
+//
+typedef struct _GRWLerrorarg
+{
+    int type;
+    union
+    {
+        uintmax_t integer;
+        double real;
+        long double longReal;
+        const void* pointer;
+    };
+} _GRWLerrorarg;
+
 // Per-thread error structure
+// The description is only formatted once it is requested, from the format and
+// the arguments recorded when the error occurred
 //
 struct _GRWLerror
 {
-    _GRWLerror* next;
     int code;
-    char description[_GRWL_MESSAGE_SIZE];
+    // The format of the description not yet formatted, or nullptr
+    const char* format;
+    const char* description;
+    _GRWLerrorarg args[_GRWL_ERROR_ARG_COUNT];
+    int argCount;
+    // Copies of the string arguments, as they may not outlive the call
+    char strings[_GRWL_MESSAGE_SIZE];
+    size_t stringSize;
+    char buffer[_GRWL_MESSAGE_SIZE];
 };
 
 // Initialization configuration
@@ -324,6 +460,8 @@ struct _GRWLinitconfig
     int angleType;
     int platformID;
     bool managePreeditCandidate;
+    int eventQueueCapacity;
+    bool inputThread;
     PFN_vkGetInstanceProcAddr vulkanLoader;
 
     struct
@@ -342,6 +480,11 @@ struct _GRWLinitconfig
     {
         int libdecorMode;
     } wl;
+
+    struct
+    {
+        int monitorCount;
+    } null;
 };
 
 // Window configuration
@@ -449,6 +592,40 @@ struct _GRWLfbconfig
     uintptr_t handle;
 };
 
+// A native framebuffer config chosen for a set of framebuffer hints
+//
+struct _GRWLfbchoice
+{
+    _GRWLfbconfig desired;
+    // Any other value the choice depended on, like the client API
+    int key;
+    uintptr_t handle;
+};
+
+// A name and its value in a name table
+//
+struct _GRWLnameentry
+{
+    uint64_t hash;
+    // Offset of the name in the string buffer of the table plus one, or zero
+    // if the slot is empty
+    size_t name;
+    uintptr_t value;
+};
+
+// Open addressing hash table of names, used for per-context lookups
+//
+struct _GRWLnametable
+{
+    _GRWLnameentry* entries;
+    // The number of slots, zero or a power of two
+    size_t size;
+    size_t count;
+    char* strings;
+    size_t stringsLength;
+    size_t stringsArraySize;
+};
+
 // Context structure
 //
 struct _GRWLcontext
@@ -472,12 +649,20 @@ struct _GRWLcontext
     GRWLglproc (*getProcAddress)(const char*);
     void (*destroy)(_GRWLwindow*);
 
+    // Client API extensions, and the platform extensions looked up so far
+    _GRWLnametable extensions;
+    // Entry points looked up so far, including those that were not found
+    _GRWLnametable procs;
+
     struct
     {
         EGLConfig config;
         EGLContext handle;
         EGLSurface surface;
         void* client;
+        // Whether the surface is a pbuffer standing in for a native window
+        bool offscreen;
+        EGLint colorspace;
     } egl;
 
     // This is defined in platform.h
@@ -540,7 +725,14 @@ struct _GRWLusercontext
 //
 struct _GRWLwindow
 {
-    struct _GRWLwindow* next;
+    // Position in the window array while the window exists
+    int index;
+    // Odd while the window exists, incremented when it is created and destroyed
+    unsigned int generation;
+    // Next free window slot while the window does not exist
+    struct _GRWLwindow* nextFree;
+    // Creation order, used to match recorded input to windows during replay
+    unsigned int serial;
 
     // Window settings and state
     bool resizable;
@@ -571,6 +763,8 @@ struct _GRWLwindow
     bool rawMouseMotion;
 
     _GRWLcontext context;
+    // The context worker threads, or nullptr if none were started
+    _GRWLworkerpool* workerPool;
 
     _GRWLpreedit preedit;
 
@@ -602,6 +796,14 @@ struct _GRWLwindow
     GRWL_PLATFORM_WINDOW_STATE
 };
 
+// Block of window slots
+//
+struct _GRWLwindowblock
+{
+    _GRWLwindowblock* next;
+    _GRWLwindow windows[16];
+};
+
 // Monitor structure
 //
 struct _GRWLmonitor
@@ -632,6 +834,14 @@ struct _GRWLcursor
     GRWL_PLATFORM_CURSOR_STATE
 };
 
+// Pending clipboard string request
+//
+struct _GRWLclipboardrequest
+{
+    GRWLclipboardfun callback;
+    void* user;
+};
+
 // Gamepad mapping element structure
 //
 struct _GRWLmapelement
@@ -700,6 +910,109 @@ struct _GRWLmutex
     GRWL_PLATFORM_MUTEX_STATE
 };
 
+// Called on a thread created with _grwlPlatformCreateThread
+typedef void (*_GRWLthreadfun)(void* user);
+
+// Thread structure
+//
+struct _GRWLthread
+{
+    _GRWLthreadfun function;
+    void* user;
+
+    // This is defined in platform.h
+    GRWL_PLATFORM_THREAD_STATE
+};
+
+// Condition variable structure
+//
+struct _GRWLcondition
+{
+    // This is defined in platform.h
+    GRWL_PLATFORM_CONDITION_STATE
+};
+
+// Contexts created ahead of time on a background thread for new windows
+// The handles and the native config are those of the context API that
+// initialized the pool
+//
+struct _GRWLcontextpool
+{
+    // The context hints the pool was created for, without a share window
+    _GRWLctxconfig ctxconfig;
+    uintptr_t config;
+    // The first context created, shared by every other pooled context
+    uintptr_t root;
+    uintptr_t* contexts;
+    int count;
+    size_t arraySize;
+    // The number of contexts to keep ready
+    int target;
+    bool running;
+    bool stopping;
+    // Protects contexts, count, target, running and stopping
+    _GRWLmutex mutex;
+    _GRWLthread thread;
+
+    bool (*create)(uintptr_t config, const _GRWLctxconfig* ctxconfig, uintptr_t share, uintptr_t* context);
+    void (*destroy)(uintptr_t context);
+};
+
+// A job submitted with grwlSubmitContextJob
+//
+struct _GRWLcontextjob
+{
+    GRWLcontextjobfun function;
+    GRWLcontextjobdonefun done;
+    void* user;
+    // The fence created after the job ran, or nullptr
+    void* sync;
+    _GRWLcontextjob* next;
+};
+
+// A context worker thread and the user context current on it
+//
+struct _GRWLcontextworker
+{
+    _GRWLworkerpool* pool;
+    _GRWLusercontext* context;
+    _GRWLthread thread;
+};
+
+// The context worker threads of a window
+//
+struct _GRWLworkerpool
+{
+    _GRWLwindow* window;
+    _GRWLcontextworker* workers;
+    int workerCount;
+    // Whether the context supports sync objects
+    bool sync;
+    bool stopping;
+    // Jobs waiting for a worker and jobs waiting for their completion
+    // callback, oldest first
+    _GRWLcontextjob* pendingHead;
+    _GRWLcontextjob* pendingTail;
+    _GRWLcontextjob* completedHead;
+    _GRWLcontextjob* completedTail;
+    // Protects the job lists and stopping
+    _GRWLmutex mutex;
+    // Signaled when a job is submitted or the workers are stopped
+    _GRWLcondition condition;
+};
+
+// Memory-mapped file structure
+//
+struct _GRWLmappedfile
+{
+    unsigned char* data;
+    size_t size;
+    bool writable;
+
+    // This is defined in platform.h
+    GRWL_PLATFORM_MAPPED_FILE_STATE
+};
+
 // Platform API structure
 //
 struct _GRWLplatform
@@ -714,7 +1027,7 @@ struct _GRWLplatform
     void (*setCursorMode)(_GRWLwindow*, int);
     void (*setRawMouseMotion)(_GRWLwindow*, bool);
     bool (*rawMouseMotionSupported)();
-    bool (*createCursor)(_GRWLcursor*, const GRWLimage*, int, int);
+    bool (*createCursor)(_GRWLcursor*, const GRWLformattedimage*, int, int);
     bool (*createStandardCursor)(_GRWLcursor*, int);
     void (*destroyCursor)(_GRWLcursor*);
     void (*setCursor)(_GRWLwindow*, _GRWLcursor*);
@@ -723,6 +1036,9 @@ struct _GRWLplatform
     const char* (*getKeyboardLayoutName)();
     void (*setClipboardString)(const char*);
     const char* (*getClipboardString)();
+    bool (*requestClipboardString)();
+    void (*setClipboardData)(const char*, const void*, size_t);
+    const void* (*getClipboardData)(const char*, size_t*);
     void (*updatePreeditCursorRectangle)(_GRWLwindow*);
     void (*resetPreeditText)(_GRWLwindow*);
     void (*setIMEStatus)(_GRWLwindow*, int);
@@ -743,7 +1059,7 @@ struct _GRWLplatform
     bool (*createWindow)(_GRWLwindow*, const _GRWLwndconfig*, const _GRWLctxconfig*, const _GRWLfbconfig*);
     void (*destroyWindow)(_GRWLwindow*);
     void (*setWindowTitle)(_GRWLwindow*, const char*);
-    void (*setWindowIcon)(_GRWLwindow*, int, const GRWLimage*);
+    void (*setWindowIcon)(_GRWLwindow*, int, const GRWLformattedimage*);
     void (*setWindowProgressIndicator)(_GRWLwindow*, const int, double);
     void (*setWindowBadge)(_GRWLwindow*, int);
     void (*setWindowBadgeString)(_GRWLwindow*, const char* string);
@@ -809,22 +1125,83 @@ struct _GRWLlibrary
         int refreshRate;
     } hints;
 
-    _GRWLerror* errorListHead;
     _GRWLcursor* cursorListHead;
-    _GRWLwindow* windowListHead;
+
+    // All existing windows, in no particular order
+    _GRWLwindow** windows;
+    int windowCount;
+    size_t windowArraySize;
+    // Window slots are only freed at termination so that the handles of
+    // destroyed windows can be detected, and are reused oldest first
+    _GRWLwindowblock* windowBlockHead;
+    _GRWLwindow* freeWindowHead;
+    _GRWLwindow* freeWindowTail;
 
     _GRWLmonitor** monitors;
     int monitorCount;
 
+    // Clipboard string requests waiting for the platform to deliver a string
+    _GRWLclipboardrequest* clipboardRequests;
+    int clipboardRequestCount;
+    size_t clipboardRequestArraySize;
+
     bool joysticksInitialized;
     _GRWLjoystick joysticks[GRWL_JOYSTICK_LAST + 1];
     _GRWLmapping* mappings;
     int mappingCount;
 
-    _GRWLtls errorSlot;
     _GRWLtls contextSlot;
     _GRWLtls usercontextSlot;
-    _GRWLmutex errorLock;
+
+    _GRWLcontextpool contextPool;
+
+    unsigned int windowSerial;
+    // Timer value at which the event being processed was generated, or zero
+    uint64_t eventTime;
+
+    struct
+    {
+        bool recording;
+        _GRWLmappedfile file;
+        size_t used;
+        uint64_t start;
+        // Window serials used to map recorded windows during replay
+        unsigned int* serials;
+        size_t serialArraySize;
+    } record;
+
+    struct
+    {
+        GRWLevent* events;
+        int capacity;
+        int head;
+        int count;
+    } queue;
+
+    // Memory for data only needed while an event is being processed, reused by
+    // every event processing call
+    struct
+    {
+        unsigned char* block;
+        size_t size;
+        size_t used;
+        // Allocations that did not fit in the block, freed on reset
+        void* overflow;
+        size_t overflowSize;
+    } arena;
+
+    struct
+    {
+        uint64_t events;
+        uint64_t pollWakeups;
+        uint64_t roundTrips;
+        uint64_t allocations;
+        uint64_t allocatedBytes;
+        uint64_t callbacks;
+        uint64_t callbackTicks;
+        uint64_t callbackStart;
+        int callbackDepth;
+    } stats;
 
     struct
     {
@@ -839,6 +1216,7 @@ struct _GRWLlibrary
         EGLDisplay display;
         EGLint major, minor;
         bool prefix;
+        _GRWLfbconfigcache fbconfigs;
 
         bool KHR_create_context;
         bool KHR_create_context_no_error;
@@ -849,7 +1227,9 @@ struct _GRWLlibrary
         bool EXT_platform_base;
         bool EXT_platform_x11;
         bool EXT_platform_wayland;
+        bool EXT_platform_device;
         bool EXT_present_opaque;
+        bool MESA_platform_surfaceless;
         bool ANGLE_platform_angle;
         bool ANGLE_platform_angle_opengl;
         bool ANGLE_platform_angle_d3d;
@@ -878,6 +1258,7 @@ struct _GRWLlibrary
         PFN_eglChooseConfig ChooseConfig;
 
         PFNEGLGETPLATFORMDISPLAYEXTPROC GetPlatformDisplayEXT;
+        PFNEGLQUERYDEVICESEXTPROC QueryDevicesEXT;
         PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC CreatePlatformWindowSurfaceEXT;
     } egl;
 
@@ -894,6 +1275,7 @@ struct _GRWLlibrary
         bool KHR_xlib_surface;
         bool KHR_xcb_surface;
         bool KHR_wayland_surface;
+        bool EXT_headless_surface;
     } vk;
 
     struct
@@ -905,6 +1287,7 @@ struct _GRWLlibrary
         GRWLjoystickbuttonfun joystick_button;
         GRWLjoystickhatfun joystick_hat;
         GRWLgamepadstatefun gamepad_state;
+        GRWLusereventfun user;
     } callbacks;
 
     // These are defined in platform.h
@@ -912,6 +1295,7 @@ struct _GRWLlibrary
     GRWL_PLATFORM_LIBRARY_CONTEXT_STATE
     GRWL_PLATFORM_LIBRARY_JOYSTICK_STATE
     GRWL_PLATFORM_LIBRARY_DBUS_STATE
+    GRWL_PLATFORM_LIBRARY_POLL_STATE
 };
 
 // Global state shared between compilation units of GRWL
@@ -936,10 +1320,24 @@ void _grwlPlatformDestroyMutex(_GRWLmutex* mutex);
 void _grwlPlatformLockMutex(_GRWLmutex* mutex);
 void _grwlPlatformUnlockMutex(_GRWLmutex* mutex);
 
+bool _grwlPlatformCreateThread(_GRWLthread* thread, _GRWLthreadfun function, void* user);
+void _grwlPlatformJoinThread(_GRWLthread* thread);
+
+bool _grwlPlatformCreateCondition(_GRWLcondition* condition);
+void _grwlPlatformDestroyCondition(_GRWLcondition* condition);
+void _grwlPlatformWaitCondition(_GRWLcondition* condition, _GRWLmutex* mutex);
+void _grwlPlatformSignalCondition(_GRWLcondition* condition);
+void _grwlPlatformBroadcastCondition(_GRWLcondition* condition);
+
 void* _grwlPlatformLoadModule(const char* path);
 void _grwlPlatformFreeModule(void* module);
 GRWLproc _grwlPlatformGetModuleSymbol(void* module, const char* name);
 
+bool _grwlPlatformCreateMappedFile(_GRWLmappedfile* file, const char* path, size_t size);
+bool _grwlPlatformOpenMappedFile(_GRWLmappedfile* file, const char* path);
+bool _grwlPlatformResizeMappedFile(_GRWLmappedfile* file, size_t size);
+void _grwlPlatformCloseMappedFile(_GRWLmappedfile* file);
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GRWL event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -966,6 +1364,7 @@ void _grwlInputMouseClick(_GRWLwindow* window, int button, int action, int mods)
 void _grwlInputCursorPos(_GRWLwindow* window, double xpos, double ypos);
 void _grwlInputCursorEnter(_GRWLwindow* window, bool entered);
 void _grwlInputDrop(_GRWLwindow* window, int count, const char** names);
+void _grwlInputClipboardString(const char* string);
 void _grwlInputJoystick(_GRWLjoystick* js, int event);
 void _grwlInputJoystickAxis(_GRWLjoystick* js, int axis, float value);
 void _grwlInputJoystickButton(_GRWLjoystick* js, int button, char value);
@@ -989,8 +1388,24 @@ bool _grwlSelectPlatform(int platformID, _GRWLplatform* platform);
 bool _grwlStringInExtensionString(const char* string, const char* extensions);
 const _GRWLfbconfig* _grwlChooseFBConfig(const _GRWLfbconfig* desired, const _GRWLfbconfig* alternatives,
                                          unsigned int count);
+bool _grwlFindFBConfigChoice(const _GRWLfbconfigcache* cache, const _GRWLfbconfig* desired, int key,
+                             uintptr_t* handle);
+void _grwlAddFBConfigChoice(_GRWLfbconfigcache* cache, const _GRWLfbconfig* desired, int key, uintptr_t handle);
+void _grwlFreeFBConfigCache(_GRWLfbconfigcache* cache);
 bool _grwlRefreshContextAttribs(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig);
 bool _grwlIsValidContextConfig(const _GRWLctxconfig* ctxconfig);
+void _grwlFreeContextTables(_GRWLcontext* context);
+bool _grwlTakePooledContext(const _GRWLctxconfig* ctxconfig, uintptr_t config, uintptr_t* context);
+void _grwlTerminateContextPool();
+void _grwlStopContextWorkers(_GRWLwindow* window);
+void _grwlProcessContextJobs();
+
+_GRWLwindow* _grwlAllocWindow();
+void _grwlFreeWindow(_GRWLwindow* window);
+bool _grwlIsWindowAlive(const _GRWLwindow* window);
+void _grwlTerminateWindows();
+
+void _grwlConvertImage(void* target, int format, const GRWLformattedimage* image);
 
 const GRWLvidmode* _grwlChooseVideoMode(_GRWLmonitor* monitor, const GRWLvidmode* desired);
 int _grwlCompareVideoModes(const GRWLvidmode* first, const GRWLvidmode* second);
@@ -1002,12 +1417,35 @@ void _grwlInitGamepadMappings();
 _GRWLjoystick* _grwlAllocJoystick(const char* name, const char* guid, int axisCount, int buttonCount, int hatCount);
 void _grwlFreeJoystick(_GRWLjoystick* js);
 void _grwlCenterCursorInContentArea(_GRWLwindow* window);
+bool _grwlRequestClipboardStringDeferred();
 void _grwlPollAllJoysticks();
+uint64_t _grwlConvertEventTime(uint32_t time);
+uint64_t _grwlGetEventTime();
+
+void _grwlRecordInput(int type, unsigned int target, const void* data, size_t size);
+void _grwlRecordInputPreedit(_GRWLwindow* window);
+void _grwlRecordInputDrop(_GRWLwindow* window, int count, const char** paths);
+void _grwlStopInputRecording();
+
+bool _grwlInitEventQueue();
+void _grwlTerminateEventQueue();
+GRWLevent* _grwlQueueEvent(int type, _GRWLwindow* window);
+void _grwlDiscardQueuedEvents(_GRWLwindow* window);
+void _grwlForgetQueuedMonitor(_GRWLmonitor* monitor);
+
+bool _grwlInitMessageQueue();
+void _grwlTerminateMessageQueue();
+void _grwlProcessMessages();
+
+void _grwlBeginCallback();
+void _grwlEndCallback();
 
 bool _grwlInitEGL();
 void _grwlTerminateEGL();
 bool _grwlCreateContextEGL(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig* fbconfig);
 _GRWLusercontext* _grwlCreateUserContextEGL(_GRWLwindow* window);
+bool _grwlInitContextPoolEGL(_GRWLcontextpool* pool, const _GRWLfbconfig* fbconfig);
+void _grwlResizeOffscreenSurfaceEGL(_GRWLwindow* window, int width, int height);
 #if defined(_GRWL_X11)
 bool _grwlChooseVisualEGL(const _GRWLwndconfig* wndconfig, const _GRWLctxconfig* ctxconfig,
                           const _GRWLfbconfig* fbconfig, Visual** visual, int* depth);
@@ -1023,8 +1461,11 @@ void _grwlTerminateVulkan();
 const char* _grwlGetVulkanResultString(VkResult result);
 
 size_t _grwlEncodeUTF8(char* s, uint32_t codepoint);
-uint32_t _grwlDecodeUTF8(const char** s);
-char** _grwlParseUriList(char* text, int* count);
+size_t _grwlDecodeUTF8(uint32_t* codepoints, const char* string, size_t length);
+size_t _grwlCountUTF8(const char* string, size_t length);
+size_t _grwlGetLatin1LengthUTF8(const char* string, size_t length);
+size_t _grwlConvertLatin1toUTF8(char* target, const char* string, size_t length);
+char** _grwlParseUriList(const char* text, int* count);
 
 char* _grwl_strdup(const char* source);
 int _grwl_min(int a, int b);
@@ -1035,3 +1476,8 @@ float _grwl_fmaxf(float a, float b);
 void* _grwl_calloc(size_t count, size_t size);
 void* _grwl_realloc(void* pointer, size_t size);
 void _grwl_free(void* pointer);
+void* _grwlReserveBuffer(void* buffer, size_t* capacity, size_t size);
+
+void* _grwlArenaAlloc(size_t size);
+void _grwlResetArena();
+void _grwlTerminateArena();
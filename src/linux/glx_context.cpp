@@ -24,14 +24,14 @@ static int getGLXFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return the GLXFBConfig most closely matching the specified hints
+// Translates every usable GLXFBConfig of the screen into the config cache
+// This is done once, as each attribute query is a request to the server
 //
-static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
+static bool cacheGLXFBConfigs()
 {
     GLXFBConfig* nativeConfigs;
-    _GRWLfbconfig* usableConfigs;
-    const _GRWLfbconfig* closest;
-    int nativeCount, usableCount;
+    _GRWLfbconfig* configs;
+    int nativeCount, count;
     const char* vendor;
     bool trustWindowBit = true;
 
@@ -50,13 +50,13 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
         return false;
     }
 
-    usableConfigs = (_GRWLfbconfig*)_grwl_calloc(nativeCount, sizeof(_GRWLfbconfig));
-    usableCount = 0;
+    configs = (_GRWLfbconfig*)_grwl_calloc(nativeCount, sizeof(_GRWLfbconfig));
+    count = 0;
 
     for (int i = 0; i < nativeCount; i++)
     {
         const GLXFBConfig n = nativeConfigs[i];
-        _GRWLfbconfig* u = usableConfigs + usableCount;
+        _GRWLfbconfig* u = configs + count;
 
         // Only consider RGBA GLXFBConfigs
         if (!(getGLXFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
@@ -73,19 +73,11 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
             }
         }
 
-        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER) != desired->doublebuffer)
+        XVisualInfo* vi = glXGetVisualFromFBConfig(_grwl.x11.display, n);
+        if (vi)
         {
-            continue;
-        }
-
-        if (desired->transparent)
-        {
-            XVisualInfo* vi = glXGetVisualFromFBConfig(_grwl.x11.display, n);
-            if (vi)
-            {
-                u->transparent = _grwlIsVisualTransparentX11(vi->visual);
-                XFree(vi);
-            }
+            u->transparent = _grwlIsVisualTransparentX11(vi->visual);
+            XFree(vi);
         }
 
         u->redBits = getGLXFBConfigAttrib(n, GLX_RED_SIZE);
@@ -108,6 +100,11 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
             u->stereo = true;
         }
 
+        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER))
+        {
+            u->doublebuffer = true;
+        }
+
         if (_grwl.glx.ARB_multisample)
         {
             u->samples = getGLXFBConfigAttrib(n, GLX_SAMPLES);
@@ -119,6 +116,59 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
         }
 
         u->handle = (uintptr_t)n;
+        count++;
+    }
+
+    XFree(nativeConfigs);
+
+    _grwl.glx.fbconfigs.configs = configs;
+    _grwl.glx.fbconfigs.count = count;
+    return true;
+}
+
+// Return the GLXFBConfig most closely matching the specified hints
+//
+static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
+{
+    _GRWLfbconfigcache* cache = &_grwl.glx.fbconfigs;
+    _GRWLfbconfig* usableConfigs;
+    const _GRWLfbconfig* closest;
+    int usableCount;
+    uintptr_t handle;
+
+    if (_grwlFindFBConfigChoice(cache, desired, 0, &handle))
+    {
+        *result = (GLXFBConfig)handle;
+        return true;
+    }
+
+    if (!cache->configs)
+    {
+        if (!cacheGLXFBConfigs())
+        {
+            return false;
+        }
+    }
+
+    usableConfigs = (_GRWLfbconfig*)_grwl_calloc(cache->count ? cache->count : 1, sizeof(_GRWLfbconfig));
+    usableCount = 0;
+
+    for (int i = 0; i < cache->count; i++)
+    {
+        if (cache->configs[i].doublebuffer != desired->doublebuffer)
+        {
+            continue;
+        }
+
+        _GRWLfbconfig* u = usableConfigs + usableCount;
+        *u = cache->configs[i];
+
+        // Transparency only counts when it was requested
+        if (!desired->transparent)
+        {
+            u->transparent = false;
+        }
+
         usableCount++;
     }
 
@@ -126,9 +176,9 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
     if (closest)
     {
         *result = (GLXFBConfig)closest->handle;
+        _grwlAddFBConfigChoice(cache, desired, 0, closest->handle);
     }
 
-    XFree(nativeConfigs);
     _grwl_free(usableConfigs);
 
     return closest != nullptr;
@@ -136,9 +186,9 @@ static bool chooseGLXFBConfig(const _GRWLfbconfig* desired, GLXFBConfig* result)
 
 // Create the OpenGL context using legacy API
 //
-static GLXContext createLegacyContextGLX(_GRWLwindow* window, GLXFBConfig fbconfig, GLXContext share)
+static GLXContext createLegacyContextGLX(Display* display, GLXFBConfig fbconfig, GLXContext share)
 {
-    return glXCreateNewContext(_grwl.x11.display, fbconfig, GLX_RGBA_TYPE, share, True);
+    return glXCreateNewContext(display, fbconfig, GLX_RGBA_TYPE, share, True);
 }
 
 static void makeContextCurrentGLX(_GRWLwindow* window)
@@ -426,6 +476,8 @@ void _grwlTerminateGLX()
     // NOTE: This function must not call any X11 functions, as it is called
     //       after XCloseDisplay (see _grwlTerminateX11 for details)
 
+    _grwlFreeFBConfigCache(&_grwl.glx.fbconfigs);
+
     if (_grwl.glx.handle)
     {
         _grwlPlatformFreeModule(_grwl.glx.handle);
@@ -440,17 +492,15 @@ void _grwlTerminateGLX()
             attribs[index++] = v;                                               \
         }
 
-// Create the OpenGL or OpenGL ES context for the window fbConfig
+// Create the OpenGL or OpenGL ES context for the specified GLXFBConfig
+// This is also called from the context pool thread, which uses its own display
+// connection so that it does not share X error handling with the main thread
 //
-bool _grwlCreateContextForFBGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig, GLXContext* context)
+static bool createContextForConfigGLX(GLXFBConfig fbconfig, const _GRWLctxconfig* ctxconfig, GLXContext share,
+                                      bool pooled, GLXContext* context)
 {
+    Display* display = pooled ? _grwl.glx.poolDisplay : _grwl.x11.display;
     int attribs[40];
-    GLXContext share = nullptr;
-
-    if (ctxconfig->share)
-    {
-        share = ctxconfig->share->context.glx.handle;
-    }
 
     if (ctxconfig->client == GRWL_OPENGL_ES_API)
     {
@@ -483,7 +533,14 @@ bool _grwlCreateContextForFBGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxco
         }
     }
 
-    _grwlGrabErrorHandlerX11();
+    if (pooled)
+    {
+        _grwlGrabPoolErrorHandlerX11();
+    }
+    else
+    {
+        _grwlGrabErrorHandlerX11();
+    }
 
     if (_grwl.glx.ARB_create_context)
     {
@@ -576,8 +633,7 @@ bool _grwlCreateContextForFBGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxco
 
         SET_ATTRIB(None, None);
 
-        *context =
-            _grwl.glx.CreateContextAttribsARB(_grwl.x11.display, window->context.glx.fbconfig, share, True, attribs);
+        *context = _grwl.glx.CreateContextAttribsARB(display, fbconfig, share, True, attribs);
 
         // HACK: This is a fallback for broken versions of the Mesa
         //       implementation of GLX_ARB_create_context_profile that fail
@@ -585,29 +641,121 @@ bool _grwlCreateContextForFBGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxco
         //       violation of the extension spec
         if (!(*context))
         {
-            if (_grwl.x11.errorCode == _grwl.glx.errorBase + GLXBadProfileARB && ctxconfig->client == GRWL_OPENGL_API &&
+            const int errorCode = pooled ? _grwl.glx.poolErrorCode : _grwl.x11.errorCode;
+            if (errorCode == _grwl.glx.errorBase + GLXBadProfileARB && ctxconfig->client == GRWL_OPENGL_API &&
                 ctxconfig->profile == GRWL_OPENGL_ANY_PROFILE && ctxconfig->forward == false)
             {
-                *context = createLegacyContextGLX(window, window->context.glx.fbconfig, share);
+                *context = createLegacyContextGLX(display, fbconfig, share);
             }
         }
     }
     else
     {
-        *context = createLegacyContextGLX(window, window->context.glx.fbconfig, share);
+        *context = createLegacyContextGLX(display, fbconfig, share);
     }
 
-    _grwlReleaseErrorHandlerX11();
+    if (pooled)
+    {
+        _grwlReleasePoolErrorHandlerX11();
+    }
+    else
+    {
+        _grwlReleaseErrorHandlerX11();
+    }
 
     if (!(*context))
     {
-        _grwlInputErrorX11(GRWL_VERSION_UNAVAILABLE, "GLX: Failed to create context");
+        if (pooled)
+        {
+            _grwlInputError(GRWL_VERSION_UNAVAILABLE, "GLX: Failed to create context");
+        }
+        else
+        {
+            _grwlInputErrorX11(GRWL_VERSION_UNAVAILABLE, "GLX: Failed to create context");
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+// Create the OpenGL or OpenGL ES context for the window fbConfig
+//
+bool _grwlCreateContextForFBGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig, GLXContext* context)
+{
+    GLXContext share = nullptr;
+
+    if (ctxconfig->share)
+    {
+        share = ctxconfig->share->context.glx.handle;
+    }
+
+    return createContextForConfigGLX(window->context.glx.fbconfig, ctxconfig, share, false, context);
+}
+
+// Creates a context for the context pool, on the pool thread
+//
+// Returns the GLXFBConfig of the context pool connection with the same ID as
+// the specified GLXFBConfig of the main connection
+//
+static GLXFBConfig getPoolFBConfigGLX(GLXFBConfig native)
+{
+    int id, count;
+
+    if (glXGetFBConfigAttrib(_grwl.x11.display, native, GLX_FBCONFIG_ID, &id) != Success)
+    {
+        return nullptr;
+    }
+
+    GLXFBConfig* configs = glXGetFBConfigs(_grwl.glx.poolDisplay, _grwl.x11.screen, &count);
+    GLXFBConfig result = nullptr;
+
+    for (int i = 0; i < count; i++)
+    {
+        int value;
+        if (glXGetFBConfigAttrib(_grwl.glx.poolDisplay, configs[i], GLX_FBCONFIG_ID, &value) == Success &&
+            value == id)
+        {
+            result = configs[i];
+            break;
+        }
+    }
+
+    if (configs)
+    {
+        XFree(configs);
+    }
+
+    return result;
+}
+
+static bool createPooledContextGLX(uintptr_t config, const _GRWLctxconfig* ctxconfig, uintptr_t share,
+                                   uintptr_t* context)
+{
+    GLXContext handle;
+
+    GLXFBConfig native = getPoolFBConfigGLX((GLXFBConfig)config);
+    if (!native)
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "GLX: Failed to find the GLXFBConfig of the context pool");
         return false;
     }
 
+    if (!createContextForConfigGLX(native, ctxconfig, (GLXContext)share, true, &handle))
+    {
+        return false;
+    }
+
+    *context = (uintptr_t)handle;
     return true;
 }
 
+static void destroyPooledContextGLX(uintptr_t context)
+{
+    glXDestroyContext(_grwl.glx.poolDisplay, (GLXContext)context);
+}
+
 // Create the OpenGL or OpenGL ES context
 //
 bool _grwlCreateContextGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig, const _GRWLfbconfig* fbconfig)
@@ -619,7 +767,13 @@ bool _grwlCreateContextGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig,
         return false;
     }
 
-    if (!_grwlCreateContextForFBGLX(window, ctxconfig, &window->context.glx.handle))
+    uintptr_t pooled;
+
+    if (_grwlTakePooledContext(ctxconfig, (uintptr_t)window->context.glx.fbconfig, &pooled))
+    {
+        window->context.glx.handle = (GLXContext)pooled;
+    }
+    else if (!_grwlCreateContextForFBGLX(window, ctxconfig, &window->context.glx.handle))
     {
         return false;
     }
@@ -672,6 +826,42 @@ bool _grwlChooseVisualGLX(const _GRWLwndconfig* wndconfig, const _GRWLctxconfig*
     return true;
 }
 
+// Chooses the GLXFBConfig of a context pool for the specified hints
+//
+bool _grwlInitContextPoolGLX(_GRWLcontextpool* pool, const _GRWLfbconfig* fbconfig)
+{
+    GLXFBConfig native;
+
+    if (!_grwlInitGLX())
+    {
+        return false;
+    }
+
+    if (!chooseGLXFBConfig(fbconfig, &native))
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "GLX: Failed to find a suitable GLXFBConfig");
+        return false;
+    }
+
+    // The pool thread creates contexts on a connection of its own, so that its
+    // X errors cannot be mistaken for those of the main thread
+    if (!_grwl.glx.poolDisplay)
+    {
+        _grwl.glx.poolDisplay = _grwl.x11.xlib.OpenDisplay(DisplayString(_grwl.x11.display));
+        if (!_grwl.glx.poolDisplay)
+        {
+            _grwlInputError(GRWL_PLATFORM_ERROR, "GLX: Failed to open a display connection for the context pool");
+            return false;
+        }
+    }
+
+    // The pool is keyed by the GLXFBConfig of the main connection
+    pool->config = (uintptr_t)native;
+    pool->create = createPooledContextGLX;
+    pool->destroy = destroyPooledContextGLX;
+    return true;
+}
+
 static void _grwlMakeUserContextCurrentGLX(_GRWLusercontext* context)
 {
     if (!glXMakeCurrent(_grwl.x11.display, context->window->context.glx.window, context->glx.handle))
@@ -721,6 +911,7 @@ GRWLAPI GLXContext grwlGetGLXContext(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_X11)
     {
@@ -741,6 +932,7 @@ GRWLAPI GLXWindow grwlGetGLXWindow(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(None);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, None);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_X11)
     {
@@ -10,6 +10,8 @@
     #include <sys/types.h>
     #include <sys/stat.h>
     #include <sys/inotify.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
     #include <fcntl.h>
     #include <dirent.h>
     #include <unistd.h>
@@ -17,12 +19,61 @@
     #include <cstdio>
     #include <cstdlib>
     #include <cstring>
+    #include <ctime>
+    #include <atomic>
+    #include <pthread.h>
 
     #ifndef SYN_DROPPED // < v2.6.39 kernel headers
         // Workaround for CentOS-6, which is supported till 2020-11-30, but still on v2.6.32
         #define SYN_DROPPED 3
     #endif
 
+    #ifndef input_event_sec // < v4.16 kernel headers
+        #define input_event_sec time.tv_sec
+        #define input_event_usec time.tv_usec
+    #endif
+
+    // The number of events the input thread can queue, must be a power of two
+    #define _GRWL_INPUT_THREAD_CAPACITY 4096
+
+// An event read by the input thread
+//
+typedef struct _GRWLinputeventLinux
+{
+    uint32_t serial;
+    bool disconnected;
+    struct input_event event;
+} _GRWLinputeventLinux;
+
+// A joystick device read by the input thread
+//
+typedef struct _GRWLinputdeviceLinux
+{
+    uint32_t serial;
+    int fd;
+} _GRWLinputdeviceLinux;
+
+// This is outside of _grwl as it is shared with the input thread and must not
+// be cleared with memset
+//
+static struct
+{
+    bool running;
+    pthread_t thread;
+    // Guards the device list, so that devices are not read after being closed
+    pthread_mutex_t mutex;
+    _GRWLinputdeviceLinux devices[GRWL_JOYSTICK_LAST + 1];
+    int epoll;
+    int stop;
+    int wakeup;
+    uint32_t serial;
+    _GRWLinputeventLinux* events;
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+    std::atomic<bool> pending;
+    std::atomic<bool> overflowed;
+} _grwlInputThread;
+
 // Apply an EV_KEY event to the specified joystick
 //
 static void handleKeyEvent(_GRWLjoystick* js, int code, int value)
@@ -105,6 +156,257 @@ static void pollAbsState(_GRWLjoystick* js)
     }
 }
 
+// Apply an input event read from the specified joystick
+//
+static void applyInputEvent(_GRWLjoystick* js, const struct input_event* e)
+{
+    if (e->type == EV_SYN)
+    {
+        if (e->code == SYN_DROPPED)
+        {
+            _grwl.linjs.dropped = true;
+        }
+        else if (e->code == SYN_REPORT)
+        {
+            _grwl.linjs.dropped = false;
+            pollAbsState(js);
+        }
+    }
+
+    if (_grwl.linjs.dropped)
+    {
+        return;
+    }
+
+    if (js->linjs.monotonicTime)
+    {
+        const uint64_t frequency = _grwlPlatformGetTimerFrequency();
+        _grwl.eventTime =
+            (uint64_t)e->input_event_sec * frequency + (uint64_t)e->input_event_usec * (frequency / 1000000);
+    }
+
+    if (e->type == EV_KEY)
+    {
+        handleKeyEvent(js, e->code, e->value);
+    }
+    else if (e->type == EV_ABS)
+    {
+        handleAbsEvent(js, e->code, e->value);
+    }
+
+    _grwl.eventTime = 0;
+}
+
+// Reads the queued input of the joystick whose device fd became readable
+//
+static void handleJoystickInput(int fd)
+{
+    for (int jid = 0; jid <= GRWL_JOYSTICK_LAST; jid++)
+    {
+        _GRWLjoystick* js = _grwl.joysticks + jid;
+        if (js->connected && js->linjs.fd == fd)
+        {
+            _grwlPollJoystickLinux(js, _GRWL_POLL_ALL);
+            return;
+        }
+    }
+}
+
+// Handles device connection notifications from inotify
+//
+static void handleDeviceNotification(int fd)
+{
+    _grwlDetectJoystickConnectionLinux();
+}
+
+// Appends an event to the input thread queue, from the input thread
+//
+static void pushInputEvent(uint32_t serial, bool disconnected, const struct input_event* e)
+{
+    const size_t tail = _grwlInputThread.tail.load(std::memory_order_relaxed);
+    if (tail - _grwlInputThread.head.load(std::memory_order_acquire) == _GRWL_INPUT_THREAD_CAPACITY)
+    {
+        // The main thread resynchronizes the axes once it catches up
+        _grwlInputThread.overflowed.store(true, std::memory_order_release);
+        return;
+    }
+
+    _GRWLinputeventLinux* slot = _grwlInputThread.events + (tail & (_GRWL_INPUT_THREAD_CAPACITY - 1));
+    slot->serial = serial;
+    slot->disconnected = disconnected;
+    if (e)
+    {
+        slot->event = *e;
+    }
+
+    _grwlInputThread.tail.store(tail + 1, std::memory_order_release);
+}
+
+// Reads all available events of the specified device, from the input thread
+// Returns whether any events were queued
+//
+static bool readInputDevice(_GRWLinputdeviceLinux* device)
+{
+    bool queued = false;
+
+    for (;;)
+    {
+        struct input_event buffer[64];
+
+        const ssize_t result = read(device->fd, buffer, sizeof(buffer));
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // Let the main thread close the device, as it owns the joystick
+            if (errno == ENODEV)
+            {
+                epoll_ctl(_grwlInputThread.epoll, EPOLL_CTL_DEL, device->fd, nullptr);
+                pushInputEvent(device->serial, true, nullptr);
+                device->serial = 0;
+                queued = true;
+            }
+
+            break;
+        }
+
+        const size_t count = (size_t)result / sizeof(struct input_event);
+        for (size_t i = 0; i < count; i++)
+        {
+            pushInputEvent(device->serial, false, buffer + i);
+        }
+
+        // Wake the main thread even if the queue is full, so it resynchronizes
+        queued = true;
+
+        if ((size_t)result < sizeof(buffer))
+        {
+            break;
+        }
+    }
+
+    return queued;
+}
+
+// Entry point of the input thread
+//
+static void* inputThreadMain(void* arg)
+{
+    for (;;)
+    {
+        struct epoll_event events[16];
+
+        const int count = epoll_wait(_grwlInputThread.epoll, events, sizeof(events) / sizeof(events[0]), -1);
+        if (count == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        bool queued = false;
+
+        pthread_mutex_lock(&_grwlInputThread.mutex);
+
+        for (int i = 0; i < count; i++)
+        {
+            const uint32_t serial = (uint32_t)events[i].data.u64;
+
+            // The stop eventfd has serial zero
+            if (serial == 0)
+            {
+                pthread_mutex_unlock(&_grwlInputThread.mutex);
+                return nullptr;
+            }
+
+            for (int j = 0; j <= GRWL_JOYSTICK_LAST; j++)
+            {
+                if (_grwlInputThread.devices[j].serial == serial)
+                {
+                    queued |= readInputDevice(_grwlInputThread.devices + j);
+                    break;
+                }
+            }
+        }
+
+        pthread_mutex_unlock(&_grwlInputThread.mutex);
+
+        // Only wake the event loop once until it has drained the queue
+        if (queued && !_grwlInputThread.pending.exchange(true, std::memory_order_acq_rel))
+        {
+            const uint64_t value = 1;
+            while (write(_grwlInputThread.wakeup, &value, sizeof(value)) == -1 && errno == EINTR)
+            {
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+// Makes the input thread read the specified joystick
+//
+static void addInputThreadDevice(_GRWLjoystickLinux* linjs)
+{
+    if (++_grwlInputThread.serial == 0)
+    {
+        _grwlInputThread.serial++;
+    }
+
+    linjs->serial = _grwlInputThread.serial;
+
+    pthread_mutex_lock(&_grwlInputThread.mutex);
+
+    for (int i = 0; i <= GRWL_JOYSTICK_LAST; i++)
+    {
+        _GRWLinputdeviceLinux* device = _grwlInputThread.devices + i;
+        if (device->serial == 0)
+        {
+            struct epoll_event event;
+            memset(&event, 0, sizeof(event));
+            event.events = EPOLLIN;
+            event.data.u64 = linjs->serial;
+
+            if (epoll_ctl(_grwlInputThread.epoll, EPOLL_CTL_ADD, linjs->fd, &event) == 0)
+            {
+                device->serial = linjs->serial;
+                device->fd = linjs->fd;
+            }
+
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&_grwlInputThread.mutex);
+}
+
+// Makes the input thread stop reading the specified joystick
+// This must be called before the device is closed
+//
+static void removeInputThreadDevice(_GRWLjoystickLinux* linjs)
+{
+    pthread_mutex_lock(&_grwlInputThread.mutex);
+
+    for (int i = 0; i <= GRWL_JOYSTICK_LAST; i++)
+    {
+        _GRWLinputdeviceLinux* device = _grwlInputThread.devices + i;
+        if (device->serial == linjs->serial)
+        {
+            epoll_ctl(_grwlInputThread.epoll, EPOLL_CTL_DEL, device->fd, nullptr);
+            device->serial = 0;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&_grwlInputThread.mutex);
+}
+
     #define isBitSet(bit, arr) (arr[(bit) / 8] & (1 << ((bit) % 8)))
 
 // Attempt to open the specified joystick device
@@ -151,6 +453,15 @@ static bool openJoystickDevice(const char* path)
         return false;
     }
 
+    #if defined(EVIOCSCLOCKID)
+    // Have events timestamped with the same clock as the timer, if possible
+    if (_grwl.timer.posix.clock == CLOCK_MONOTONIC)
+    {
+        const int clockID = CLOCK_MONOTONIC;
+        linjs.monotonicTime = ioctl(linjs.fd, EVIOCSCLOCKID, &clockID) == 0;
+    }
+    #endif
+
     char name[256] = "";
 
     if (ioctl(linjs.fd, EVIOCGNAME(sizeof(name)), name) < 0)
@@ -228,6 +539,18 @@ static bool openJoystickDevice(const char* path)
     js->usbInfo = usbinfo;
 
     strncpy(linjs.path, path, sizeof(linjs.path) - 1);
+
+    if (_grwlInputThread.running)
+    {
+        addInputThreadDevice(&linjs);
+    }
+    else
+    {
+        // Input is also read when the joystick is queried, so continue without
+        // event loop notifications if this fails
+        _grwlAddPollSourcePOSIX(linjs.fd, handleJoystickInput);
+    }
+
     memcpy(&js->linjs, &linjs, sizeof(linjs));
 
     pollAbsState(js);
@@ -243,10 +566,178 @@ static bool openJoystickDevice(const char* path)
 static void closeJoystick(_GRWLjoystick* js)
 {
     _grwlInputJoystick(js, GRWL_DISCONNECTED);
+
+    if (_grwlInputThread.running)
+    {
+        removeInputThreadDevice(&js->linjs);
+    }
+    else
+    {
+        _grwlRemovePollSourcePOSIX(js->linjs.fd);
+    }
+
     close(js->linjs.fd);
     _grwlFreeJoystick(js);
 }
 
+// Applies the events queued by the input thread
+//
+static void drainInputThread()
+{
+    if (!_grwlInputThread.pending.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        const size_t head = _grwlInputThread.head.load(std::memory_order_relaxed);
+        if (head == _grwlInputThread.tail.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        // Free the slot before calling user code, which may drain the queue
+        const _GRWLinputeventLinux record = _grwlInputThread.events[head & (_GRWL_INPUT_THREAD_CAPACITY - 1)];
+        _grwlInputThread.head.store(head + 1, std::memory_order_release);
+
+        for (int jid = 0; jid <= GRWL_JOYSTICK_LAST; jid++)
+        {
+            _GRWLjoystick* js = _grwl.joysticks + jid;
+            if (js->connected && js->linjs.serial == record.serial)
+            {
+                if (record.disconnected)
+                {
+                    closeJoystick(js);
+                }
+                else
+                {
+                    applyInputEvent(js, &record.event);
+                }
+
+                break;
+            }
+        }
+    }
+
+    if (_grwlInputThread.overflowed.exchange(false, std::memory_order_acq_rel))
+    {
+        for (int jid = 0; jid <= GRWL_JOYSTICK_LAST; jid++)
+        {
+            if (_grwl.joysticks[jid].connected)
+            {
+                pollAbsState(_grwl.joysticks + jid);
+            }
+        }
+    }
+}
+
+// Drains the eventfd of the input thread and applies the queued events
+//
+static void handleThreadedInput(int fd)
+{
+    uint64_t value;
+    while (read(fd, &value, sizeof(value)) == -1 && errno == EINTR)
+    {
+    }
+
+    drainInputThread();
+}
+
+// Starts reading joystick devices on the input thread
+// The device fds are then waited on by the input thread instead of the event
+// loop, which is woken up when events have been queued
+//
+static bool startInputThread()
+{
+    _grwlInputThread.epoll = epoll_create1(EPOLL_CLOEXEC);
+    _grwlInputThread.stop = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    _grwlInputThread.wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    _grwlInputThread.events =
+        (_GRWLinputeventLinux*)_grwl_calloc(_GRWL_INPUT_THREAD_CAPACITY, sizeof(_GRWLinputeventLinux));
+
+    memset(_grwlInputThread.devices, 0, sizeof(_grwlInputThread.devices));
+    _grwlInputThread.head.store(0, std::memory_order_relaxed);
+    _grwlInputThread.tail.store(0, std::memory_order_relaxed);
+    _grwlInputThread.pending.store(false, std::memory_order_relaxed);
+    _grwlInputThread.overflowed.store(false, std::memory_order_relaxed);
+
+    if (_grwlInputThread.epoll == -1 || _grwlInputThread.stop == -1 || _grwlInputThread.wakeup == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Linux: Failed to create input thread fds: %s", strerror(errno));
+        return false;
+    }
+
+    if (!_grwlInputThread.events)
+    {
+        return false;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u64 = 0;
+
+    if (epoll_ctl(_grwlInputThread.epoll, EPOLL_CTL_ADD, _grwlInputThread.stop, &event) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Linux: Failed to add fd to epoll instance: %s", strerror(errno));
+        return false;
+    }
+
+    pthread_mutex_init(&_grwlInputThread.mutex, nullptr);
+
+    if (pthread_create(&_grwlInputThread.thread, nullptr, inputThreadMain, nullptr) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Linux: Failed to create input thread");
+        pthread_mutex_destroy(&_grwlInputThread.mutex);
+        return false;
+    }
+
+    _grwlInputThread.running = true;
+
+    // Queued events are also drained when joysticks are queried, so continue
+    // without event loop notifications if this fails
+    _grwlAddPollSourcePOSIX(_grwlInputThread.wakeup, handleThreadedInput);
+    return true;
+}
+
+// Stops the input thread and frees its resources
+//
+static void stopInputThread()
+{
+    if (_grwlInputThread.running)
+    {
+        const uint64_t value = 1;
+        while (write(_grwlInputThread.stop, &value, sizeof(value)) == -1 && errno == EINTR)
+        {
+        }
+
+        pthread_join(_grwlInputThread.thread, nullptr);
+        pthread_mutex_destroy(&_grwlInputThread.mutex);
+        _grwlRemovePollSourcePOSIX(_grwlInputThread.wakeup);
+        _grwlInputThread.running = false;
+    }
+
+    if (_grwlInputThread.epoll >= 0)
+    {
+        close(_grwlInputThread.epoll);
+    }
+    if (_grwlInputThread.stop >= 0)
+    {
+        close(_grwlInputThread.stop);
+    }
+    if (_grwlInputThread.wakeup >= 0)
+    {
+        close(_grwlInputThread.wakeup);
+    }
+
+    _grwl_free(_grwlInputThread.events);
+    _grwlInputThread.events = nullptr;
+    _grwlInputThread.epoll = -1;
+    _grwlInputThread.stop = -1;
+    _grwlInputThread.wakeup = -1;
+}
+
 // Lexically compare joysticks by name; used by qsort
 //
 static int compareJoysticks(const void* fp, const void* sp)
@@ -319,10 +810,20 @@ bool _grwlInitJoysticksLinux()
         //       This works well in practice but the true way is libudev
 
         _grwl.linjs.watch = inotify_add_watch(_grwl.linjs.inotify, dirname, IN_CREATE | IN_ATTRIB | IN_DELETE);
+        _grwlAddPollSourcePOSIX(_grwl.linjs.inotify, handleDeviceNotification);
     }
 
     // Continue without device connection notifications if inotify fails
 
+    if (_grwl.hints.init.inputThread)
+    {
+        // Continue reading devices on the event loop if the thread fails
+        if (!startInputThread())
+        {
+            stopInputThread();
+        }
+    }
+
     if (regcomp(&_grwl.linjs.regex, "^event[0-9]\\+$", 0) != 0)
     {
         _grwlInputError(GRWL_PLATFORM_ERROR, "Linux: Failed to compile regex");
@@ -375,6 +876,11 @@ void _grwlTerminateJoysticksLinux()
         }
     }
 
+    if (_grwl.hints.init.inputThread)
+    {
+        stopInputThread();
+    }
+
     if (_grwl.linjs.inotify > 0)
     {
         if (_grwl.linjs.watch > 0)
@@ -382,6 +888,7 @@ void _grwlTerminateJoysticksLinux()
             inotify_rm_watch(_grwl.linjs.inotify, _grwl.linjs.watch);
         }
 
+        _grwlRemovePollSourcePOSIX(_grwl.linjs.inotify);
         close(_grwl.linjs.inotify);
         regfree(&_grwl.linjs.regex);
     }
@@ -389,6 +896,14 @@ void _grwlTerminateJoysticksLinux()
 
 bool _grwlPollJoystickLinux(_GRWLjoystick* js, int mode)
 {
+    _GRWL_TRACE_ZONE("_grwlPollJoystickLinux");
+
+    if (_grwlInputThread.running)
+    {
+        drainInputThread();
+        return js->connected;
+    }
+
     // Read all queued events (non-blocking)
     for (;;)
     {
@@ -406,32 +921,7 @@ bool _grwlPollJoystickLinux(_GRWLjoystick* js, int mode)
             break;
         }
 
-        if (e.type == EV_SYN)
-        {
-            if (e.code == SYN_DROPPED)
-            {
-                _grwl.linjs.dropped = true;
-            }
-            else if (e.code == SYN_REPORT)
-            {
-                _grwl.linjs.dropped = false;
-                pollAbsState(js);
-            }
-        }
-
-        if (_grwl.linjs.dropped)
-        {
-            continue;
-        }
-
-        if (e.type == EV_KEY)
-        {
-            handleKeyEvent(js, e.code, e.value);
-        }
-        else if (e.type == EV_ABS)
-        {
-            handleAbsEvent(js, e.code, e.value);
-        }
+        applyInputEvent(js, &e);
     }
 
     return js->connected;
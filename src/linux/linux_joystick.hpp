@@ -20,6 +20,9 @@ typedef struct _GRWLjoystickLinux
     int absMap[ABS_CNT];
     struct input_absinfo absInfo[ABS_CNT];
     int hats[4][2];
+    bool monotonicTime;
+    // Identifies the device to the input thread, as file descriptors are reused
+    uint32_t serial;
 } _GRWLjoystickLinux;
 
 // Linux-specific joystick API data
@@ -10,6 +10,226 @@
     #include <csignal>
     #include <ctime>
     #include <cerrno>
+    #include <climits>
+    #include <cmath>
+    #include <cstring>
+    #include <unistd.h>
+    #include <fcntl.h>
+
+    #if defined(__linux__)
+        #include <sys/epoll.h>
+        #include <sys/eventfd.h>
+    #endif
+
+// The maximum number of ready sources retrieved by a single wait
+    #define _GRWL_POLL_EVENT_COUNT 16
+
+// Drains any pending wakeups from the wakeup fd
+//
+static void drainWakeups(int fd)
+{
+    for (;;)
+    {
+        uint64_t value;
+        const ssize_t result = read(fd, &value, sizeof(value));
+        if (result == -1 && errno != EINTR)
+        {
+            break;
+        }
+    }
+}
+
+// Creates the file descriptors used to wake up a blocking wait
+//
+static bool createWakeupFds()
+{
+    #if defined(__linux__)
+    const int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create wakeup eventfd: %s", strerror(errno));
+        return false;
+    }
+
+    // The eventfd is both the read and the write end
+    _grwl.poll.wakeup[0] = fd;
+    _grwl.poll.wakeup[1] = fd;
+    #else
+    // Create the pipe without assuming the OS has pipe2(2)
+    if (pipe(_grwl.poll.wakeup) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create wakeup pipe: %s", strerror(errno));
+        return false;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        const int sf = fcntl(_grwl.poll.wakeup[i], F_GETFL, 0);
+        const int df = fcntl(_grwl.poll.wakeup[i], F_GETFD, 0);
+
+        if (sf == -1 || df == -1 || fcntl(_grwl.poll.wakeup[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
+            fcntl(_grwl.poll.wakeup[i], F_SETFD, df | FD_CLOEXEC) == -1)
+        {
+            _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to set flags for wakeup pipe: %s", strerror(errno));
+            return false;
+        }
+    }
+    #endif
+
+    return true;
+}
+
+// Returns the source with the specified fd, or nullptr if there is none
+//
+static _GRWLpollsourcePOSIX* findSource(int fd)
+{
+    for (int i = 0; i < _grwl.poll.sourceCount; i++)
+    {
+        if (_grwl.poll.sources[i].fd == fd)
+        {
+            return _grwl.poll.sources + i;
+        }
+    }
+
+    return nullptr;
+}
+
+// Adds a source to the event loop
+//
+static bool addSource(int fd, short events, _GRWLpollhandlerfun handler, GRWLwatchfun callback, void* user)
+{
+    if (!_grwl.poll.initialized)
+    {
+        return false;
+    }
+
+    #if defined(__linux__)
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.data.fd = fd;
+
+    if (events & POLLIN)
+    {
+        event.events |= EPOLLIN;
+    }
+    if (events & POLLOUT)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    if (epoll_ctl(_grwl.poll.epoll, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to add fd to epoll instance: %s", strerror(errno));
+        return false;
+    }
+    #endif
+
+    _GRWLpollsourcePOSIX* sources = (_GRWLpollsourcePOSIX*)_grwl_realloc(
+        _grwl.poll.sources, sizeof(_GRWLpollsourcePOSIX) * (_grwl.poll.sourceCount + 1));
+    if (!sources)
+    {
+    #if defined(__linux__)
+        epoll_ctl(_grwl.poll.epoll, EPOLL_CTL_DEL, fd, nullptr);
+    #endif
+        return false;
+    }
+
+    _GRWLpollsourcePOSIX* source = sources + _grwl.poll.sourceCount;
+    memset(source, 0, sizeof(_GRWLpollsourcePOSIX));
+    source->fd = fd;
+    source->events = events;
+    source->handler = handler;
+    source->callback = callback;
+    source->user = user;
+
+    _grwl.poll.sources = sources;
+    _grwl.poll.sourceCount++;
+    return true;
+}
+
+// Removes the specified source from the event loop
+//
+static void removeSource(_GRWLpollsourcePOSIX* source)
+{
+    #if defined(__linux__)
+    epoll_ctl(_grwl.poll.epoll, EPOLL_CTL_DEL, source->fd, nullptr);
+    #endif
+
+    const int index = (int)(source - _grwl.poll.sources);
+    _grwl.poll.sourceCount--;
+    memmove(source, source + 1, ((size_t)_grwl.poll.sourceCount - index) * sizeof(_GRWLpollsourcePOSIX));
+}
+
+    #if defined(__linux__)
+
+// Waits for any source in the epoll set to become ready
+//
+static bool waitEpoll(double* timeout)
+{
+    struct epoll_event events[_GRWL_POLL_EVENT_COUNT];
+
+    for (;;)
+    {
+        int milliseconds = -1;
+        uint64_t base = 0;
+
+        if (timeout)
+        {
+            base = _grwlPlatformGetTimerValue();
+
+            // Round up so that short timeouts do not turn into busy waiting
+            const double remaining = ceil(*timeout * 1e3);
+            milliseconds = remaining < (double)INT_MAX ? (int)remaining : INT_MAX;
+        }
+
+        const int result = epoll_wait(_grwl.poll.epoll, events, _GRWL_POLL_EVENT_COUNT, milliseconds);
+        const int error = errno; // clock_gettime may overwrite our error
+
+        if (timeout)
+        {
+            *timeout -= (_grwlPlatformGetTimerValue() - base) / (double)_grwlPlatformGetTimerFrequency();
+        }
+
+        if (result > 0)
+        {
+            _grwl.stats.pollWakeups++;
+
+            for (int i = 0; i < result; i++)
+            {
+                _GRWLpollsourcePOSIX* source = findSource(events[i].data.fd);
+                if (!source)
+                {
+                    continue;
+                }
+
+                if (events[i].events & EPOLLIN)
+                {
+                    source->revents |= POLLIN;
+                }
+                if (events[i].events & EPOLLOUT)
+                {
+                    source->revents |= POLLOUT;
+                }
+                if (events[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    source->revents |= POLLERR;
+                }
+            }
+
+            return true;
+        }
+        else if (result == -1 && error != EINTR)
+        {
+            return false;
+        }
+        else if (timeout && *timeout <= 0.0)
+        {
+            return false;
+        }
+    }
+}
+
+    #endif // __linux__
 
 bool _grwlPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
 {
@@ -39,6 +259,7 @@ bool _grwlPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
 
             if (result > 0)
             {
+                _grwl.stats.pollWakeups++;
                 return true;
             }
             else if (result == -1 && error != EINTR && error != EAGAIN)
@@ -55,6 +276,7 @@ bool _grwlPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
             const int result = poll(fds, count, -1);
             if (result > 0)
             {
+                _grwl.stats.pollWakeups++;
                 return true;
             }
             else if (result == -1 && errno != EINTR && errno != EAGAIN)
@@ -65,4 +287,249 @@ bool _grwlPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Creates the event loop and its wakeup fd
+//
+bool _grwlInitPollPOSIX()
+{
+    _grwl.poll.epoll = -1;
+    _grwl.poll.wakeup[0] = -1;
+    _grwl.poll.wakeup[1] = -1;
+
+    #if defined(__linux__)
+    _grwl.poll.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_grwl.poll.epoll == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create epoll instance: %s", strerror(errno));
+        return false;
+    }
+    #endif
+
+    if (!createWakeupFds())
+    {
+        return false;
+    }
+
+    _grwl.poll.initialized = true;
+    return _grwlAddPollSourcePOSIX(_grwl.poll.wakeup[0], drainWakeups);
+}
+
+// Destroys the event loop
+// The sources are not closed, as they are owned by whoever added them
+//
+void _grwlTerminatePollPOSIX()
+{
+    if (_grwl.poll.epoll > 0)
+    {
+        close(_grwl.poll.epoll);
+    }
+
+    if (_grwl.poll.wakeup[0] > 0)
+    {
+        close(_grwl.poll.wakeup[0]);
+    }
+
+    if (_grwl.poll.wakeup[1] > 0 && _grwl.poll.wakeup[1] != _grwl.poll.wakeup[0])
+    {
+        close(_grwl.poll.wakeup[1]);
+    }
+
+    _grwl_free(_grwl.poll.sources);
+    memset(&_grwl.poll, 0, sizeof(_grwl.poll));
+}
+
+// Adds a file descriptor to the set waited on by the event loop
+// If the handler is nullptr, the platform checks for readiness after waiting
+//
+bool _grwlAddPollSourcePOSIX(int fd, _GRWLpollhandlerfun handler)
+{
+    return addSource(fd, POLLIN, handler, nullptr, nullptr);
+}
+
+// Adds a file descriptor to be waited on by the event loop until it is writable
+//
+bool _grwlAddWritePollSourcePOSIX(int fd, _GRWLpollhandlerfun handler)
+{
+    return addSource(fd, POLLOUT, handler, nullptr, nullptr);
+}
+
+// Removes a file descriptor from the set waited on by the event loop
+// This must be called before the file descriptor is closed
+//
+void _grwlRemovePollSourcePOSIX(int fd)
+{
+    _GRWLpollsourcePOSIX* source = findSource(fd);
+    if (source)
+    {
+        removeSource(source);
+    }
+}
+
+// Adds a user file descriptor watch to the event loop
+//
+bool _grwlAddWatchPOSIX(int fd, int events, GRWLwatchfun callback, void* user)
+{
+    if (findSource(fd))
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "File descriptor %i is already being waited on", fd);
+        return false;
+    }
+
+    short pollEvents = 0;
+
+    if (events & GRWL_WATCH_READ)
+    {
+        pollEvents |= POLLIN;
+    }
+    if (events & GRWL_WATCH_WRITE)
+    {
+        pollEvents |= POLLOUT;
+    }
+
+    return addSource(fd, pollEvents, nullptr, callback, user);
+}
+
+// Removes a user file descriptor watch from the event loop
+// Returns false if the fd is not watched by the user
+//
+bool _grwlRemoveWatchPOSIX(int fd)
+{
+    _GRWLpollsourcePOSIX* source = findSource(fd);
+    if (!source || !source->callback)
+    {
+        return false;
+    }
+
+    removeSource(source);
+    return true;
+}
+
+// Waits until any source is ready or the timeout expires and marks the ready
+// sources, without calling their handlers
+// Returns false if the timeout expired or an error occurred
+//
+bool _grwlWaitPollSourcesPOSIX(double* timeout)
+{
+    for (int i = 0; i < _grwl.poll.sourceCount; i++)
+    {
+        _grwl.poll.sources[i].revents = 0;
+    }
+
+    #if defined(__linux__)
+    return waitEpoll(timeout);
+    #else
+    // Sources are few, so build the array on the stack for each wait
+    struct pollfd fds[64];
+    nfds_t count = 0;
+
+    for (int i = 0; i < _grwl.poll.sourceCount && count < sizeof(fds) / sizeof(fds[0]); i++)
+    {
+        fds[count].fd = _grwl.poll.sources[i].fd;
+        fds[count].events = _grwl.poll.sources[i].events;
+        fds[count].revents = 0;
+        count++;
+    }
+
+    if (!_grwlPollPOSIX(fds, count, timeout))
+    {
+        return false;
+    }
+
+    for (nfds_t i = 0; i < count; i++)
+    {
+        _GRWLpollsourcePOSIX* source = findSource(fds[i].fd);
+        if (source)
+        {
+            source->revents = fds[i].revents & (POLLIN | POLLOUT);
+            if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL))
+            {
+                source->revents |= POLLERR;
+            }
+        }
+    }
+
+    return true;
+    #endif
+}
+
+// Returns whether the source with the specified fd was ready after the last wait
+//
+bool _grwlIsPollSourceReadyPOSIX(int fd)
+{
+    const _GRWLpollsourcePOSIX* source = findSource(fd);
+    return source && source->revents;
+}
+
+// Calls the handlers and watch callbacks of the sources that were ready after
+// the last wait
+// Returns whether any handler or callback was called
+//
+bool _grwlDispatchPollSourcesPOSIX()
+{
+    bool handled = false;
+
+    for (int i = 0; i < _grwl.poll.sourceCount; i++)
+    {
+        _GRWLpollsourcePOSIX* source = _grwl.poll.sources + i;
+        if (!source->revents || (!source->handler && !source->callback))
+        {
+            continue;
+        }
+
+        const short revents = source->revents;
+        source->revents = 0;
+
+        if (source->handler)
+        {
+            source->handler(source->fd);
+        }
+        else
+        {
+            int events = 0;
+
+            if (revents & POLLIN)
+            {
+                events |= GRWL_WATCH_READ;
+            }
+            if (revents & POLLOUT)
+            {
+                events |= GRWL_WATCH_WRITE;
+            }
+            if (revents & POLLERR)
+            {
+                events |= GRWL_WATCH_ERROR;
+            }
+
+            _grwlBeginCallback();
+            source->callback(source->fd, events, source->user);
+            _grwlEndCallback();
+        }
+
+        handled = true;
+
+        // The handler may have added or removed sources, so start over
+        i = -1;
+    }
+
+    return handled;
+}
+
+// Wakes up a blocking wait, from any thread
+//
+void _grwlPostEmptyEventPOSIX()
+{
+    for (;;)
+    {
+        const uint64_t value = 1;
+        const ssize_t result = write(_grwl.poll.wakeup[1], &value, sizeof(value));
+        if (result == sizeof(value) || (result == -1 && errno != EINTR))
+        {
+            break;
+        }
+    }
+}
+
 #endif // GRWL_BUILD_POSIX_POLL
@@ -3,6 +3,54 @@
 // See file LICENSE.md for full license details
 //===========================================================================
 
+#pragma once
+
 #include <poll.h>
 
+#define GRWL_POSIX_LIBRARY_POLL_STATE _GRWLpollPOSIX poll;
+
+// Called for an event source that has become readable
+typedef void (*_GRWLpollhandlerfun)(int fd);
+
+// A file descriptor waited on by the event loop
+//
+typedef struct _GRWLpollsourcePOSIX
+{
+    int fd;
+    // The poll(2) events waited for and the events of the last wait
+    short events;
+    short revents;
+    // Called by _grwlDispatchPollSourcesPOSIX, or nullptr if the platform
+    // checks readiness with _grwlIsPollSourceReadyPOSIX instead
+    _GRWLpollhandlerfun handler;
+    // The user callback of an fd added with grwlAddWatchFd
+    GRWLwatchfun callback;
+    void* user;
+} _GRWLpollsourcePOSIX;
+
+// POSIX-specific event loop data
+//
+typedef struct _GRWLpollPOSIX
+{
+    bool initialized;
+    _GRWLpollsourcePOSIX* sources;
+    int sourceCount;
+    // The epoll instance holding every source, or -1 if epoll is not used
+    int epoll;
+    // The eventfd, or the read and write ends of the pipe, used for wakeups
+    int wakeup[2];
+} _GRWLpollPOSIX;
+
 bool _grwlPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
+
+bool _grwlInitPollPOSIX();
+void _grwlTerminatePollPOSIX();
+bool _grwlAddPollSourcePOSIX(int fd, _GRWLpollhandlerfun handler);
+bool _grwlAddWritePollSourcePOSIX(int fd, _GRWLpollhandlerfun handler);
+void _grwlRemovePollSourcePOSIX(int fd);
+bool _grwlAddWatchPOSIX(int fd, int events, GRWLwatchfun callback, void* user);
+bool _grwlRemoveWatchPOSIX(int fd);
+bool _grwlWaitPollSourcesPOSIX(double* timeout);
+bool _grwlIsPollSourceReadyPOSIX(int fd);
+bool _grwlDispatchPollSourcesPOSIX();
+void _grwlPostEmptyEventPOSIX();
@@ -368,6 +368,9 @@ bool _grwlConnectWayland(int platformID, _GRWLplatform* platform)
         _grwlGetKeyboardLayoutNameWayland,
         _grwlSetClipboardStringWayland,
         _grwlGetClipboardStringWayland,
+        _grwlRequestClipboardStringWayland,
+        _grwlSetClipboardDataWayland,
+        _grwlGetClipboardDataWayland,
         _grwlUpdatePreeditCursorRectangleWayland,
         _grwlResetPreeditTextWayland,
         _grwlSetIMEStatusWayland,
@@ -490,6 +493,8 @@ int _grwlInitWayland()
     // These must be set before any failure checks
     _grwl.wl.keyRepeatTimerfd = -1;
     _grwl.wl.cursorTimerfd = -1;
+    _grwl.wl.clipboardTransfer.fd = -1;
+    _grwl.wl.dropTransfer.fd = -1;
 
     _grwl.wl.tag = grwlGetVersionString();
 
@@ -778,11 +783,45 @@ int _grwlInitWayland()
         _grwlAddDataDeviceListenerWayland(_grwl.wl.dataDevice);
     }
 
+    // The display and timers are handled by the event loop itself, as reading
+    // the display must be prepared before waiting
+    if (!_grwlInitPollPOSIX() || !_grwlAddPollSourcePOSIX(wl_display_get_fd(_grwl.wl.display), nullptr) ||
+        !_grwlAddPollSourcePOSIX(_grwl.wl.cursorTimerfd, nullptr))
+    {
+        return false;
+    }
+
+    if (_grwl.wl.keyRepeatTimerfd >= 0)
+    {
+        if (!_grwlAddPollSourcePOSIX(_grwl.wl.keyRepeatTimerfd, nullptr))
+        {
+            return false;
+        }
+    }
+
+    if (_grwl.wl.libdecor.context)
+    {
+        if (!_grwlAddPollSourcePOSIX(libdecor_get_fd(_grwl.wl.libdecor.context), nullptr))
+        {
+            return false;
+        }
+    }
+
+    if (_grwl.hints.init.inputThread)
+    {
+        if (!_grwlStartDisplayReaderWayland())
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
 void _grwlTerminateWayland()
 {
+    _grwlStopDisplayReaderWayland();
+
     _grwlTerminateEGL();
     _grwlTerminateOSMesa();
 
@@ -842,9 +881,11 @@ void _grwlTerminateWayland()
     for (unsigned int i = 0; i < _grwl.wl.offerCount; i++)
     {
         wl_data_offer_destroy(_grwl.wl.offers[i].offer);
+        _grwl_free(_grwl.wl.offers[i].types);
     }
 
     _grwl_free(_grwl.wl.offers);
+    _grwl_free(_grwl.wl.selectionTypes);
 
     if (_grwl.wl.cursorSurface)
     {
@@ -882,6 +923,10 @@ void _grwlTerminateWayland()
     {
         wl_data_offer_destroy(_grwl.wl.dragOffer);
     }
+    if (_grwl.wl.dropTransfer.offer)
+    {
+        wl_data_offer_destroy(_grwl.wl.dropTransfer.offer);
+    }
     if (_grwl.wl.selectionSource)
     {
         wl_data_source_destroy(_grwl.wl.selectionSource);
@@ -948,8 +993,38 @@ void _grwlTerminateWayland()
     {
         close(_grwl.wl.cursorTimerfd);
     }
+    if (_grwl.wl.clipboardTransfer.fd >= 0)
+    {
+        close(_grwl.wl.clipboardTransfer.fd);
+    }
+    if (_grwl.wl.dropTransfer.fd >= 0)
+    {
+        close(_grwl.wl.dropTransfer.fd);
+    }
+
+    for (int i = 0; i < _grwl.wl.sendCount; i++)
+    {
+        close(_grwl.wl.sends[i].fd);
+
+        if (_grwl.wl.sends[i].ownsData)
+        {
+            _grwl_free(_grwl.wl.sends[i].data);
+        }
+    }
+
+    _grwlTerminatePollPOSIX();
+
+    if (_grwl.wl.clipboardDataMapping)
+    {
+        munmap(_grwl.wl.clipboardDataMapping, _grwl.wl.clipboardDataMappingSize);
+    }
 
     _grwl_free(_grwl.wl.clipboardString);
+    _grwl_free(_grwl.wl.clipboardData);
+    _grwl_free(_grwl.wl.clipboardDataType);
+    _grwl_free(_grwl.wl.clipboardTransfer.buffer);
+    _grwl_free(_grwl.wl.dropTransfer.buffer);
+    _grwl_free(_grwl.wl.sends);
     _grwl_free(_grwl.wl.keyboardLayoutName);
 
     _grwlTerminateDBusPOSIX();
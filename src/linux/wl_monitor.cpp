@@ -84,8 +84,9 @@ static void outputHandleScale(void* userData, struct wl_output* output, int32_t
 
     monitor->wl.contentScale = factor;
 
-    for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+    for (int j = 0; j < _grwl.windowCount; j++)
     {
+        _GRWLwindow* window = _grwl.windows[j];
         for (int i = 0; i < window->wl.scaleCount; i++)
         {
             if (window->wl.scales[i].output == monitor->wl.output)
@@ -343,8 +343,44 @@ typedef struct _GRWLofferWayland
     struct wl_data_offer* offer;
     bool text_plain_utf8;
     bool text_uri_list;
+    // Every offered MIME type, each terminated by a null byte
+    char* types;
+    size_t typesLength;
 } _GRWLofferWayland;
 
+// Wayland-specific incoming data offer transfer, read by the event loop as the
+// data arrives
+//
+typedef struct _GRWLtransferWayland
+{
+    // The read end of the pipe, or -1 if no transfer is in progress
+    int fd;
+    // The data offer of a drop, kept until the transfer has finished
+    struct wl_data_offer* offer;
+    // The data read so far, in a buffer that grows geometrically
+    char* buffer;
+    size_t length;
+    size_t capacity;
+    // The window receiving a drop
+    _GRWLwindow* window;
+    // The string delivered by the last finished transfer, or nullptr
+    const char* result;
+} _GRWLtransferWayland;
+
+// Wayland-specific outgoing clipboard transfer, written by the event loop as
+// the receiving client reads it
+//
+typedef struct _GRWLsendWayland
+{
+    int fd;
+    // The string being sent, shared with the clipboard until it is replaced
+    char* data;
+    size_t length;
+    size_t offset;
+    // Whether this transfer frees the string once it is done
+    bool ownsData;
+} _GRWLsendWayland;
+
 typedef struct _GRWLscaleWayland
 {
     struct wl_output* output;
@@ -426,7 +462,9 @@ typedef struct _GRWLwindowWayland
     struct
     {
         char* preeditText;
+        size_t preeditTextSize;
         char* commitTextOnReset;
+        size_t commitTextOnResetSize;
     } textInputV1Context;
 } _GRWLwindowWayland;
 
@@ -458,6 +496,9 @@ typedef struct _GRWLlibraryWayland
     unsigned int offerCount;
 
     struct wl_data_offer* selectionOffer;
+    // The MIME types of the selection offer, each terminated by a null byte
+    char* selectionTypes;
+    size_t selectionTypesLength;
     struct wl_data_source* selectionSource;
 
     struct wl_data_offer* dragOffer;
@@ -480,6 +521,23 @@ typedef struct _GRWLlibraryWayland
     int keyRepeatScancode;
 
     char* clipboardString;
+    size_t clipboardStringSize;
+    // Clipboard data and its MIME type, or nullptr if the clipboard holds the
+    // string
+    char* clipboardData;
+    size_t clipboardDataLength;
+    size_t clipboardDataSize;
+    char* clipboardDataType;
+    // Read-only mapping of the clipboard data received last
+    void* clipboardDataMapping;
+    size_t clipboardDataMappingSize;
+    // Incoming transfers of the clipboard and of drops
+    _GRWLtransferWayland clipboardTransfer;
+    _GRWLtransferWayland dropTransfer;
+    // Outgoing transfers of the clipboard while we own it
+    _GRWLsendWayland* sends;
+    int sendCount;
+    size_t sendArraySize;
     char* keyboardLayoutName;
     short int keycodes[256];
     short int scancodes[GRWL_KEY_LAST + 1];
@@ -638,7 +696,7 @@ bool _grwlCreateWindowWayland(_GRWLwindow* window, const _GRWLwndconfig* wndconf
                               const _GRWLfbconfig* fbconfig);
 void _grwlDestroyWindowWayland(_GRWLwindow* window);
 void _grwlSetWindowTitleWayland(_GRWLwindow* window, const char* title);
-void _grwlSetWindowIconWayland(_GRWLwindow* window, int count, const GRWLimage* images);
+void _grwlSetWindowIconWayland(_GRWLwindow* window, int count, const GRWLformattedimage* images);
 void _grwlSetWindowProgressIndicatorWayland(_GRWLwindow* window, int progressState, double value);
 void _grwlSetWindowBadgeWayland(_GRWLwindow* window, int count);
 void _grwlSetWindowBadgeStringWayland(_GRWLwindow* window, const char* string);
@@ -687,12 +745,15 @@ void _grwlSetCursorModeWayland(_GRWLwindow* window, int mode);
 const char* _grwlGetScancodeNameWayland(int scancode);
 int _grwlGetKeyScancodeWayland(int key);
 const char* _grwlGetKeyboardLayoutNameWayland();
-bool _grwlCreateCursorWayland(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot);
+bool _grwlCreateCursorWayland(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot);
 bool _grwlCreateStandardCursorWayland(_GRWLcursor* cursor, int shape);
 void _grwlDestroyCursorWayland(_GRWLcursor* cursor);
 void _grwlSetCursorWayland(_GRWLwindow* window, _GRWLcursor* cursor);
 void _grwlSetClipboardStringWayland(const char* string);
 const char* _grwlGetClipboardStringWayland();
+bool _grwlRequestClipboardStringWayland();
+void _grwlSetClipboardDataWayland(const char* mimeType, const void* data, size_t size);
+const void* _grwlGetClipboardDataWayland(const char* mimeType, size_t* size);
 
 void _grwlUpdatePreeditCursorRectangleWayland(_GRWLwindow* window);
 void _grwlResetPreeditTextWayland(_GRWLwindow* window);
@@ -723,4 +784,7 @@ _GRWLusercontext* _grwlCreateUserContextWayland(_GRWLwindow* window);
 
 void _grwlAddSeatListenerWayland(struct wl_seat* seat);
 void _grwlAddDataDeviceListenerWayland(struct wl_data_device* device);
+
+bool _grwlStartDisplayReaderWayland();
+void _grwlStopDisplayReaderWayland();
 #endif
@@ -16,8 +16,11 @@
     #include <fcntl.h>
     #include <sys/mman.h>
     #include <sys/timerfd.h>
+    #include <sys/eventfd.h>
     #include <poll.h>
 
+    #include <atomic>
+
     #include "wayland-client-protocol.h"
     #include "wayland-xdg-shell-client-protocol.h"
     #include "wayland-xdg-decoration-client-protocol.h"
@@ -113,7 +116,9 @@ static int createAnonymousFile(off_t size)
     // posix_fallocate does not work on SHM descriptors
     ret = ftruncate(fd, size);
     #else
-    ret = posix_fallocate(fd, 0, size);
+    // posix_fallocate fails for an empty range, in which case the file is left
+    // to grow as it is written
+    ret = size > 0 ? posix_fallocate(fd, 0, size) : 0;
     #endif
     if (ret != 0)
     {
@@ -124,7 +129,7 @@ static int createAnonymousFile(off_t size)
     return fd;
 }
 
-static struct wl_buffer* createShmBuffer(const GRWLimage* image)
+static struct wl_buffer* createShmBuffer(const GRWLformattedimage* image)
 {
     const int stride = image->width * 4;
     const int length = image->width * image->height * 4;
@@ -149,17 +154,8 @@ static struct wl_buffer* createShmBuffer(const GRWLimage* image)
 
     close(fd);
 
-    unsigned char* source = (unsigned char*)image->pixels;
-    unsigned char* target = data;
-    for (int i = 0; i < image->width * image->height; i++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target++ = (unsigned char)((source[2] * alpha) / 255);
-        *target++ = (unsigned char)((source[1] * alpha) / 255);
-        *target++ = (unsigned char)((source[0] * alpha) / 255);
-        *target++ = (unsigned char)alpha;
-    }
+    // WL_SHM_FORMAT_ARGB8888 is little-endian and premultiplied
+    _grwlConvertImage(data, GRWL_IMAGE_BGRA_PREMULTIPLIED, image);
 
     struct wl_buffer* buffer =
         wl_shm_pool_create_buffer(pool, 0, image->width, image->height, stride, WL_SHM_FORMAT_ARGB8888);
@@ -191,7 +187,7 @@ static void createFallbackDecoration(_GRWLwindow* window, _GRWLdecorationWayland
 static void createFallbackDecorations(_GRWLwindow* window)
 {
     unsigned char data[] = { 224, 224, 224, 255 };
-    const GRWLimage image = { 1, 1, data };
+    const GRWLformattedimage image = { 1, 1, data };
 
     if (!_grwl.wl.viewporter)
     {
@@ -800,6 +796,7 @@ static bool createLibdecorFrame(_GRWLwindow* window)
     }
 
     libdecor_frame_map(window->wl.libdecor.frame);
+    _grwl.stats.roundTrips++;
     wl_display_roundtrip(_grwl.wl.display);
     return true;
 }
@@ -905,6 +902,7 @@ static bool createXdgShellObjects(_GRWLwindow* window)
     }
 
     wl_surface_commit(window->wl.surface);
+    _grwl.stats.roundTrips++;
     wl_display_roundtrip(_grwl.wl.display);
     return true;
 }
@@ -1069,6 +1067,24 @@ static bool flushDisplay()
     return true;
 }
 
+// Copies the specified string into the specified reused buffer
+//
+static bool storeString(char** buffer, size_t* capacity, const char* string)
+{
+    const size_t size = strlen(string) + 1;
+
+    // The string may already be in the buffer, in which case it fits
+    char* target = (char*)_grwlReserveBuffer(*buffer, capacity, size);
+    if (!target)
+    {
+        return false;
+    }
+
+    *buffer = target;
+    memmove(target, string, size);
+    return true;
+}
+
 static int translateKey(uint32_t scancode)
 {
     if (scancode < sizeof(_grwl.wl.keycodes) / sizeof(_grwl.wl.keycodes[0]))
@@ -1120,69 +1136,187 @@ static void inputText(_GRWLwindow* window, uint32_t scancode)
     }
 }
 
-static void handleEvents(double* timeout)
+// The thread reading the display connection when the input thread init hint is
+// set
+//
+static struct
+{
+    bool running;
+    _GRWLthread thread;
+    // Written to wake the thread, to stop it or once queued events have been
+    // dispatched
+    int wakeup;
+    std::atomic<bool> stopping;
+    // Whether the thread is waiting for the main thread to dispatch events
+    std::atomic<bool> waiting;
+} _grwlDisplayReaderWayland;
+
+// Waits until the display reader is woken by the main thread
+//
+static void waitDisplayReader()
 {
-    #if defined(GRWL_BUILD_LINUX_JOYSTICK)
-    if (_grwl.joysticksInitialized)
+    struct pollfd fd = { _grwlDisplayReaderWayland.wakeup, POLLIN, 0 };
+    while (poll(&fd, 1, -1) == -1 && errno == EINTR)
     {
-        _grwlDetectJoystickConnectionLinux();
     }
-    #endif
 
-    bool event = false;
-    struct pollfd fds[4] = { { wl_display_get_fd(_grwl.wl.display), POLLIN },
-                             { _grwl.wl.keyRepeatTimerfd, POLLIN },
-                             { _grwl.wl.cursorTimerfd, POLLIN },
-                             { -1, POLLIN } };
+    uint64_t value;
+    while (read(_grwlDisplayReaderWayland.wakeup, &value, sizeof(value)) == -1 && errno == EINTR)
+    {
+    }
+}
 
-    if (_grwl.wl.libdecor.context)
+// Reads display events into the event queue as they arrive
+// Only the main thread dispatches them, but they no longer wait in the socket
+// while it is busy.  The main thread takes part in the same read protocol, so
+// whichever thread is waiting when data arrives reads it
+//
+static void displayReaderMain(void* user)
+{
+    struct wl_display* display = _grwl.wl.display;
+    struct pollfd fds[] = { { wl_display_get_fd(display), POLLIN, 0 },
+                            { _grwlDisplayReaderWayland.wakeup, POLLIN, 0 } };
+
+    while (!_grwlDisplayReaderWayland.stopping.load(std::memory_order_acquire))
+    {
+        if (wl_display_prepare_read(display) != 0)
+        {
+            // Reading is only possible once the queued events are dispatched
+            _grwlDisplayReaderWayland.waiting.store(true);
+            if (wl_display_prepare_read(display) != 0)
+            {
+                _grwlPostEmptyEventPOSIX();
+                waitDisplayReader();
+                continue;
+            }
+        }
+
+        if (poll(fds, sizeof(fds) / sizeof(fds[0]), -1) == -1)
+        {
+            wl_display_cancel_read(display);
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            // The main thread is woken above once the events are queued, unless
+            // it dispatches them first
+            if (wl_display_read_events(display) == -1)
+            {
+                // Leave handling the error to the main thread
+                _grwlPostEmptyEventPOSIX();
+                break;
+            }
+        }
+        else
+        {
+            wl_display_cancel_read(display);
+
+            if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+            {
+                _grwlPostEmptyEventPOSIX();
+                break;
+            }
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            uint64_t value;
+            while (read(_grwlDisplayReaderWayland.wakeup, &value, sizeof(value)) == -1 && errno == EINTR)
+            {
+            }
+        }
+    }
+}
+
+// Wakes the display reader if it is waiting for queued events to be dispatched
+//
+static void notifyDisplayReader()
+{
+    if (_grwlDisplayReaderWayland.waiting.exchange(false))
     {
-        fds[3].fd = libdecor_get_fd(_grwl.wl.libdecor.context);
+        const uint64_t value = 1;
+        while (write(_grwlDisplayReaderWayland.wakeup, &value, sizeof(value)) == -1 && errno == EINTR)
+        {
+        }
     }
+}
+
+static void handleEvents(double* timeout)
+{
+    _GRWL_TRACE_ZONE("handleEvents");
+
+    bool event = false;
 
     while (!event)
     {
         while (wl_display_prepare_read(_grwl.wl.display) != 0)
         {
-            wl_display_dispatch_pending(_grwl.wl.display);
+            const int count = wl_display_dispatch_pending(_grwl.wl.display);
+            if (count > 0)
+            {
+                _grwl.stats.events += count;
+            }
+        }
+
+        if (_grwlDisplayReaderWayland.running)
+        {
+            notifyDisplayReader();
         }
 
+        _grwl.eventTime = 0;
+
         // If an error other than EAGAIN happens, we have likely been disconnected
         // from the Wayland session; try to handle that the best we can.
         if (!flushDisplay())
         {
             wl_display_cancel_read(_grwl.wl.display);
 
-            _GRWLwindow* window = _grwl.windowListHead;
-            while (window)
+            // Iterate backwards as the close callback may destroy the window
+            for (int i = _grwl.windowCount - 1; i >= 0; i--)
             {
-                _grwlInputWindowCloseRequest(window);
-                window = window->next;
+                _grwlInputWindowCloseRequest(_grwl.windows[i]);
             }
 
             return;
         }
 
-        if (!_grwlPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
+        if (!_grwlWaitPollSourcesPOSIX(timeout))
         {
             wl_display_cancel_read(_grwl.wl.display);
             return;
         }
 
-        if (fds[0].revents & POLLIN)
+        if (_grwlIsPollSourceReadyPOSIX(wl_display_get_fd(_grwl.wl.display)))
         {
             wl_display_read_events(_grwl.wl.display);
-            if (wl_display_dispatch_pending(_grwl.wl.display) > 0)
+
+            const int count = wl_display_dispatch_pending(_grwl.wl.display);
+            if (count > 0)
             {
+                _grwl.stats.events += count;
                 event = true;
             }
+
+            _grwl.eventTime = 0;
         }
         else
         {
             wl_display_cancel_read(_grwl.wl.display);
         }
 
-        if (fds[1].revents & POLLIN)
+        // Wakeups and joystick input
+        if (_grwlDispatchPollSourcesPOSIX())
+        {
+            event = true;
+        }
+
+        if (_grwl.wl.keyRepeatTimerfd >= 0 && _grwlIsPollSourceReadyPOSIX(_grwl.wl.keyRepeatTimerfd))
         {
             uint64_t repeats;
 
@@ -1199,7 +1333,7 @@ static void handleEvents(double* timeout)
             }
         }
 
-        if (fds[2].revents & POLLIN)
+        if (_grwlIsPollSourceReadyPOSIX(_grwl.wl.cursorTimerfd))
         {
             uint64_t repeats;
 
@@ -1210,55 +1344,75 @@ static void handleEvents(double* timeout)
             }
         }
 
-        if (fds[3].revents & POLLIN)
+        if (_grwl.wl.libdecor.context && _grwlIsPollSourceReadyPOSIX(libdecor_get_fd(_grwl.wl.libdecor.context)))
         {
             libdecor_dispatch(_grwl.wl.libdecor.context, 0);
         }
     }
 }
 
-// Reads the specified data offer as the specified MIME type
+// Finishes the specified transfer and delivers its data, or reports that it
+// failed if not all of the data could be read
 //
-static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mimeType)
+static void finishTransfer(_GRWLtransferWayland* transfer, bool succeeded)
 {
-    int fds[2];
+    _grwlRemovePollSourcePOSIX(transfer->fd);
+    close(transfer->fd);
+    transfer->fd = -1;
 
-    if (pipe2(fds, O_CLOEXEC) == -1)
+    if (transfer == &_grwl.wl.dropTransfer)
     {
-        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to create pipe for data offer: %s", strerror(errno));
-        return nullptr;
-    }
-
-    wl_data_offer_receive(offer, mimeType, fds[1]);
-    flushDisplay();
-    close(fds[1]);
+        _GRWLwindow* window = transfer->window;
+        transfer->window = nullptr;
 
-    char* string = nullptr;
-    size_t size = 0;
-    size_t length = 0;
+        wl_data_offer_destroy(transfer->offer);
+        transfer->offer = nullptr;
 
-    for (;;)
-    {
-        const size_t readSize = 4096;
-        const size_t requiredSize = length + readSize + 1;
-        if (requiredSize > size)
+        if (succeeded && window)
         {
-            char* longer = _grwl_realloc(string, requiredSize);
-            if (!longer)
+            int count;
+            char** paths = _grwlParseUriList(transfer->buffer, &count);
+
+            if (paths)
             {
-                _grwlInputError(GRWL_OUT_OF_MEMORY, nullptr);
-                close(fds[0]);
-                return nullptr;
+                _grwlInputDrop(window, count, (const char**)paths);
             }
+        }
+
+        return;
+    }
 
-            string = longer;
-            size = requiredSize;
+    // The buffer is only reused by the next transfer, so the string stays valid
+    // for as long as the string returned by grwlGetClipboardString must
+    transfer->result = succeeded ? transfer->buffer : nullptr;
+    _grwlInputClipboardString(transfer->result);
+}
+
+// Reads the data that is available for the specified transfer, finishing the
+// transfer once the source has closed its end of the pipe
+//
+static void readTransfer(_GRWLtransferWayland* transfer)
+{
+    for (;;)
+    {
+        const size_t readSize = 65536;
+
+        char* buffer =
+            (char*)_grwlReserveBuffer(transfer->buffer, &transfer->capacity, transfer->length + readSize + 1);
+        if (!buffer)
+        {
+            finishTransfer(transfer, false);
+            return;
         }
 
-        const ssize_t result = read(fds[0], string + length, readSize);
+        transfer->buffer = buffer;
+
+        const ssize_t result = read(transfer->fd, buffer + transfer->length, readSize);
         if (result == 0)
         {
-            break;
+            buffer[transfer->length] = '\0';
+            finishTransfer(transfer, true);
+            return;
         }
         else if (result == -1)
         {
@@ -1267,18 +1421,66 @@ static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mime
                 continue;
             }
 
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return;
+            }
+
             _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to read from data offer pipe: %s", strerror(errno));
-            close(fds[0]);
-            return nullptr;
+            finishTransfer(transfer, false);
+            return;
         }
 
-        length += result;
+        transfer->length += result;
     }
+}
 
-    close(fds[0]);
+// Reads the data that has arrived on the pipe of a transfer
+//
+static void handleTransferReadable(int fd)
+{
+    if (fd == _grwl.wl.clipboardTransfer.fd)
+    {
+        readTransfer(&_grwl.wl.clipboardTransfer);
+    }
+    else if (fd == _grwl.wl.dropTransfer.fd)
+    {
+        readTransfer(&_grwl.wl.dropTransfer);
+    }
+}
+
+// Starts reading the specified data offer as the specified MIME type
+// The data is read by the event loop as it arrives
+//
+static bool beginTransfer(_GRWLtransferWayland* transfer, struct wl_data_offer* offer, const char* mimeType)
+{
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC) == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to create pipe for data offer: %s", strerror(errno));
+        return false;
+    }
+
+    // Only our end is made non-blocking, as the source may not handle short
+    // writes
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+    if (!_grwlAddPollSourcePOSIX(fds[0], handleTransferReadable))
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
 
-    string[length] = '\0';
-    return string;
+    wl_data_offer_receive(offer, mimeType, fds[1]);
+    flushDisplay();
+    close(fds[1]);
+
+    transfer->fd = fds[0];
+    transfer->length = 0;
+    transfer->result = nullptr;
+    return true;
 }
 
 static void pointerHandleEnter(void* userData, struct wl_pointer* pointer, uint32_t serial, struct wl_surface* surface,
@@ -1356,6 +1558,8 @@ static void pointerHandleLeave(void* userData, struct wl_pointer* pointer, uint3
 
 static void pointerHandleMotion(void* userData, struct wl_pointer* pointer, uint32_t time, wl_fixed_t sx, wl_fixed_t sy)
 {
+    _grwl.eventTime = _grwlConvertEventTime(time);
+
     _GRWLwindow* window = _grwl.wl.pointerFocus;
     if (!window)
     {
@@ -1479,6 +1683,8 @@ static void pointerHandleButton(void* userData, struct wl_pointer* pointer, uint
     int grwlButton;
     uint32_t edges = XDG_TOPLEVEL_RESIZE_EDGE_NONE;
 
+    _grwl.eventTime = _grwlConvertEventTime(time);
+
     if (!window)
     {
         return;
@@ -1584,6 +1790,8 @@ static void pointerHandleAxis(void* userData, struct wl_pointer* pointer, uint32
     // step means 1.0.
     const double scrollFactor = 1.0 / 10.0;
 
+    _grwl.eventTime = _grwlConvertEventTime(time);
+
     if (!window)
     {
         return;
@@ -1742,6 +1950,8 @@ static void keyboardHandleKey(void* userData, struct wl_keyboard* keyboard, uint
                               uint32_t scancode, uint32_t state)
 {
     _GRWLwindow* window = _grwl.wl.keyboardFocus;
+    _grwl.eventTime = _grwlConvertEventTime(time);
+
     if (!window)
     {
         return;
@@ -1893,6 +2103,15 @@ static void dataOfferHandleOffer(void* userData, struct wl_data_offer* offer, co
                 _grwl.wl.offers[i].text_uri_list = true;
             }
 
+            const size_t size = strlen(mimeType) + 1;
+            char* types = (char*)_grwl_realloc(_grwl.wl.offers[i].types, _grwl.wl.offers[i].typesLength + size);
+            if (types)
+            {
+                memcpy(types + _grwl.wl.offers[i].typesLength, mimeType, size);
+                _grwl.wl.offers[i].types = types;
+                _grwl.wl.offers[i].typesLength += size;
+            }
+
             break;
         }
     }
@@ -1947,6 +2166,7 @@ static void dataDeviceHandleEnter(void* userData, struct wl_data_device* device,
                 _grwl.wl.dragSerial = serial;
             }
 
+            _grwl_free(_grwl.wl.offers[i].types);
             _grwl.wl.offers[i] = _grwl.wl.offers[_grwl.wl.offerCount - 1];
             _grwl.wl.offerCount--;
             break;
@@ -1991,25 +2211,27 @@ static void dataDeviceHandleDrop(void* userData, struct wl_data_device* device)
         return;
     }
 
-    char* string = readDataOfferAsString(_grwl.wl.dragOffer, "text/uri-list");
-    if (string)
-    {
-        int count;
-        char** paths = _grwlParseUriList(string, &count);
-        if (paths)
-        {
-            _grwlInputDrop(_grwl.wl.dragFocus, count, (const char**)paths);
-        }
+    _GRWLtransferWayland* transfer = &_grwl.wl.dropTransfer;
 
-        for (int i = 0; i < count; i++)
-        {
-            _grwl_free(paths[i]);
-        }
+    // A new drop replaces any earlier one whose data has not yet arrived
+    if (transfer->fd != -1)
+    {
+        finishTransfer(transfer, false);
+    }
 
-        _grwl_free(paths);
+    // The transfer takes over the offer, so that it outlives the drag
+    if (beginTransfer(transfer, _grwl.wl.dragOffer, "text/uri-list"))
+    {
+        transfer->offer = _grwl.wl.dragOffer;
+        transfer->window = _grwl.wl.dragFocus;
+    }
+    else
+    {
+        wl_data_offer_destroy(_grwl.wl.dragOffer);
     }
 
-    _grwl_free(string);
+    _grwl.wl.dragOffer = nullptr;
+    _grwl.wl.dragFocus = nullptr;
 }
 
 static void dataDeviceHandleSelection(void* userData, struct wl_data_device* device, struct wl_data_offer* offer)
@@ -2020,18 +2242,19 @@ static void dataDeviceHandleSelection(void* userData, struct wl_data_device* dev
         _grwl.wl.selectionOffer = nullptr;
     }
 
+    _grwl_free(_grwl.wl.selectionTypes);
+    _grwl.wl.selectionTypes = nullptr;
+    _grwl.wl.selectionTypesLength = 0;
+
     for (unsigned int i = 0; i < _grwl.wl.offerCount; i++)
     {
         if (_grwl.wl.offers[i].offer == offer)
         {
-            if (_grwl.wl.offers[i].text_plain_utf8)
-            {
-                _grwl.wl.selectionOffer = offer;
-            }
-            else
-            {
-                wl_data_offer_destroy(offer);
-            }
+            // Offers of any type are kept, as clipboard data may be requested
+            // as any of them
+            _grwl.wl.selectionOffer = offer;
+            _grwl.wl.selectionTypes = _grwl.wl.offers[i].types;
+            _grwl.wl.selectionTypesLength = _grwl.wl.offers[i].typesLength;
 
             _grwl.wl.offers[i] = _grwl.wl.offers[_grwl.wl.offerCount - 1];
             _grwl.wl.offerCount--;
@@ -2095,7 +2318,7 @@ static void textInputV3PreeditString(void* data, struct zwp_text_input_v3* textI
 {
     _GRWLwindow* window = (_GRWLwindow*)data;
     _GRWLpreedit* preedit = &window->preedit;
-    const char* cur = text;
+    const size_t length = text ? strlen(text) : 0;
     unsigned int cursorLength = 0;
 
     preedit->textCount = 0;
@@ -2104,26 +2327,14 @@ static void textInputV3PreeditString(void* data, struct zwp_text_input_v3* textI
     preedit->caretIndex = 0;
 
     // Store preedit text
-    while (cur && *cur)
+    if (length)
     {
-        uint32_t codepoint = _grwlDecodeUTF8(&cur);
-
-        ++preedit->textCount;
-
-        if (cur == text + cursorBegin)
-        {
-            preedit->caretIndex = preedit->textCount;
-        }
-        if (cursorBegin != cursorEnd && cur == text + cursorEnd)
-        {
-            cursorLength = preedit->textCount - cursorBegin;
-        }
-
-        if (preedit->textBufferCount < preedit->textCount + 1)
+        // The decoded text has at most as many code points as bytes
+        if (preedit->textBufferCount < (int)length + 1)
         {
             int bufSize = preedit->textBufferCount;
 
-            while (bufSize < preedit->textCount + 1)
+            while (bufSize < (int)length + 1)
             {
                 bufSize = (bufSize == 0) ? 1 : bufSize * 2;
             }
@@ -2134,7 +2345,18 @@ static void textInputV3PreeditString(void* data, struct zwp_text_input_v3* textI
             }
             preedit->textBufferCount = bufSize;
         }
-        preedit->text[preedit->textCount - 1] = codepoint;
+
+        preedit->textCount = (int)_grwlDecodeUTF8(preedit->text, text, length);
+
+        // The cursor is given as byte offsets into the text
+        if (cursorBegin > 0 && (size_t)cursorBegin <= length)
+        {
+            preedit->caretIndex = (int)_grwlCountUTF8(text, cursorBegin);
+        }
+        if (cursorBegin >= 0 && cursorEnd > cursorBegin && (size_t)cursorEnd <= length)
+        {
+            cursorLength = (unsigned int)_grwlCountUTF8(text + cursorBegin, cursorEnd - cursorBegin);
+        }
     }
     if (preedit->text)
     {
@@ -2182,12 +2404,20 @@ static void textInputV3PreeditString(void* data, struct zwp_text_input_v3* textI
 static void textInputV3CommitString(void* data, struct zwp_text_input_v3* textInputV3, const char* text)
 {
     _GRWLwindow* window = (_GRWLwindow*)data;
-    const char* cur = text;
+    const size_t length = text ? strlen(text) : 0;
 
-    while (cur && *cur)
+    uint32_t* codepoints = (uint32_t*)_grwlArenaAlloc(length * sizeof(uint32_t));
+    if (!codepoints)
     {
-        uint32_t codepoint = _grwlDecodeUTF8(&cur);
-        window->callbacks.character((GRWLwindow*)window, codepoint);
+        return;
+    }
+
+    const size_t count = _grwlDecodeUTF8(codepoints, text, length);
+    for (size_t i = 0; i < count; i++)
+    {
+        _grwlBeginCallback();
+        window->callbacks.character((GRWLwindow*)window, codepoints[i]);
+        _grwlEndCallback();
     }
 }
 
@@ -2231,10 +2461,10 @@ static void textInputV1Reset(_GRWLwindow* window)
     preedit->focusedBlockIndex = 0;
     preedit->caretIndex = 0;
 
-    _grwl_free(window->wl.textInputV1Context.preeditText);
-    _grwl_free(window->wl.textInputV1Context.commitTextOnReset);
-    window->wl.textInputV1Context.preeditText = nullptr;
-    window->wl.textInputV1Context.commitTextOnReset = nullptr;
+    // Keep the buffers for the next preedit
+    storeString(&window->wl.textInputV1Context.preeditText, &window->wl.textInputV1Context.preeditTextSize, "");
+    storeString(&window->wl.textInputV1Context.commitTextOnReset,
+                &window->wl.textInputV1Context.commitTextOnResetSize, "");
 
     _grwlInputPreedit(window);
 }
@@ -2262,10 +2492,9 @@ static void textInputV1PreeditString(void* data, struct zwp_text_input_v1* textI
 {
     _GRWLwindow* window = (_GRWLwindow*)data;
 
-    _grwl_free(window->wl.textInputV1Context.preeditText);
-    _grwl_free(window->wl.textInputV1Context.commitTextOnReset);
-    window->wl.textInputV1Context.preeditText = strdup(text);
-    window->wl.textInputV1Context.commitTextOnReset = strdup(commit);
+    storeString(&window->wl.textInputV1Context.preeditText, &window->wl.textInputV1Context.preeditTextSize, text);
+    storeString(&window->wl.textInputV1Context.commitTextOnReset,
+                &window->wl.textInputV1Context.commitTextOnResetSize, commit);
 
     textInputV3PreeditString(data, nullptr, text, 0, 0);
     _grwlInputPreedit(window);
@@ -2281,27 +2510,16 @@ static void textInputV1PreeditCursor(void* data, struct zwp_text_input_v1* textI
     _GRWLwindow* window = (_GRWLwindow*)data;
     _GRWLpreedit* preedit = &window->preedit;
     const char* text = window->wl.textInputV1Context.preeditText;
-    const char* cur = text;
 
     preedit->caretIndex = 0;
-    if (index <= 0 || preedit->textCount == 0)
+    if (index <= 0 || preedit->textCount == 0 || !text)
     {
         return;
     }
 
-    while (cur && *cur)
-    {
-        _grwlDecodeUTF8(&cur);
-        ++preedit->caretIndex;
-        if (cur >= text + index)
-        {
-            break;
-        }
-        if (preedit->caretIndex > preedit->textCount)
-        {
-            break;
-        }
-    }
+    // The index is a byte offset into the text
+    const size_t length = strlen(text);
+    preedit->caretIndex = (int)_grwlCountUTF8(text, (size_t)index < length ? index : length);
 }
 
 static void textInputV1CommitString(void* data, struct zwp_text_input_v1* textInputV1, uint32_t serial,
@@ -2387,6 +2605,55 @@ static const struct zwp_text_input_v1_listener textInputV1Listener = {
     textInputV1TextDirection
 };
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Starts reading the display connection on a thread of its own
+//
+bool _grwlStartDisplayReaderWayland()
+{
+    _grwlDisplayReaderWayland.wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (_grwlDisplayReaderWayland.wakeup == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to create display reader eventfd: %s", strerror(errno));
+        return false;
+    }
+
+    _grwlDisplayReaderWayland.stopping.store(false);
+    _grwlDisplayReaderWayland.waiting.store(false);
+
+    if (!_grwlPlatformCreateThread(&_grwlDisplayReaderWayland.thread, displayReaderMain, nullptr))
+    {
+        close(_grwlDisplayReaderWayland.wakeup);
+        return false;
+    }
+
+    _grwlDisplayReaderWayland.running = true;
+    return true;
+}
+
+// Stops the display reader thread, before the connection is closed
+//
+void _grwlStopDisplayReaderWayland()
+{
+    if (!_grwlDisplayReaderWayland.running)
+    {
+        return;
+    }
+
+    _grwlDisplayReaderWayland.stopping.store(true, std::memory_order_release);
+
+    const uint64_t value = 1;
+    while (write(_grwlDisplayReaderWayland.wakeup, &value, sizeof(value)) == -1 && errno == EINTR)
+    {
+    }
+
+    _grwlPlatformJoinThread(&_grwlDisplayReaderWayland.thread);
+    close(_grwlDisplayReaderWayland.wakeup);
+    _grwlDisplayReaderWayland.running = false;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GRWL platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -2474,6 +2741,12 @@ bool _grwlCreateWindowWayland(_GRWLwindow* window, const _GRWLwndconfig* wndconf
 
 void _grwlDestroyWindowWayland(_GRWLwindow* window)
 {
+    if (window == _grwl.wl.dropTransfer.window)
+    {
+        // The data of the drop is still read but no longer delivered
+        _grwl.wl.dropTransfer.window = nullptr;
+    }
+
     if (window == _grwl.wl.pointerFocus)
     {
         _grwl.wl.pointerFocus = nullptr;
@@ -2564,7 +2837,7 @@ void _grwlSetWindowTitleWayland(_GRWLwindow* window, const char* title)
     }
 }
 
-void _grwlSetWindowIconWayland(_GRWLwindow* window, int count, const GRWLimage* images)
+void _grwlSetWindowIconWayland(_GRWLwindow* window, int count, const GRWLformattedimage* images)
 {
     _grwlInputError(GRWL_FEATURE_UNAVAILABLE, "Wayland: The platform does not support setting the window icon");
 }
@@ -3088,8 +3361,7 @@ void _grwlWaitEventsTimeoutWayland(double timeout)
 
 void _grwlPostEmptyEventWayland()
 {
-    wl_display_sync(_grwl.wl.display);
-    flushDisplay();
+    _grwlPostEmptyEventPOSIX();
 }
 
 void _grwlGetCursorPosWayland(_GRWLwindow* window, double* xpos, double* ypos)
@@ -3182,7 +3454,7 @@ const char* _grwlGetKeyboardLayoutNameWayland()
     return _grwl.wl.keyboardLayoutName;
 }
 
-bool _grwlCreateCursorWayland(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot)
+bool _grwlCreateCursorWayland(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot)
 {
     cursor->wl.buffer = createShmBuffer(image);
     if (!cursor->wl.buffer)
@@ -3321,6 +3593,10 @@ static void relativePointerHandleRelativeMotion(void* userData, struct zwp_relat
     double xpos = window->virtualCursorPosX;
     double ypos = window->virtualCursorPosY;
 
+    // The relative motion timestamp is in microseconds
+    const uint64_t time = ((uint64_t)timeHi << 32) | timeLo;
+    _grwl.eventTime = _grwlConvertEventTime((uint32_t)(time / 1000));
+
     if (window->cursorMode != GRWL_CURSOR_DISABLED)
     {
         return;
@@ -3498,21 +3774,50 @@ static void dataSourceHandleTarget(void* userData, struct wl_data_source* source
     }
 }
 
-static void dataSourceHandleSend(void* userData, struct wl_data_source* source, const char* mimeType, int fd)
+// Ends the specified outgoing clipboard transfer
+//
+static void finishSend(int index)
 {
-    // Ignore it if this is an outdated or invalid request
-    if (_grwl.wl.selectionSource != source || strcmp(mimeType, "text/plain;charset=utf-8") != 0)
+    _GRWLsendWayland* send = _grwl.wl.sends + index;
+
+    _grwlRemovePollSourcePOSIX(send->fd);
+    close(send->fd);
+
+    if (send->ownsData)
     {
-        close(fd);
-        return;
+        // Pass the string on to another transfer still sending it, if any
+        int i;
+
+        for (i = 0; i < _grwl.wl.sendCount; i++)
+        {
+            if (i != index && _grwl.wl.sends[i].data == send->data)
+            {
+                _grwl.wl.sends[i].ownsData = true;
+                break;
+            }
+        }
+
+        if (i == _grwl.wl.sendCount)
+        {
+            _grwl_free(send->data);
+        }
     }
 
-    char* string = _grwl.wl.clipboardString;
-    size_t length = strlen(string);
+    _grwl.wl.sendCount--;
+    _grwl.wl.sends[index] = _grwl.wl.sends[_grwl.wl.sendCount];
+}
+
+// Writes as much of the specified outgoing clipboard transfer as the pipe will
+// take without blocking, ending the transfer once all of it has been written
+// Returns whether the transfer is still in progress
+//
+static bool writeSend(int index)
+{
+    _GRWLsendWayland* send = _grwl.wl.sends + index;
 
-    while (length > 0)
+    while (send->offset < send->length)
     {
-        const ssize_t result = write(fd, string, length);
+        const ssize_t result = write(send->fd, send->data + send->offset, send->length - send->offset);
         if (result == -1)
         {
             if (errno == EINTR)
@@ -3520,15 +3825,102 @@ static void dataSourceHandleSend(void* userData, struct wl_data_source* source,
                 continue;
             }
 
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return true;
+            }
+
             _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Error while writing the clipboard: %s", strerror(errno));
             break;
         }
 
-        length -= result;
-        string += result;
+        send->offset += result;
     }
 
-    close(fd);
+    finishSend(index);
+    return false;
+}
+
+// Writes more of the outgoing clipboard transfer using the specified pipe
+//
+static void handleSendWritable(int fd)
+{
+    for (int i = 0; i < _grwl.wl.sendCount; i++)
+    {
+        if (_grwl.wl.sends[i].fd == fd)
+        {
+            writeSend(i);
+            return;
+        }
+    }
+}
+
+// Hands the specified clipboard buffer over to the outgoing transfers still
+// sending it, so that it is not overwritten
+//
+static void detachClipboardBuffer(char** buffer, size_t* capacity)
+{
+    for (int i = 0; i < _grwl.wl.sendCount; i++)
+    {
+        if (_grwl.wl.sends[i].data == *buffer)
+        {
+            _grwl.wl.sends[i].ownsData = true;
+            *buffer = nullptr;
+            *capacity = 0;
+            return;
+        }
+    }
+}
+
+static void dataSourceHandleSend(void* userData, struct wl_data_source* source, const char* mimeType, int fd)
+{
+    const char* type = _grwl.wl.clipboardDataType ? _grwl.wl.clipboardDataType : "text/plain;charset=utf-8";
+
+    // Ignore it if this is an outdated or invalid request
+    if (_grwl.wl.selectionSource != source || strcmp(mimeType, type) != 0)
+    {
+        close(fd);
+        return;
+    }
+
+    _GRWLsendWayland* sends = (_GRWLsendWayland*)_grwlReserveBuffer(_grwl.wl.sends, &_grwl.wl.sendArraySize,
+                                                                   (_grwl.wl.sendCount + 1) * sizeof(_GRWLsendWayland));
+    if (!sends)
+    {
+        close(fd);
+        return;
+    }
+
+    _grwl.wl.sends = sends;
+
+    // The string is written by the event loop whenever the receiving client has
+    // made room for more of it, so a slow receiver cannot block us
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    const int index = _grwl.wl.sendCount++;
+    _GRWLsendWayland* send = sends + index;
+    memset(send, 0, sizeof(_GRWLsendWayland));
+    send->fd = fd;
+
+    if (_grwl.wl.clipboardDataType)
+    {
+        send->data = _grwl.wl.clipboardData;
+        send->length = _grwl.wl.clipboardDataLength;
+    }
+    else
+    {
+        send->data = _grwl.wl.clipboardString;
+        send->length = strlen(_grwl.wl.clipboardString);
+    }
+
+    // Most strings fit in the pipe buffer and are written right away
+    if (writeSend(index))
+    {
+        if (!_grwlAddWritePollSourcePOSIX(fd, handleSendWritable))
+        {
+            finishSend(index);
+        }
+    }
 }
 
 static void dataSourceHandleCancelled(void* userData, struct wl_data_source* source)
@@ -3549,24 +3941,25 @@ static const struct wl_data_source_listener dataSourceListener = {
     dataSourceHandleCancelled,
 };
 
-void _grwlSetClipboardStringWayland(const char* string)
+// Returns whether the selection offer has the specified MIME type
+//
+static bool selectionHasType(const char* mimeType)
 {
-    if (_grwl.wl.selectionSource)
-    {
-        wl_data_source_destroy(_grwl.wl.selectionSource);
-        _grwl.wl.selectionSource = nullptr;
-    }
-
-    char* copy = _grwl_strdup(string);
-    if (!copy)
+    for (size_t i = 0; i < _grwl.wl.selectionTypesLength; i += strlen(_grwl.wl.selectionTypes + i) + 1)
     {
-        _grwlInputError(GRWL_OUT_OF_MEMORY, nullptr);
-        return;
+        if (strcmp(_grwl.wl.selectionTypes + i, mimeType) == 0)
+        {
+            return true;
+        }
     }
 
-    _grwl_free(_grwl.wl.clipboardString);
-    _grwl.wl.clipboardString = copy;
+    return false;
+}
 
+// Makes a new data source offering the specified MIME type the selection
+//
+static void setSelectionSource(const char* mimeType)
+{
     _grwl.wl.selectionSource = wl_data_device_manager_create_data_source(_grwl.wl.dataDeviceManager);
     if (!_grwl.wl.selectionSource)
     {
@@ -3574,10 +3967,31 @@ void _grwlSetClipboardStringWayland(const char* string)
         return;
     }
     wl_data_source_add_listener(_grwl.wl.selectionSource, &dataSourceListener, nullptr);
-    wl_data_source_offer(_grwl.wl.selectionSource, "text/plain;charset=utf-8");
+    wl_data_source_offer(_grwl.wl.selectionSource, mimeType);
     wl_data_device_set_selection(_grwl.wl.dataDevice, _grwl.wl.selectionSource, _grwl.wl.serial);
 }
 
+void _grwlSetClipboardStringWayland(const char* string)
+{
+    if (_grwl.wl.selectionSource)
+    {
+        wl_data_source_destroy(_grwl.wl.selectionSource);
+        _grwl.wl.selectionSource = nullptr;
+    }
+
+    detachClipboardBuffer(&_grwl.wl.clipboardString, &_grwl.wl.clipboardStringSize);
+
+    if (!storeString(&_grwl.wl.clipboardString, &_grwl.wl.clipboardStringSize, string))
+    {
+        return;
+    }
+
+    _grwl_free(_grwl.wl.clipboardDataType);
+    _grwl.wl.clipboardDataType = nullptr;
+
+    setSelectionSource("text/plain;charset=utf-8");
+}
+
 const char* _grwlGetClipboardStringWayland()
 {
     if (!_grwl.wl.selectionOffer)
@@ -3588,12 +4002,212 @@ const char* _grwlGetClipboardStringWayland()
 
     if (_grwl.wl.selectionSource)
     {
+        if (_grwl.wl.clipboardDataType)
+        {
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Wayland: The clipboard holds data that is not a string");
+            return nullptr;
+        }
+
         return _grwl.wl.clipboardString;
     }
 
-    _grwl_free(_grwl.wl.clipboardString);
-    _grwl.wl.clipboardString = readDataOfferAsString(_grwl.wl.selectionOffer, "text/plain;charset=utf-8");
-    return _grwl.wl.clipboardString;
+    if (!selectionHasType("text/plain;charset=utf-8"))
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Wayland: The clipboard holds no string");
+        return nullptr;
+    }
+
+    _GRWLtransferWayland* transfer = &_grwl.wl.clipboardTransfer;
+
+    // A pending request may already have started the transfer
+    if (transfer->fd == -1)
+    {
+        if (!beginTransfer(transfer, _grwl.wl.selectionOffer, "text/plain;charset=utf-8"))
+        {
+            return nullptr;
+        }
+    }
+
+    while (transfer->fd != -1)
+    {
+        struct pollfd fd = { transfer->fd, POLLIN };
+        if (!_grwlPollPOSIX(&fd, 1, nullptr))
+        {
+            break;
+        }
+
+        readTransfer(transfer);
+    }
+
+    return transfer->result;
+}
+
+bool _grwlRequestClipboardStringWayland()
+{
+    if (!_grwl.wl.selectionOffer || _grwl.wl.selectionSource || !selectionHasType("text/plain;charset=utf-8"))
+    {
+        // There is no transfer to wait for, so the string or the error is
+        // delivered with the next event processing
+        return _grwlRequestClipboardStringDeferred();
+    }
+
+    if (_grwl.wl.clipboardTransfer.fd == -1)
+    {
+        return beginTransfer(&_grwl.wl.clipboardTransfer, _grwl.wl.selectionOffer, "text/plain;charset=utf-8");
+    }
+
+    return true;
+}
+
+// Receives the selection as the specified MIME type into an anonymous file and
+// maps it read-only
+// The data is moved from the pipe into the file by the kernel, so it is never
+// copied through our own buffers
+//
+static const void* receiveSelectionData(const char* mimeType, size_t* size)
+{
+    if (_grwl.wl.clipboardDataMapping)
+    {
+        munmap(_grwl.wl.clipboardDataMapping, _grwl.wl.clipboardDataMappingSize);
+        _grwl.wl.clipboardDataMapping = nullptr;
+        _grwl.wl.clipboardDataMappingSize = 0;
+    }
+
+    const int file = createAnonymousFile(0);
+    if (file < 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to create file for clipboard data: %s", strerror(errno));
+        return nullptr;
+    }
+
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC) == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to create pipe for data offer: %s", strerror(errno));
+        close(file);
+        return nullptr;
+    }
+
+    wl_data_offer_receive(_grwl.wl.selectionOffer, mimeType, fds[1]);
+    flushDisplay();
+    close(fds[1]);
+
+    size_t length = 0;
+    bool succeeded = true;
+
+    for (;;)
+    {
+        struct pollfd fd = { fds[0], POLLIN };
+        if (!_grwlPollPOSIX(&fd, 1, nullptr))
+        {
+            succeeded = false;
+            break;
+        }
+
+        const ssize_t result = splice(fds[0], nullptr, file, nullptr, 1 << 20, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (result == 0)
+        {
+            break;
+        }
+        else if (result == -1)
+        {
+            if (errno == EINTR || errno == EAGAIN)
+            {
+                continue;
+            }
+
+            _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to read from data offer pipe: %s", strerror(errno));
+            succeeded = false;
+            break;
+        }
+
+        length += result;
+    }
+
+    close(fds[0]);
+
+    if (!succeeded)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    if (length == 0)
+    {
+        // An empty file cannot be mapped
+        close(file);
+        *size = 0;
+        return "";
+    }
+
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, file, 0);
+    close(file);
+
+    if (mapping == MAP_FAILED)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Wayland: Failed to map clipboard data: %s", strerror(errno));
+        return nullptr;
+    }
+
+    _grwl.wl.clipboardDataMapping = mapping;
+    _grwl.wl.clipboardDataMappingSize = length;
+
+    *size = length;
+    return mapping;
+}
+
+void _grwlSetClipboardDataWayland(const char* mimeType, const void* data, size_t size)
+{
+    if (_grwl.wl.selectionSource)
+    {
+        wl_data_source_destroy(_grwl.wl.selectionSource);
+        _grwl.wl.selectionSource = nullptr;
+    }
+
+    detachClipboardBuffer(&_grwl.wl.clipboardData, &_grwl.wl.clipboardDataSize);
+
+    char* buffer = (char*)_grwlReserveBuffer(_grwl.wl.clipboardData, &_grwl.wl.clipboardDataSize, size + 1);
+    if (!buffer)
+    {
+        return;
+    }
+
+    memcpy(buffer, data, size);
+    _grwl.wl.clipboardData = buffer;
+    _grwl.wl.clipboardDataLength = size;
+
+    _grwl_free(_grwl.wl.clipboardDataType);
+    _grwl.wl.clipboardDataType = _grwl_strdup(mimeType);
+    if (!_grwl.wl.clipboardDataType)
+    {
+        return;
+    }
+
+    setSelectionSource(mimeType);
+}
+
+const void* _grwlGetClipboardDataWayland(const char* mimeType, size_t* size)
+{
+    if (_grwl.wl.selectionSource)
+    {
+        if (!_grwl.wl.clipboardDataType || strcmp(_grwl.wl.clipboardDataType, mimeType) != 0)
+        {
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Wayland: The clipboard has no data of type %s", mimeType);
+            return nullptr;
+        }
+
+        *size = _grwl.wl.clipboardDataLength;
+        return _grwl.wl.clipboardData;
+    }
+
+    if (!_grwl.wl.selectionOffer || !selectionHasType(mimeType))
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Wayland: The clipboard has no data of type %s", mimeType);
+        return nullptr;
+    }
+
+    return receiveSelectionData(mimeType, size);
 }
 
 void _grwlUpdatePreeditCursorRectangleWayland(_GRWLwindow* window)
@@ -3737,6 +4351,7 @@ GRWLAPI struct wl_surface* grwlGetWaylandWindow(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_WAYLAND)
     {
@@ -16,6 +16,31 @@
     #include <fcntl.h>
     #include <cerrno>
     #include <cassert>
+    #include <pthread.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+
+// Guards installing and restoring the process-wide X error handler, which the
+// main thread and the context pool thread may hold at the same time
+static pthread_mutex_t _grwlErrorHandlerLock = PTHREAD_MUTEX_INITIALIZER;
+static int _grwlErrorHandlerCount;
+
+// Whether this is the context pool thread creating a context
+static thread_local bool _grwlPoolErrorHandler;
+
+// The thread reading the display connection when the input thread init hint is
+// set
+//
+static struct
+{
+    bool running;
+    _GRWLthread thread;
+    // Written to stop the thread
+    int stop;
+    // Written by the thread when it has moved events into the Xlib queue, so
+    // that synchronous waits do not sleep on a socket it has already drained
+    int queued;
+} _grwlDisplayReaderX11 = { false, {}, -1, -1 };
 
 // Translate the X11 KeySyms for a key to a GRWL key code
 // NOTE: This is only used as a fallback, in case the XKB method fails
@@ -602,8 +627,9 @@ static void inputMethodInstantiateCallback(Display* display, XPointer clientData
         callback.client_data = nullptr;
         XSetIMValues(_grwl.x11.im, XNDestroyCallback, &callback, nullptr);
 
-        for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+        for (int i = 0; i < _grwl.windowCount; i++)
         {
+            _GRWLwindow* window = _grwl.windows[i];
             _grwlCreateInputContextX11(window);
         }
     }
@@ -648,6 +674,7 @@ static void detectEWMH()
     if (!_grwlGetWindowPropertyX11(*windowFromRoot, _grwl.x11.NET_SUPPORTING_WM_CHECK, XA_WINDOW,
                                    (unsigned char**)&windowFromChild))
     {
+        _grwlReleaseErrorHandlerX11();
         XFree(windowFromRoot);
         return;
     }
@@ -969,6 +996,8 @@ static bool initExtensions()
 
     // Custom selection property atom
     _grwl.x11.GRWL_SELECTION = XInternAtom(_grwl.x11.display, "GRWL_SELECTION", False);
+    _grwl.x11.GRWL_PRIMARY_SELECTION = XInternAtom(_grwl.x11.display, "GRWL_PRIMARY_SELECTION", False);
+    _grwl.x11.GRWL_CLIPBOARD_DATA = XInternAtom(_grwl.x11.display, "GRWL_CLIPBOARD_DATA", False);
 
     // ICCCM standard clipboard atoms
     _grwl.x11.TARGETS = XInternAtom(_grwl.x11.display, "TARGETS", False);
@@ -1065,7 +1094,7 @@ static void getSystemContentScale(float* xscale, float* yscale)
 static Cursor createHiddenCursor()
 {
     unsigned char pixels[16 * 16 * 4] = { 0 };
-    GRWLimage image = { 16, 16, pixels };
+    GRWLformattedimage image = { 16, 16, pixels };
     return _grwlCreateNativeCursorX11(&image, 0, 0);
 }
 
@@ -1080,43 +1109,163 @@ static Window createHelperWindow()
                          DefaultVisual(_grwl.x11.display, _grwl.x11.screen), CWEventMask, &wa);
 }
 
-// Create the pipe for empty events without assumuing the OS has pipe2(2)
+// X error handler
 //
-static bool createEmptyEventPipe()
+static int errorHandler(Display* display, XErrorEvent* event)
 {
-    if (pipe(_grwl.x11.emptyEventPipe) != 0)
+    // The context pool thread creates contexts on a connection of its own, so
+    // its errors are kept from the error code of the main thread
+    if (_grwlPoolErrorHandler && display == _grwl.glx.poolDisplay)
     {
-        _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to create empty event pipe: %s", strerror(errno));
-        return false;
+        _grwl.glx.poolErrorCode = event->error_code;
+        return 0;
     }
 
-    for (int i = 0; i < 2; i++)
+    if (_grwl.x11.display != display && _grwl.glx.poolDisplay != display)
+    {
+        return 0;
+    }
+
+    _grwl.x11.errorCode = event->error_code;
+    return 0;
+}
+
+// Installs the error handler if no thread is already holding it
+//
+static void acquireErrorHandler()
+{
+    pthread_mutex_lock(&_grwlErrorHandlerLock);
+
+    if (_grwlErrorHandlerCount++ == 0)
+    {
+        _grwl.x11.errorHandler = XSetErrorHandler(errorHandler);
+    }
+
+    pthread_mutex_unlock(&_grwlErrorHandlerLock);
+}
+
+// Restores the previous error handler once no thread is holding it
+//
+static void releaseErrorHandler()
+{
+    pthread_mutex_lock(&_grwlErrorHandlerLock);
+
+    if (--_grwlErrorHandlerCount == 0)
+    {
+        XSetErrorHandler(_grwl.x11.errorHandler);
+        _grwl.x11.errorHandler = nullptr;
+    }
+
+    pthread_mutex_unlock(&_grwlErrorHandlerLock);
+}
+
+// Moves display data into the Xlib event queue as it arrives
+// Events are still translated and delivered by event processing on the main
+// thread, but no longer wait in the socket while it is busy
+//
+static void displayReaderMain(void* user)
+{
+    struct pollfd fds[] = { { ConnectionNumber(_grwl.x11.display), POLLIN, 0 },
+                            { _grwlDisplayReaderX11.stop, POLLIN, 0 } };
+
+    for (;;)
     {
-        const int sf = fcntl(_grwl.x11.emptyEventPipe[i], F_GETFL, 0);
-        const int df = fcntl(_grwl.x11.emptyEventPipe[i], F_GETFD, 0);
+        if (poll(fds, sizeof(fds) / sizeof(fds[0]), -1) == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
 
-        if (sf == -1 || df == -1 || fcntl(_grwl.x11.emptyEventPipe[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
-            fcntl(_grwl.x11.emptyEventPipe[i], F_SETFD, df | FD_CLOEXEC) == -1)
+        if (fds[1].revents & POLLIN)
         {
-            _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to set flags for empty event pipe: %s", strerror(errno));
-            return false;
+            break;
+        }
+
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            // Leave handling the lost connection to the main thread
+            _grwlPostEmptyEventPOSIX();
+            break;
         }
+
+        if (fds[0].revents & POLLIN)
+        {
+            // This takes the display lock, so it only reads while no other
+            // thread is using the connection
+            if (XEventsQueued(_grwl.x11.display, QueuedAfterReading) > 0)
+            {
+                const uint64_t value = 1;
+                while (write(_grwlDisplayReaderX11.queued, &value, sizeof(value)) == -1 && errno == EINTR)
+                {
+                }
+
+                _grwlPostEmptyEventPOSIX();
+            }
+        }
+    }
+}
+
+// Closes the event file descriptors of the display reader thread
+//
+static void closeDisplayReaderFds()
+{
+    if (_grwlDisplayReaderX11.stop != -1)
+    {
+        close(_grwlDisplayReaderX11.stop);
+        _grwlDisplayReaderX11.stop = -1;
+    }
+
+    if (_grwlDisplayReaderX11.queued != -1)
+    {
+        close(_grwlDisplayReaderX11.queued);
+        _grwlDisplayReaderX11.queued = -1;
+    }
+}
+
+// Starts reading the display connection on a thread of its own
+//
+static bool startDisplayReader()
+{
+    _grwlDisplayReaderX11.stop = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    _grwlDisplayReaderX11.queued = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (_grwlDisplayReaderX11.stop == -1 || _grwlDisplayReaderX11.queued == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to create display reader eventfd: %s", strerror(errno));
+        closeDisplayReaderFds();
+        return false;
     }
 
+    if (!_grwlPlatformCreateThread(&_grwlDisplayReaderX11.thread, displayReaderMain, nullptr))
+    {
+        closeDisplayReaderFds();
+        return false;
+    }
+
+    _grwlDisplayReaderX11.running = true;
     return true;
 }
 
-// X error handler
+// Stops the display reader thread, before the connection is closed
 //
-static int errorHandler(Display* display, XErrorEvent* event)
+static void stopDisplayReader()
 {
-    if (_grwl.x11.display != display)
+    if (!_grwlDisplayReaderX11.running)
     {
-        return 0;
+        return;
     }
 
-    _grwl.x11.errorCode = event->error_code;
-    return 0;
+    const uint64_t value = 1;
+    while (write(_grwlDisplayReaderX11.stop, &value, sizeof(value)) == -1 && errno == EINTR)
+    {
+    }
+
+    _grwlPlatformJoinThread(&_grwlDisplayReaderX11.thread);
+    closeDisplayReaderFds();
+    _grwlDisplayReaderX11.running = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1127,9 +1276,8 @@ static int errorHandler(Display* display, XErrorEvent* event)
 //
 void _grwlGrabErrorHandlerX11()
 {
-    assert(_grwl.x11.errorHandler == nullptr);
     _grwl.x11.errorCode = Success;
-    _grwl.x11.errorHandler = XSetErrorHandler(errorHandler);
+    acquireErrorHandler();
 }
 
 // Clears the X error handler callback
@@ -1138,8 +1286,53 @@ void _grwlReleaseErrorHandlerX11()
 {
     // Synchronize to make sure all commands are processed
     XSync(_grwl.x11.display, False);
-    XSetErrorHandler(_grwl.x11.errorHandler);
-    _grwl.x11.errorHandler = nullptr;
+    releaseErrorHandler();
+}
+
+// Sets the X error handler callback for context creation on the context pool
+// thread, without blocking the main thread from holding it as well
+//
+void _grwlGrabPoolErrorHandlerX11()
+{
+    _grwl.glx.poolErrorCode = Success;
+    _grwlPoolErrorHandler = true;
+    acquireErrorHandler();
+}
+
+// Clears the X error handler callback of the context pool thread
+//
+void _grwlReleasePoolErrorHandlerX11()
+{
+    // Synchronize to make sure all commands are processed
+    XSync(_grwl.glx.poolDisplay, False);
+    _grwlPoolErrorHandler = false;
+    releaseErrorHandler();
+}
+
+// Waits for display data to arrive, either on the socket or, if the display
+// reader thread is running, in the Xlib event queue
+// The caller must check the Xlib queue again after every wakeup
+//
+bool _grwlWaitForDisplayX11(double* timeout)
+{
+    struct pollfd fds[] = { { ConnectionNumber(_grwl.x11.display), POLLIN, 0 },
+                            { _grwlDisplayReaderX11.queued, POLLIN, 0 } };
+    const nfds_t count = _grwlDisplayReaderX11.running ? 2 : 1;
+
+    if (!_grwlPollPOSIX(fds, count, timeout))
+    {
+        return false;
+    }
+
+    if (count == 2 && (fds[1].revents & POLLIN))
+    {
+        uint64_t value;
+        while (read(_grwlDisplayReaderX11.queued, &value, sizeof(value)) == -1 && errno == EINTR)
+        {
+        }
+    }
+
+    return true;
 }
 
 // Reports the specified error, appending information about the last X error
@@ -1154,7 +1347,7 @@ void _grwlInputErrorX11(int error, const char* message)
 
 // Creates a native cursor object from the specified image and hotspot
 //
-Cursor _grwlCreateNativeCursorX11(const GRWLimage* image, int xhot, int yhot)
+Cursor _grwlCreateNativeCursorX11(const GRWLformattedimage* image, int xhot, int yhot)
 {
     Cursor cursor;
 
@@ -1172,16 +1365,7 @@ Cursor _grwlCreateNativeCursorX11(const GRWLimage* image, int xhot, int yhot)
     native->xhot = xhot;
     native->yhot = yhot;
 
-    unsigned char* source = (unsigned char*)image->pixels;
-    XcursorPixel* target = native->pixels;
-
-    for (int i = 0; i < image->width * image->height; i++, target++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target = (alpha << 24) | ((unsigned char)((source[0] * alpha) / 255) << 16) |
-                  ((unsigned char)((source[1] * alpha) / 255) << 8) | ((unsigned char)((source[2] * alpha) / 255) << 0);
-    }
+    _grwlConvertImage(native->pixels, _GRWL_IMAGE_ARGB32 | _GRWL_IMAGE_PREMULTIPLIED, image);
 
     cursor = XcursorImageLoadCursor(_grwl.x11.display, native);
     XcursorImageDestroy(native);
@@ -1213,6 +1397,9 @@ bool _grwlConnectX11(int platformID, _GRWLplatform* platform)
         _grwlGetKeyboardLayoutNameX11,
         _grwlSetClipboardStringX11,
         _grwlGetClipboardStringX11,
+        _grwlRequestClipboardStringX11,
+        _grwlSetClipboardDataX11,
+        _grwlGetClipboardDataX11,
         _grwlUpdatePreeditCursorRectangleX11,
         _grwlResetPreeditTextX11,
         _grwlSetIMEStatusX11,
@@ -1442,10 +1629,14 @@ int _grwlInitX11()
         (PFN_XLookupString)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XLookupString");
     _grwl.x11.xlib.MapRaised = (PFN_XMapRaised)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XMapRaised");
     _grwl.x11.xlib.MapWindow = (PFN_XMapWindow)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XMapWindow");
+    _grwl.x11.xlib.MaxRequestSize =
+        (PFN_XMaxRequestSize)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XMaxRequestSize");
     _grwl.x11.xlib.MoveResizeWindow =
         (PFN_XMoveResizeWindow)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XMoveResizeWindow");
     _grwl.x11.xlib.MoveWindow = (PFN_XMoveWindow)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XMoveWindow");
     _grwl.x11.xlib.NextEvent = (PFN_XNextEvent)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XNextEvent");
+    _grwl.x11.xlib.OpenDisplay =
+        (PFN_XOpenDisplay)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XOpenDisplay");
     _grwl.x11.xlib.OpenIM = (PFN_XOpenIM)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XOpenIM");
     _grwl.x11.xlib.PeekEvent = (PFN_XPeekEvent)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XPeekEvent");
     _grwl.x11.xlib.Pending = (PFN_XPending)_grwlPlatformGetModuleSymbol(_grwl.x11.xlib.handle, "XPending");
@@ -1543,7 +1734,7 @@ int _grwlInitX11()
 
     getSystemContentScale(&_grwl.x11.contentScaleX, &_grwl.x11.contentScaleY);
 
-    if (!createEmptyEventPipe())
+    if (!_grwlInitPollPOSIX() || !_grwlAddPollSourcePOSIX(ConnectionNumber(_grwl.x11.display), nullptr))
     {
         return false;
     }
@@ -1566,11 +1757,22 @@ int _grwlInitX11()
     }
 
     _grwlPollMonitorsX11();
+
+    if (_grwl.hints.init.inputThread)
+    {
+        if (!startDisplayReader())
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
 void _grwlTerminateX11()
 {
+    stopDisplayReader();
+
     if (_grwl.x11.helperWindowHandle)
     {
         if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD) == _grwl.x11.helperWindowHandle)
@@ -1590,6 +1792,21 @@ void _grwlTerminateX11()
 
     _grwl_free(_grwl.x11.primarySelectionString);
     _grwl_free(_grwl.x11.clipboardString);
+    _grwl_free(_grwl.x11.clipboardTransfer.buffer);
+    _grwl_free(_grwl.x11.primaryTransfer.buffer);
+    _grwl_free(_grwl.x11.dropTransfer.buffer);
+    _grwl_free(_grwl.x11.dataTransfer.buffer);
+    _grwl_free(_grwl.x11.clipboardData);
+
+    for (int i = 0; i < _grwl.x11.sendCount; i++)
+    {
+        if (_grwl.x11.sends[i].ownsData)
+        {
+            _grwl_free(_grwl.x11.sends[i].data);
+        }
+    }
+
+    _grwl_free(_grwl.x11.sends);
 
     if (_grwl.x11.keyboardLayoutName)
     {
@@ -1605,6 +1822,12 @@ void _grwlTerminateX11()
         _grwl.x11.im = nullptr;
     }
 
+    if (_grwl.glx.poolDisplay)
+    {
+        XCloseDisplay(_grwl.glx.poolDisplay);
+        _grwl.glx.poolDisplay = nullptr;
+    }
+
     if (_grwl.x11.display)
     {
         XCloseDisplay(_grwl.x11.display);
@@ -1665,11 +1888,7 @@ void _grwlTerminateX11()
         _grwl.x11.xlib.handle = nullptr;
     }
 
-    if (_grwl.x11.emptyEventPipe[0] || _grwl.x11.emptyEventPipe[1])
-    {
-        close(_grwl.x11.emptyEventPipe[0]);
-        close(_grwl.x11.emptyEventPipe[1]);
-    }
+    _grwlTerminatePollPOSIX();
 
     _grwlTerminateDBusPOSIX();
 }
@@ -85,6 +85,7 @@ void _grwlPollMonitorsX11()
         int disconnectedCount, screenCount = 0;
         _GRWLmonitor** disconnected = nullptr;
         XineramaScreenInfo* screens = nullptr;
+        _grwl.stats.roundTrips += 2;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         RROutput primary = XRRGetOutputPrimary(_grwl.x11.display, _grwl.x11.root);
 
@@ -104,6 +105,7 @@ void _grwlPollMonitorsX11()
         {
             int j, type, widthMM, heightMM;
 
+            _grwl.stats.roundTrips++;
             XRROutputInfo* oi = XRRGetOutputInfo(_grwl.x11.display, sr, sr->outputs[i]);
             if (oi->connection != RR_Connected || oi->crtc == None)
             {
@@ -126,6 +128,7 @@ void _grwlPollMonitorsX11()
                 continue;
             }
 
+            _grwl.stats.roundTrips++;
             XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, oi->crtc);
             if (ci->rotation == RR_Rotate_90 || ci->rotation == RR_Rotate_270)
             {
@@ -219,6 +222,7 @@ void _grwlSetVideoModeX11(_GRWLmonitor* monitor, const GRWLvidmode* desired)
             return;
         }
 
+        _grwl.stats.roundTrips += 3;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
         XRROutputInfo* oi = XRRGetOutputInfo(_grwl.x11.display, sr, monitor->x11.output);
@@ -267,6 +271,7 @@ void _grwlRestoreVideoModeX11(_GRWLmonitor* monitor)
             return;
         }
 
+        _grwl.stats.roundTrips += 2;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
 
@@ -292,6 +297,7 @@ void _grwlGetMonitorPosX11(_GRWLmonitor* monitor, int* xpos, int* ypos)
 {
     if (_grwl.x11.randr.available && !_grwl.x11.randr.monitorBroken)
     {
+        _grwl.stats.roundTrips += 2;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
 
@@ -331,6 +337,7 @@ void _grwlGetMonitorWorkareaX11(_GRWLmonitor* monitor, int* xpos, int* ypos, int
 
     if (_grwl.x11.randr.available && !_grwl.x11.randr.monitorBroken)
     {
+        _grwl.stats.roundTrips += 2;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
 
@@ -435,6 +442,7 @@ GRWLvidmode* _grwlGetVideoModesX11(_GRWLmonitor* monitor, int* count)
 
     if (_grwl.x11.randr.available && !_grwl.x11.randr.monitorBroken)
     {
+        _grwl.stats.roundTrips += 3;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
         XRROutputInfo* oi = XRRGetOutputInfo(_grwl.x11.display, sr, monitor->x11.output);
@@ -488,6 +496,7 @@ void _grwlGetVideoModeX11(_GRWLmonitor* monitor, GRWLvidmode* mode)
 {
     if (_grwl.x11.randr.available && !_grwl.x11.randr.monitorBroken)
     {
+        _grwl.stats.roundTrips += 2;
         XRRScreenResources* sr = XRRGetScreenResourcesCurrent(_grwl.x11.display, _grwl.x11.root);
         XRRCrtcInfo* ci = XRRGetCrtcInfo(_grwl.x11.display, sr, monitor->x11.crtc);
 
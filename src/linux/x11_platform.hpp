@@ -34,6 +34,7 @@
     #define GLX_WINDOW_BIT 0x00000001
     #define GLX_DRAWABLE_TYPE 0x8010
     #define GLX_RENDER_TYPE 0x8011
+    #define GLX_FBCONFIG_ID 0x8013
     #define GLX_RGBA_TYPE 0x8014
     #define GLX_DOUBLEBUFFER 5
     #define GLX_STEREO 6
@@ -130,6 +131,7 @@ typedef Status (*PFN_XInitThreads)();
 typedef Atom (*PFN_XInternAtom)(Display*, const char*, Bool);
 typedef int (*PFN_XLookupString)(XKeyEvent*, char*, int, KeySym*, XComposeStatus*);
 typedef int (*PFN_XMapRaised)(Display*, Window);
+typedef long (*PFN_XMaxRequestSize)(Display*);
 typedef int (*PFN_XMapWindow)(Display*, Window);
 typedef int (*PFN_XMoveResizeWindow)(Display*, Window, int, int, unsigned int, unsigned int);
 typedef int (*PFN_XMoveWindow)(Display*, Window, int, int);
@@ -238,6 +240,7 @@ typedef void (*PFN_Xutf8SetWMProperties)(Display*, Window, const char*, const ch
     #define XLookupString _grwl.x11.xlib.LookupString
     #define XMapRaised _grwl.x11.xlib.MapRaised
     #define XMapWindow _grwl.x11.xlib.MapWindow
+    #define XMaxRequestSize _grwl.x11.xlib.MaxRequestSize
     #define XMoveResizeWindow _grwl.x11.xlib.MoveResizeWindow
     #define XMoveWindow _grwl.x11.xlib.MoveWindow
     #define XNextEvent _grwl.x11.xlib.NextEvent
@@ -464,9 +467,16 @@ typedef struct _GRWLlibraryGLX
     int major, minor;
     int eventBase;
     int errorBase;
+    // Display connection of the context pool thread, which keeps its X errors
+    // apart from those of the main thread
+    Display* poolDisplay;
+    // The last X error caused by the context pool thread on its connection
+    int poolErrorCode;
 
     void* handle;
 
+    _GRWLfbconfigcache fbconfigs;
+
     // GLX 1.3 functions
     PFNGLXGETFBCONFIGSPROC GetFBConfigs;
     PFNGLXGETFBCONFIGATTRIBPROC GetFBConfigAttrib;
@@ -551,6 +561,49 @@ typedef struct _GRWLwindowX11
     int imeFocus;
 } _GRWLwindowX11;
 
+// X11-specific incoming selection transfer, driven by the event loop
+//
+typedef struct _GRWLtransferX11
+{
+    // The selection being converted, or None if no transfer is in progress
+    Atom selection;
+    // The window and property the selection owner writes the data to
+    Window requestor;
+    Atom property;
+    Time time;
+    // The targets to request, in order of preference
+    Atom targets[2];
+    int targetCount;
+    int targetIndex;
+    // Whether the data is arriving in chunks as described by ICCCM section 2.7.2
+    bool incremental;
+    // The chunks received so far, in a buffer that grows geometrically
+    char* buffer;
+    size_t length;
+    size_t capacity;
+    // The window receiving a drop
+    _GRWLwindow* window;
+    // The string delivered by the last finished transfer, or nullptr
+    const char* result;
+} _GRWLtransferX11;
+
+// X11-specific outgoing incremental selection transfer (ICCCM section 2.7.2)
+//
+typedef struct _GRWLsendX11
+{
+    Window requestor;
+    Atom property;
+    Atom target;
+    // The string being sent, shared with the selection until it is replaced
+    char* data;
+    size_t length;
+    size_t offset;
+    // Whether this transfer frees the string once it is done
+    bool ownsData;
+    // The timer value when the requestor last asked for data
+    uint64_t lastActivity;
+} _GRWLsendX11;
+
 // X11-specific global data
 //
 typedef struct _GRWLlibraryX11
@@ -577,8 +630,25 @@ typedef struct _GRWLlibraryX11
     int errorCode;
     // Primary selection string (while the primary selection is owned)
     char* primarySelectionString;
+    size_t primarySelectionStringSize;
     // Clipboard string (while the selection is owned)
     char* clipboardString;
+    size_t clipboardStringSize;
+    // Clipboard data and its type, or None if the clipboard holds the string
+    char* clipboardData;
+    size_t clipboardDataLength;
+    size_t clipboardDataSize;
+    Atom clipboardDataType;
+    // Incoming transfers of the clipboard, the primary selection, drops and
+    // clipboard data
+    _GRWLtransferX11 clipboardTransfer;
+    _GRWLtransferX11 primaryTransfer;
+    _GRWLtransferX11 dropTransfer;
+    _GRWLtransferX11 dataTransfer;
+    // Outgoing incremental transfers of selections we own
+    _GRWLsendX11* sends;
+    int sendCount;
+    size_t sendArraySize;
     // Key name string
     char keynames[GRWL_KEY_LAST + 1][5];
     // X11 keycode to GRWL key LUT
@@ -590,7 +660,6 @@ typedef struct _GRWLlibraryX11
     double restoreCursorPosX, restoreCursorPosY;
     // The window whose disabled cursor mode is active
     _GRWLwindow* disabledCursorWindow;
-    int emptyEventPipe[2];
 
     // Window manager atoms
     Atom NET_SUPPORTED;
@@ -647,6 +716,8 @@ typedef struct _GRWLlibraryX11
     Atom COMPOUND_STRING;
     Atom ATOM_PAIR;
     Atom GRWL_SELECTION;
+    Atom GRWL_PRIMARY_SELECTION;
+    Atom GRWL_CLIPBOARD_DATA;
 
     struct
     {
@@ -701,9 +772,11 @@ typedef struct _GRWLlibraryX11
         PFN_XLookupString LookupString;
         PFN_XMapRaised MapRaised;
         PFN_XMapWindow MapWindow;
+        PFN_XMaxRequestSize MaxRequestSize;
         PFN_XMoveResizeWindow MoveResizeWindow;
         PFN_XMoveWindow MoveWindow;
         PFN_XNextEvent NextEvent;
+        PFN_XOpenDisplay OpenDisplay;
         PFN_XOpenIM OpenIM;
         PFN_XPeekEvent PeekEvent;
         PFN_XPending Pending;
@@ -919,7 +992,7 @@ bool _grwlCreateWindowX11(_GRWLwindow* window, const _GRWLwndconfig* wndconfig,
                           const _GRWLfbconfig* fbconfig);
 void _grwlDestroyWindowX11(_GRWLwindow* window);
 void _grwlSetWindowTitleX11(_GRWLwindow* window, const char* title);
-void _grwlSetWindowIconX11(_GRWLwindow* window, int count, const GRWLimage* images);
+void _grwlSetWindowIconX11(_GRWLwindow* window, int count, const GRWLformattedimage* images);
 void _grwlSetWindowProgressIndicatorX11(_GRWLwindow* window, int progressState, double value);
 void _grwlSetWindowBadgeX11(_GRWLwindow* window, int count);
 void _grwlSetWindowBadgeStringX11(_GRWLwindow* window, const char* string);
@@ -968,12 +1041,15 @@ void _grwlSetCursorModeX11(_GRWLwindow* window, int mode);
 const char* _grwlGetScancodeNameX11(int scancode);
 int _grwlGetKeyScancodeX11(int key);
 const char* _grwlGetKeyboardLayoutNameX11();
-bool _grwlCreateCursorX11(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot);
+bool _grwlCreateCursorX11(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot);
 bool _grwlCreateStandardCursorX11(_GRWLcursor* cursor, int shape);
 void _grwlDestroyCursorX11(_GRWLcursor* cursor);
 void _grwlSetCursorX11(_GRWLwindow* window, _GRWLcursor* cursor);
 void _grwlSetClipboardStringX11(const char* string);
 const char* _grwlGetClipboardStringX11();
+bool _grwlRequestClipboardStringX11();
+void _grwlSetClipboardDataX11(const char* mimeType, const void* data, size_t size);
+const void* _grwlGetClipboardDataX11(const char* mimeType, size_t* size);
 
 void _grwlUpdatePreeditCursorRectangleX11(_GRWLwindow* window);
 void _grwlResetPreeditTextX11(_GRWLwindow* window);
@@ -1000,13 +1076,16 @@ void _grwlPollMonitorsX11();
 void _grwlSetVideoModeX11(_GRWLmonitor* monitor, const GRWLvidmode* desired);
 void _grwlRestoreVideoModeX11(_GRWLmonitor* monitor);
 
-Cursor _grwlCreateNativeCursorX11(const GRWLimage* image, int xhot, int yhot);
+Cursor _grwlCreateNativeCursorX11(const GRWLformattedimage* image, int xhot, int yhot);
 
 unsigned long _grwlGetWindowPropertyX11(Window window, Atom property, Atom type, unsigned char** value);
 bool _grwlIsVisualTransparentX11(Visual* visual);
 
 void _grwlGrabErrorHandlerX11();
 void _grwlReleaseErrorHandlerX11();
+void _grwlGrabPoolErrorHandlerX11();
+void _grwlReleasePoolErrorHandlerX11();
+bool _grwlWaitForDisplayX11(double* timeout);
 void _grwlInputErrorX11(int error, const char* message);
 
 void _grwlPushSelectionToManagerX11();
@@ -1018,6 +1097,7 @@ bool _grwlCreateContextGLX(_GRWLwindow* window, const _GRWLctxconfig* ctxconfig,
 void _grwlDestroyContextGLX(_GRWLwindow* window);
 bool _grwlChooseVisualGLX(const _GRWLwndconfig* wndconfig, const _GRWLctxconfig* ctxconfig,
                           const _GRWLfbconfig* fbconfig, Visual** visual, int* depth);
+bool _grwlInitContextPoolGLX(_GRWLcontextpool* pool, const _GRWLfbconfig* fbconfig);
 
 _GRWLusercontext* _grwlCreateUserContextX11(_GRWLwindow* window);
 _GRWLusercontext* _grwlCreateUserContextGLX(_GRWLwindow* window);
@@ -34,17 +34,19 @@
 
     #define _GRWL_XDND_VERSION 5
 
+    // Seconds to wait for a requestor to ask for the next chunk of an
+    // incremental selection transfer before giving up on it
+    #define _GRWL_INCR_TIMEOUT 5
+
 // Wait for event data to arrive on the X11 display socket
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
 static bool waitForX11Event(double* timeout)
 {
-    struct pollfd fd = { ConnectionNumber(_grwl.x11.display), POLLIN };
-
     while (!XPending(_grwl.x11.display))
     {
-        if (!_grwlPollPOSIX(&fd, 1, timeout))
+        if (!_grwlWaitForDisplayX11(timeout))
         {
             return false;
         }
@@ -59,65 +61,24 @@ static bool waitForX11Event(double* timeout)
 //
 static bool waitForAnyEvent(double* timeout)
 {
-    nfds_t count = 2;
-    struct pollfd fds[3] = { { ConnectionNumber(_grwl.x11.display), POLLIN }, { _grwl.x11.emptyEventPipe[0], POLLIN } };
-
-    #if defined(GRWL_BUILD_LINUX_JOYSTICK)
-    if (_grwl.joysticksInitialized)
-    {
-        fds[count++] = (struct pollfd) { _grwl.linjs.inotify, POLLIN };
-    }
-    #endif
-
     while (!XPending(_grwl.x11.display))
     {
-        if (!_grwlPollPOSIX(fds, count, timeout))
+        if (!_grwlWaitPollSourcesPOSIX(timeout))
         {
             return false;
         }
 
-        for (int i = 1; i < count; i++)
+        // Wakeups and joystick input are handled here, while display data is
+        // left for XPending
+        if (_grwlDispatchPollSourcesPOSIX())
         {
-            if (fds[i].revents & POLLIN)
-            {
-                return true;
-            }
+            return true;
         }
     }
 
     return true;
 }
 
-// Writes a byte to the empty event pipe
-//
-static void writeEmptyEvent()
-{
-    for (;;)
-    {
-        const char byte = 0;
-        const ssize_t result = write(_grwl.x11.emptyEventPipe[1], &byte, 1);
-        if (result == 1 || (result == -1 && errno != EINTR))
-        {
-            break;
-        }
-    }
-}
-
-// Drains available data from the empty event pipe
-//
-static void drainEmptyEvents()
-{
-    for (;;)
-    {
-        char dummy[64];
-        const ssize_t result = read(_grwl.x11.emptyEventPipe[0], dummy, sizeof(dummy));
-        if (result == -1 && errno != EINTR)
-        {
-            break;
-        }
-    }
-}
-
 // Waits until a VisibilityNotify event arrives for the specified window or the
 // timeout period elapses (ICCCM section 4.2.2)
 //
@@ -184,14 +145,29 @@ static Bool isFrameExtentsEvent(Display* display, XEvent* event, XPointer pointe
            event->xproperty.window == window->x11.handle && event->xproperty.atom == _grwl.x11.NET_FRAME_EXTENTS;
 }
 
-// Returns whether it is a property event for the specified selection transfer
+// Returns whether the event is a notification for the specified selection
+// transfer
 //
-static Bool isSelPropNewValueNotify(Display* display, XEvent* event, XPointer pointer)
+static Bool isTransferEvent(Display* display, XEvent* event, XPointer pointer)
 {
-    XEvent* notification = (XEvent*)pointer;
+    const _GRWLtransferX11* transfer = (const _GRWLtransferX11*)pointer;
+
+    if (!transfer->selection)
+    {
+        return False;
+    }
+
+    if (event->type == SelectionNotify)
+    {
+        // String and data transfers of the same selection may be pending at
+        // the same time, so the target tells them apart
+        return event->xselection.requestor == transfer->requestor &&
+               event->xselection.selection == transfer->selection &&
+               event->xselection.target == transfer->targets[transfer->targetIndex];
+    }
+
     return event->type == PropertyNotify && event->xproperty.state == PropertyNewValue &&
-           event->xproperty.window == notification->xselection.requestor &&
-           event->xproperty.atom == notification->xselection.property;
+           event->xproperty.window == transfer->requestor && event->xproperty.atom == transfer->property;
 }
 
 // Translates an X event modifier state mask
@@ -378,23 +354,63 @@ static void updateWindowMode(_GRWLwindow* window)
     }
 }
 
-// Convert the specified Latin-1 string to UTF-8
+// Hands the specified selection buffer over to the incremental transfers still
+// sending it, so that it is not overwritten
 //
-static char* convertLatin1toUTF8(const char* source)
+static void detachSelectionBuffer(char** buffer, size_t* capacity)
 {
-    size_t size = 1;
+    for (int i = 0; i < _grwl.x11.sendCount; i++)
+    {
+        if (_grwl.x11.sends[i].data == *buffer)
+        {
+            _grwl.x11.sends[i].ownsData = true;
+            *buffer = nullptr;
+            *capacity = 0;
+            return;
+        }
+    }
+}
+
+// Copies the specified string into the reused buffer of the specified selection,
+// converting it from Latin-1 to UTF-8 if needed
+//
+static char* storeSelectionString(Atom selection, const char* string, bool latin1)
+{
+    char** buffer;
+    size_t* capacity;
+
+    if (selection == _grwl.x11.PRIMARY)
+    {
+        buffer = &_grwl.x11.primarySelectionString;
+        capacity = &_grwl.x11.primarySelectionStringSize;
+    }
+    else
+    {
+        buffer = &_grwl.x11.clipboardString;
+        capacity = &_grwl.x11.clipboardStringSize;
+    }
+
+    detachSelectionBuffer(buffer, capacity);
 
-    for (const char* sp = source; *sp; sp++)
+    const size_t length = strlen(string);
+    const size_t size = (latin1 ? _grwlGetLatin1LengthUTF8(string, length) : length) + 1;
+
+    // The string may already be in the buffer, in which case it fits
+    char* target = (char*)_grwlReserveBuffer(*buffer, capacity, size);
+    if (!target)
     {
-        size += (*sp & 0x80) ? 2 : 1;
+        return nullptr;
     }
 
-    char* target = (char*)_grwl_calloc(size, 1);
-    char* tp = target;
+    *buffer = target;
 
-    for (const char* sp = source; *sp; sp++)
+    if (latin1)
     {
-        tp += _grwlEncodeUTF8(tp, *sp);
+        target[_grwlConvertLatin1toUTF8(target, string, length)] = '\0';
+    }
+    else
+    {
+        memmove(target, string, size);
     }
 
     return target;
@@ -546,7 +562,6 @@ static void _ximPreeditDrawCallback(XIC xic, XPointer clientData, XIMPreeditDraw
         int textLen = preedit->textCount + text->length - callData->chg_length;
         int textBufferCount = preedit->textBufferCount;
         int rstart, rend;
-        const char* src;
 
         // realloc preedit text
         while (textBufferCount < textLen + 1)
@@ -576,7 +591,16 @@ static void _ximPreeditDrawCallback(XIC xic, XPointer clientData, XIMPreeditDraw
         }
 
         // store preedit text
-        src = text->string.multi_byte;
+        const size_t length = strlen(text->string.multi_byte);
+        uint32_t* codepoints = (uint32_t*)_grwlArenaAlloc((length + 1) * sizeof(uint32_t));
+        if (!codepoints)
+        {
+            return;
+        }
+
+        const size_t codepointCount = _grwlDecodeUTF8(codepoints, text->string.multi_byte, length);
+        size_t k = 0;
+
         rend = 0;
         rstart = textLen;
         for (int i = 0, j = callData->chg_first; i < text->length; i++)
@@ -586,7 +610,7 @@ static void _ximPreeditDrawCallback(XIC xic, XPointer clientData, XIMPreeditDraw
                 continue;
             }
 
-            preedit->text[j++] = _grwlDecodeUTF8(&src);
+            preedit->text[j++] = k < codepointCount ? codepoints[k++] : 0;
             XIMFeedback f = text->feedback[i];
             if ((f & XIMReverse) || (f & XIMHighlight))
             {
@@ -941,21 +965,223 @@ static bool createNativeWindow(_GRWLwindow* window, const _GRWLwndconfig* wndcon
     return true;
 }
 
+// Returns the largest number of bytes written to a property in one request
+//
+static size_t getMaxPropertySize()
+{
+    // Leave room for the ChangeProperty request header
+    return (size_t)XMaxRequestSize(_grwl.x11.display) * 4 - 64;
+}
+
+// Ends the specified incremental transfer
+//
+static void finishSend(int index)
+{
+    _GRWLsendX11* send = _grwl.x11.sends + index;
+    bool shared = false;
+
+    for (int i = 0; i < _grwl.x11.sendCount; i++)
+    {
+        if (i != index && _grwl.x11.sends[i].requestor == send->requestor)
+        {
+            shared = true;
+        }
+    }
+
+    if (!shared)
+    {
+        // The requestor may already have been destroyed
+        _grwlGrabErrorHandlerX11();
+        XSelectInput(_grwl.x11.display, send->requestor, NoEventMask);
+        _grwlReleaseErrorHandlerX11();
+        _grwl.stats.roundTrips++;
+    }
+
+    if (send->ownsData)
+    {
+        // Pass the string on to another transfer still sending it, if any
+        int i;
+
+        for (i = 0; i < _grwl.x11.sendCount; i++)
+        {
+            if (i != index && _grwl.x11.sends[i].data == send->data)
+            {
+                _grwl.x11.sends[i].ownsData = true;
+                break;
+            }
+        }
+
+        if (i == _grwl.x11.sendCount)
+        {
+            _grwl_free(send->data);
+        }
+    }
+
+    _grwl.x11.sendCount--;
+    _grwl.x11.sends[index] = _grwl.x11.sends[_grwl.x11.sendCount];
+}
+
+// Writes the next chunk of the specified incremental transfer, after the
+// requestor has deleted the previous one
+// A chunk of zero length ends the transfer
+//
+static void writeNextChunk(int index)
+{
+    _GRWLsendX11* send = _grwl.x11.sends + index;
+    const size_t maxSize = getMaxPropertySize();
+    const size_t size = send->length - send->offset < maxSize ? send->length - send->offset : maxSize;
+
+    // The requestor may have been destroyed without us noticing yet
+    _grwlGrabErrorHandlerX11();
+    XChangeProperty(_grwl.x11.display, send->requestor, send->property, send->target, 8, PropModeReplace,
+                    (unsigned char*)send->data + send->offset, (int)size);
+    _grwlReleaseErrorHandlerX11();
+    _grwl.stats.roundTrips++;
+
+    if (size == 0 || _grwl.x11.errorCode != Success)
+    {
+        finishSend(index);
+        return;
+    }
+
+    send->offset += size;
+    send->lastActivity = _grwlPlatformGetTimerValue();
+}
+
+// Ends the incremental transfers whose requestors have stopped asking for data,
+// so that they do not keep their strings alive forever
+//
+static void expireStalledSends()
+{
+    const uint64_t now = _grwlPlatformGetTimerValue();
+    const uint64_t timeout = _GRWL_INCR_TIMEOUT * _grwlPlatformGetTimerFrequency();
+
+    for (int i = 0; i < _grwl.x11.sendCount; i++)
+    {
+        if (now - _grwl.x11.sends[i].lastActivity > timeout)
+        {
+            finishSend(i);
+            // The last transfer was moved into this slot
+            i--;
+        }
+    }
+}
+
+// Passes the specified event to the incremental transfer it belongs to, if any
+// Returns whether the event was handled
+//
+static bool handleSendEvents(const XEvent* event)
+{
+    for (int i = 0; i < _grwl.x11.sendCount; i++)
+    {
+        const _GRWLsendX11* send = _grwl.x11.sends + i;
+
+        if (event->type == DestroyNotify)
+        {
+            if (event->xdestroywindow.window == send->requestor)
+            {
+                finishSend(i);
+                // The last transfer was moved into this slot
+                i--;
+            }
+        }
+        else if (event->type == PropertyNotify)
+        {
+            if (event->xproperty.state == PropertyDelete && event->xproperty.window == send->requestor &&
+                event->xproperty.atom == send->property)
+            {
+                writeNextChunk(i);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Writes the specified selection data to the specified property, starting an
+// incremental transfer if the data is too large for a single request
+// The transfer is driven by the event loop, so a slow requestor cannot block it
+//
+static void writeSelectionData(Window requestor, Atom property, Atom target, char* data, size_t length)
+{
+    if (length > getMaxPropertySize())
+    {
+        // A new request for the same property replaces any earlier transfer
+        for (int i = 0; i < _grwl.x11.sendCount; i++)
+        {
+            if (_grwl.x11.sends[i].requestor == requestor && _grwl.x11.sends[i].property == property)
+            {
+                finishSend(i);
+                break;
+            }
+        }
+
+        _GRWLsendX11* sends = (_GRWLsendX11*)_grwlReserveBuffer(_grwl.x11.sends, &_grwl.x11.sendArraySize,
+                                                               (_grwl.x11.sendCount + 1) * sizeof(_GRWLsendX11));
+        if (sends)
+        {
+            _grwl.x11.sends = sends;
+
+            _GRWLsendX11* send = sends + _grwl.x11.sendCount;
+            memset(send, 0, sizeof(_GRWLsendX11));
+            send->requestor = requestor;
+            send->property = property;
+            send->target = target;
+            send->data = data;
+            send->length = length;
+            send->lastActivity = _grwlPlatformGetTimerValue();
+            _grwl.x11.sendCount++;
+
+            // The requestor deletes the property each time it wants the next
+            // chunk, so we need to know when that happens
+            const long size = (long)length;
+            _grwlGrabErrorHandlerX11();
+            XSelectInput(_grwl.x11.display, requestor, PropertyChangeMask | StructureNotifyMask);
+            XChangeProperty(_grwl.x11.display, requestor, property, _grwl.x11.INCR, 32, PropModeReplace,
+                            (unsigned char*)&size, 1);
+            _grwlReleaseErrorHandlerX11();
+            _grwl.stats.roundTrips++;
+
+            if (_grwl.x11.errorCode != Success)
+            {
+                finishSend(_grwl.x11.sendCount - 1);
+            }
+
+            return;
+        }
+    }
+
+    XChangeProperty(_grwl.x11.display, requestor, property, target, 8, PropModeReplace, (unsigned char*)data,
+                    (int)length);
+}
+
 // Set the specified property to the selection converted to the requested target
 //
 static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 {
-    char* selectionString = nullptr;
-    const Atom formats[] = { _grwl.x11.UTF8_STRING, XA_STRING };
-    const int formatCount = sizeof(formats) / sizeof(formats[0]);
+    char* selectionData = nullptr;
+    size_t selectionLength = 0;
+    Atom formats[] = { _grwl.x11.UTF8_STRING, XA_STRING };
+    int formatCount = sizeof(formats) / sizeof(formats[0]);
 
     if (request->selection == _grwl.x11.PRIMARY)
     {
-        selectionString = _grwl.x11.primarySelectionString;
+        selectionData = _grwl.x11.primarySelectionString;
+        selectionLength = strlen(selectionData);
+    }
+    else if (_grwl.x11.clipboardDataType != None)
+    {
+        // The clipboard holds data of a single type
+        selectionData = _grwl.x11.clipboardData;
+        selectionLength = _grwl.x11.clipboardDataLength;
+        formats[0] = _grwl.x11.clipboardDataType;
+        formatCount = 1;
     }
     else
     {
-        selectionString = _grwl.x11.clipboardString;
+        selectionData = _grwl.x11.clipboardString;
+        selectionLength = strlen(selectionData);
     }
 
     if (request->property == None)
@@ -969,10 +1195,10 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
     {
         // The list of supported targets was requested
 
-        const Atom targets[] = { _grwl.x11.TARGETS, _grwl.x11.MULTIPLE, _grwl.x11.UTF8_STRING, XA_STRING };
+        const Atom targets[] = { _grwl.x11.TARGETS, _grwl.x11.MULTIPLE, formats[0], formats[1] };
 
         XChangeProperty(_grwl.x11.display, request->requestor, request->property, XA_ATOM, 32, PropModeReplace,
-                        (unsigned char*)targets, sizeof(targets) / sizeof(targets[0]));
+                        (unsigned char*)targets, 2 + formatCount);
 
         return request->property;
     }
@@ -999,8 +1225,7 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
             if (j < formatCount)
             {
-                XChangeProperty(_grwl.x11.display, request->requestor, targets[i + 1], targets[i], 8, PropModeReplace,
-                                (unsigned char*)selectionString, strlen(selectionString));
+                writeSelectionData(request->requestor, targets[i + 1], targets[i], selectionData, selectionLength);
             }
             else
             {
@@ -1035,8 +1260,8 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
         {
             // The requested target is one we support
 
-            XChangeProperty(_grwl.x11.display, request->requestor, request->property, request->target, 8,
-                            PropModeReplace, (unsigned char*)selectionString, strlen(selectionString));
+            writeSelectionData(request->requestor, request->property, request->target, selectionData,
+                               selectionLength);
 
             return request->property;
         }
@@ -1062,128 +1287,335 @@ static void handleSelectionRequest(XEvent* event)
     XSendEvent(_grwl.x11.display, request->requestor, False, 0, &reply);
 }
 
-static const char* getSelectionString(Atom selection)
+// Asks the selection owner to convert the selection to the current target of
+// the specified transfer
+//
+static void requestTransferTarget(_GRWLtransferX11* transfer)
+{
+    transfer->incremental = false;
+    transfer->length = 0;
+
+    XConvertSelection(_grwl.x11.display, transfer->selection, transfer->targets[transfer->targetIndex],
+                      transfer->property, transfer->requestor, transfer->time);
+    XFlush(_grwl.x11.display);
+}
+
+// Starts converting the specified selection, trying each target in order
+//
+static void beginTransfer(_GRWLtransferX11* transfer, Atom selection, const Atom* targets, int targetCount,
+                          Window requestor, Atom property, Time time)
+{
+    transfer->selection = selection;
+    transfer->requestor = requestor;
+    transfer->property = property;
+    transfer->time = time;
+    memcpy(transfer->targets, targets, targetCount * sizeof(Atom));
+    transfer->targetCount = targetCount;
+    transfer->targetIndex = 0;
+    transfer->result = nullptr;
+
+    requestTransferTarget(transfer);
+}
+
+// Starts converting the specified selection to a string
+//
+static void beginStringTransfer(Atom selection)
 {
-    char** selectionString = nullptr;
     const Atom targets[] = { _grwl.x11.UTF8_STRING, XA_STRING };
-    const size_t targetCount = sizeof(targets) / sizeof(targets[0]);
+    const int targetCount = sizeof(targets) / sizeof(targets[0]);
 
     if (selection == _grwl.x11.PRIMARY)
     {
-        selectionString = &_grwl.x11.primarySelectionString;
+        beginTransfer(&_grwl.x11.primaryTransfer, selection, targets, targetCount, _grwl.x11.helperWindowHandle,
+                      _grwl.x11.GRWL_PRIMARY_SELECTION, CurrentTime);
     }
     else
     {
-        selectionString = &_grwl.x11.clipboardString;
+        beginTransfer(&_grwl.x11.clipboardTransfer, selection, targets, targetCount, _grwl.x11.helperWindowHandle,
+                      _grwl.x11.GRWL_SELECTION, CurrentTime);
     }
+}
 
-    if (XGetSelectionOwner(_grwl.x11.display, selection) == _grwl.x11.helperWindowHandle)
-    {
-        // Instead of doing a large number of X round-trips just to put this
-        // string into a window property and then read it back, just return it
-        return *selectionString;
-    }
+// Delivers the data of the specified transfer, or reports that it failed if
+// the data is nullptr
+//
+static void finishTransfer(_GRWLtransferX11* transfer, const char* data, size_t length)
+{
+    const Atom selection = transfer->selection;
 
-    _grwl_free(*selectionString);
-    *selectionString = nullptr;
+    // The transfer is over before any callback is called, as a callback may
+    // start another one
+    transfer->selection = None;
+    transfer->incremental = false;
 
-    for (size_t i = 0; i < targetCount; i++)
+    if (transfer == &_grwl.x11.dataTransfer)
     {
-        char* data;
-        Atom actualType;
-        int actualFormat;
-        unsigned long itemCount, bytesAfter;
-        XEvent notification, dummy;
-
-        XConvertSelection(_grwl.x11.display, selection, targets[i], _grwl.x11.GRWL_SELECTION,
-                          _grwl.x11.helperWindowHandle, CurrentTime);
-
-        while (!XCheckTypedWindowEvent(_grwl.x11.display, _grwl.x11.helperWindowHandle, SelectionNotify, &notification))
+        // Binary data may contain null bytes, so it is kept with its length in
+        // the transfer buffer
+        if (data && data != transfer->buffer)
         {
-            waitForX11Event(nullptr);
+            char* buffer = (char*)_grwlReserveBuffer(transfer->buffer, &transfer->capacity, length + 1);
+            if (buffer)
+            {
+                transfer->buffer = buffer;
+                memcpy(buffer, data, length);
+                buffer[length] = '\0';
+            }
+            else
+            {
+                data = nullptr;
+            }
         }
 
-        if (notification.xselection.property == None)
+        if (data)
+        {
+            transfer->length = length;
+            transfer->result = transfer->buffer;
+        }
+        else
         {
-            continue;
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "X11: Failed to convert clipboard to the requested type");
         }
 
-        XCheckIfEvent(_grwl.x11.display, &dummy, isSelPropNewValueNotify, (XPointer)&notification);
+        return;
+    }
 
-        XGetWindowProperty(_grwl.x11.display, notification.xselection.requestor, notification.xselection.property, 0,
-                           LONG_MAX, True, AnyPropertyType, &actualType, &actualFormat, &itemCount, &bytesAfter,
-                           (unsigned char**)&data);
+    if (transfer == &_grwl.x11.dropTransfer)
+    {
+        _GRWLwindow* window = transfer->window;
+        transfer->window = nullptr;
 
-        if (actualType == _grwl.x11.INCR)
+        if (data && window)
         {
-            size_t size = 1;
-            char* string = nullptr;
+            int count;
+            char** paths = _grwlParseUriList(data, &count);
 
-            for (;;)
+            if (paths)
             {
-                while (!XCheckIfEvent(_grwl.x11.display, &dummy, isSelPropNewValueNotify, (XPointer)&notification))
-                {
-                    waitForX11Event(nullptr);
-                }
+                _grwlInputDrop(window, count, (const char**)paths);
+            }
+        }
 
-                XFree(data);
-                XGetWindowProperty(_grwl.x11.display, notification.xselection.requestor,
-                                   notification.xselection.property, 0, LONG_MAX, True, AnyPropertyType, &actualType,
-                                   &actualFormat, &itemCount, &bytesAfter, (unsigned char**)&data);
+        if (_grwl.x11.xdnd.version >= 2)
+        {
+            XEvent reply = { ClientMessage };
+            reply.xclient.window = _grwl.x11.xdnd.source;
+            reply.xclient.message_type = _grwl.x11.XdndFinished;
+            reply.xclient.format = 32;
+            reply.xclient.data.l[0] = transfer->requestor;
+            reply.xclient.data.l[1] = data != nullptr;
+            reply.xclient.data.l[2] = _grwl.x11.XdndActionCopy;
+
+            XSendEvent(_grwl.x11.display, _grwl.x11.xdnd.source, False, NoEventMask, &reply);
+            XFlush(_grwl.x11.display);
+        }
 
-                if (itemCount)
-                {
-                    size += itemCount;
-                    string = (char*)_grwl_realloc(string, size);
-                    string[size - itemCount - 1] = '\0';
-                    strcat(string, data);
-                }
+        return;
+    }
 
-                if (!itemCount)
-                {
-                    if (string)
-                    {
-                        if (targets[i] == XA_STRING)
-                        {
-                            *selectionString = convertLatin1toUTF8(string);
-                            _grwl_free(string);
-                        }
-                        else
-                        {
-                            *selectionString = string;
-                        }
-                    }
+    const char* string = nullptr;
 
-                    break;
-                }
-            }
+    if (data)
+    {
+        string = storeSelectionString(selection, data, transfer->targets[transfer->targetIndex] == XA_STRING);
+    }
+    else
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "X11: Failed to convert selection to string");
+    }
+
+    transfer->result = string;
+
+    if (transfer == &_grwl.x11.clipboardTransfer)
+    {
+        _grwlInputClipboardString(string);
+    }
+}
+
+// Requests the next target of the specified transfer, or fails the transfer if
+// there are no more targets
+//
+static void requestNextTransferTarget(_GRWLtransferX11* transfer)
+{
+    transfer->targetIndex++;
+
+    if (transfer->targetIndex < transfer->targetCount)
+    {
+        requestTransferTarget(transfer);
+    }
+    else
+    {
+        finishTransfer(transfer, nullptr, 0);
+    }
+}
+
+// Processes a notification for the specified selection transfer
+// Chunks of incremental transfers are appended to a buffer that grows
+// geometrically, so large transfers take linear time
+//
+static void handleTransferEvent(_GRWLtransferX11* transfer, const XEvent* event)
+{
+    if (event->type == SelectionNotify)
+    {
+        if (event->xselection.property == None)
+        {
+            // The owner could not convert the selection to this target
+            requestNextTransferTarget(transfer);
+            return;
         }
-        else if (actualType == targets[i])
+    }
+    else if (!transfer->incremental)
+    {
+        // The owner has written the whole reply or the INCR marker, which is
+        // read when the SelectionNotify event arrives
+        return;
+    }
+
+    char* data = nullptr;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+
+    // Deleting the property tells the owner of an incremental transfer to
+    // write the next chunk
+    _grwl.stats.roundTrips++;
+    XGetWindowProperty(_grwl.x11.display, transfer->requestor, transfer->property, 0, LONG_MAX, True,
+                       AnyPropertyType, &actualType, &actualFormat, &itemCount, &bytesAfter, (unsigned char**)&data);
+
+    if (event->type == SelectionNotify)
+    {
+        if (actualType == _grwl.x11.INCR)
         {
-            if (targets[i] == XA_STRING)
-            {
-                *selectionString = convertLatin1toUTF8(data);
-            }
-            else
-            {
-                *selectionString = _grwl_strdup(data);
-            }
+            transfer->incremental = true;
+        }
+        else if (actualType == transfer->targets[transfer->targetIndex] && data)
+        {
+            finishTransfer(transfer, data, itemCount);
         }
+        else
+        {
+            requestNextTransferTarget(transfer);
+        }
+    }
+    else if (itemCount)
+    {
+        char* buffer =
+            (char*)_grwlReserveBuffer(transfer->buffer, &transfer->capacity, transfer->length + itemCount + 1);
+        if (buffer)
+        {
+            transfer->buffer = buffer;
+            memcpy(buffer + transfer->length, data, itemCount);
+            transfer->length += itemCount;
+            buffer[transfer->length] = '\0';
+        }
+        else
+        {
+            finishTransfer(transfer, nullptr, 0);
+        }
+    }
+    else if (transfer->length)
+    {
+        // A chunk of zero length marks the end of the transfer
+        finishTransfer(transfer, transfer->buffer, transfer->length);
+    }
+    else
+    {
+        requestNextTransferTarget(transfer);
+    }
 
+    if (data)
+    {
         XFree(data);
+    }
+}
+
+// Passes the specified event to the selection transfer it belongs to, if any
+// Returns whether the event was handled
+//
+static bool handleTransferEvents(const XEvent* event)
+{
+    _GRWLtransferX11* transfers[] = { &_grwl.x11.clipboardTransfer, &_grwl.x11.primaryTransfer,
+                                      &_grwl.x11.dropTransfer, &_grwl.x11.dataTransfer };
+
+    for (size_t i = 0; i < sizeof(transfers) / sizeof(transfers[0]); i++)
+    {
+        if (isTransferEvent(_grwl.x11.display, (XEvent*)event, (XPointer)transfers[i]))
+        {
+            handleTransferEvent(transfers[i], event);
+            return true;
+        }
+    }
+
+    return false;
+}
 
-        if (*selectionString)
+// Waits for the specified transfer to finish
+// Only the events of the transfer are processed while waiting, in order
+//
+static void waitForTransfer(_GRWLtransferX11* transfer)
+{
+    while (transfer->selection)
+    {
+        XEvent event;
+
+        // This reads any available data from the display connection, so only
+        // the socket and the display reader need to be waited on if no
+        // matching event was found
+        if (XCheckIfEvent(_grwl.x11.display, &event, isTransferEvent, (XPointer)transfer))
+        {
+            handleTransferEvent(transfer, &event);
+        }
+        else if (!_grwlWaitForDisplayX11(nullptr))
         {
             break;
         }
     }
+}
 
-    if (!*selectionString)
+// Returns the specified selection as a string, waiting for the transfer to
+// finish
+//
+static const char* getSelectionString(Atom selection)
+{
+    _grwl.stats.roundTrips++;
+    if (XGetSelectionOwner(_grwl.x11.display, selection) == _grwl.x11.helperWindowHandle)
     {
-        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "X11: Failed to convert selection to string");
+        // Instead of doing a large number of X round-trips just to put this
+        // string into a window property and then read it back, just return it
+        if (selection == _grwl.x11.PRIMARY)
+        {
+            return _grwl.x11.primarySelectionString;
+        }
+        else if (_grwl.x11.clipboardDataType != None)
+        {
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "X11: The clipboard holds data that is not a string");
+            return nullptr;
+        }
+        else
+        {
+            return _grwl.x11.clipboardString;
+        }
     }
 
-    return *selectionString;
+    _GRWLtransferX11* transfer;
+
+    if (selection == _grwl.x11.PRIMARY)
+    {
+        transfer = &_grwl.x11.primaryTransfer;
+    }
+    else
+    {
+        transfer = &_grwl.x11.clipboardTransfer;
+    }
+
+    // A pending request may already have started the transfer
+    if (!transfer->selection)
+    {
+        beginStringTransfer(selection);
+    }
+
+    waitForTransfer(transfer);
+    return transfer->result;
 }
 
 // Make the specified window and its video mode active on its monitor
@@ -1244,12 +1676,40 @@ static void releaseMonitor(_GRWLwindow* window)
     }
 }
 
+// Returns the time at which the specified event was generated, or zero if the
+// event has no timestamp
+//
+static uint64_t getEventTime(const XEvent* event)
+{
+    switch (event->type)
+    {
+        case KeyPress:
+        case KeyRelease:
+            return _grwlConvertEventTime((uint32_t)event->xkey.time);
+        case ButtonPress:
+        case ButtonRelease:
+            return _grwlConvertEventTime((uint32_t)event->xbutton.time);
+        case MotionNotify:
+            return _grwlConvertEventTime((uint32_t)event->xmotion.time);
+        case EnterNotify:
+        case LeaveNotify:
+            return _grwlConvertEventTime((uint32_t)event->xcrossing.time);
+        case PropertyNotify:
+            return _grwlConvertEventTime((uint32_t)event->xproperty.time);
+    }
+
+    return 0;
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent* event)
 {
     int keycode = 0;
 
+    _grwl.stats.events++;
+    _grwl.eventTime = getEventTime(event);
+
     // HACK: Save scancode as some IMs clear the field in XFilterEvent
     if (event->type == KeyPress || event->type == KeyRelease)
     {
@@ -1296,6 +1756,8 @@ static void processEvent(XEvent* event)
                 XGetEventData(_grwl.x11.display, &event->xcookie) && event->xcookie.evtype == XI_RawMotion)
             {
                 XIRawEvent* re = (XIRawEvent*)event->xcookie.data;
+                _grwl.eventTime = _grwlConvertEventTime((uint32_t)re->time);
+
                 if (re->valuators.mask_len)
                 {
                     const double* values = re->raw_values;
@@ -1329,6 +1791,22 @@ static void processEvent(XEvent* event)
         return;
     }
 
+    if (event->type == SelectionNotify || event->type == PropertyNotify)
+    {
+        if (handleTransferEvents(event))
+        {
+            return;
+        }
+    }
+
+    if (event->type == PropertyNotify || event->type == DestroyNotify)
+    {
+        if (handleSendEvents(event))
+        {
+            return;
+        }
+    }
+
     _GRWLwindow* window = nullptr;
     if (XFindContext(_grwl.x11.display, event->xany.window, _grwl.x11.context, (XPointer*)&window) != 0)
     {
@@ -1379,24 +1857,22 @@ static void processEvent(XEvent* event)
 
                 if (status == XBufferOverflow)
                 {
-                    chars = (char*)_grwl_calloc(count + 1, 1);
+                    chars = (char*)_grwlArenaAlloc(count + 1);
                     count = Xutf8LookupString(window->x11.ic, &event->xkey, chars, count, nullptr, &status);
                 }
 
                 if (status == XLookupChars || status == XLookupBoth)
                 {
-                    const char* c = chars;
-                    chars[count] = '\0';
-                    while (c - chars < count)
+                    uint32_t* codepoints = (uint32_t*)_grwlArenaAlloc(count * sizeof(uint32_t));
+                    if (codepoints)
                     {
-                        _grwlInputChar(window, _grwlDecodeUTF8(&c), mods, plain);
+                        const size_t codepointCount = _grwlDecodeUTF8(codepoints, chars, count);
+                        for (size_t i = 0; i < codepointCount; i++)
+                        {
+                            _grwlInputChar(window, codepoints[i], mods, plain);
+                        }
                     }
                 }
-
-                if (chars != buffer)
-                {
-                    _grwl_free(chars);
-                }
             }
             else
             {
@@ -1611,6 +2087,7 @@ static void processEvent(XEvent* event)
                 _grwlGrabErrorHandlerX11();
 
                 Window dummy;
+                _grwl.stats.roundTrips++;
                 XTranslateCoordinates(_grwl.x11.display, window->x11.parent, _grwl.x11.root, xpos, ypos, &xpos, &ypos,
                                       &dummy);
 
@@ -1726,8 +2203,10 @@ static void processEvent(XEvent* event)
                     }
 
                     // Request the chosen format from the source window
-                    XConvertSelection(_grwl.x11.display, _grwl.x11.XdndSelection, _grwl.x11.xdnd.format,
-                                      _grwl.x11.XdndSelection, window->x11.handle, time);
+                    // The data is read and delivered by the event loop as it arrives
+                    beginTransfer(&_grwl.x11.dropTransfer, _grwl.x11.XdndSelection, &_grwl.x11.xdnd.format, 1,
+                                  window->x11.handle, _grwl.x11.XdndSelection, time);
+                    _grwl.x11.dropTransfer.window = window;
                 }
                 else if (_grwl.x11.xdnd.version >= 2)
                 {
@@ -1756,6 +2235,7 @@ static void processEvent(XEvent* event)
                     return;
                 }
 
+                _grwl.stats.roundTrips++;
                 XTranslateCoordinates(_grwl.x11.display, _grwl.x11.root, window->x11.handle, xabs, yabs, &xpos, &ypos,
                                       &dummy);
 
@@ -1786,53 +2266,6 @@ static void processEvent(XEvent* event)
             return;
         }
 
-        case SelectionNotify:
-        {
-            if (event->xselection.property == _grwl.x11.XdndSelection)
-            {
-                // The converted data from the drag operation has arrived
-                char* data;
-                const unsigned long result =
-                    _grwlGetWindowPropertyX11(event->xselection.requestor, event->xselection.property,
-                                              event->xselection.target, (unsigned char**)&data);
-
-                if (result)
-                {
-                    int count;
-                    char** paths = _grwlParseUriList(data, &count);
-
-                    _grwlInputDrop(window, count, (const char**)paths);
-
-                    for (int i = 0; i < count; i++)
-                    {
-                        _grwl_free(paths[i]);
-                    }
-                    _grwl_free(paths);
-                }
-
-                if (data)
-                {
-                    XFree(data);
-                }
-
-                if (_grwl.x11.xdnd.version >= 2)
-                {
-                    XEvent reply = { ClientMessage };
-                    reply.xclient.window = _grwl.x11.xdnd.source;
-                    reply.xclient.message_type = _grwl.x11.XdndFinished;
-                    reply.xclient.format = 32;
-                    reply.xclient.data.l[0] = window->x11.handle;
-                    reply.xclient.data.l[1] = result;
-                    reply.xclient.data.l[2] = _grwl.x11.XdndActionCopy;
-
-                    XSendEvent(_grwl.x11.display, _grwl.x11.xdnd.source, False, NoEventMask, &reply);
-                    XFlush(_grwl.x11.display);
-                }
-            }
-
-            return;
-        }
-
         case FocusIn:
         {
             if (event->xfocus.mode == NotifyGrab || event->xfocus.mode == NotifyUngrab)
@@ -1963,6 +2396,7 @@ unsigned long _grwlGetWindowPropertyX11(Window window, Atom property, Atom type,
     int actualFormat;
     unsigned long itemCount, bytesAfter;
 
+    _grwl.stats.roundTrips++;
     XGetWindowProperty(_grwl.x11.display, window, property, 0, LONG_MAX, False, type, &actualType, &actualFormat,
                        &itemCount, &bytesAfter, value);
 
@@ -2059,6 +2493,7 @@ void _grwlCreateInputContextX11(_GRWLwindow* window)
     if (window->x11.ic)
     {
         XWindowAttributes attribs;
+        _grwl.stats.roundTrips++;
         XGetWindowAttributes(_grwl.x11.display, window->x11.handle, &attribs);
 
         unsigned long filter = 0;
@@ -2195,6 +2630,12 @@ bool _grwlCreateWindowX11(_GRWLwindow* window, const _GRWLwndconfig* wndconfig,
 
 void _grwlDestroyWindowX11(_GRWLwindow* window)
 {
+    if (_grwl.x11.dropTransfer.selection && _grwl.x11.dropTransfer.window == window)
+    {
+        // Tell the drag source that the drop failed, as its data has no target
+        finishTransfer(&_grwl.x11.dropTransfer, nullptr, 0);
+    }
+
     if (_grwl.x11.disabledCursorWindow == window)
     {
         enableCursor(window);
@@ -2250,7 +2691,7 @@ void _grwlSetWindowTitleX11(_GRWLwindow* window, const char* title)
     XFlush(_grwl.x11.display);
 }
 
-void _grwlSetWindowIconX11(_GRWLwindow* window, int count, const GRWLimage* images)
+void _grwlSetWindowIconX11(_GRWLwindow* window, int count, const GRWLformattedimage* images)
 {
     if (count)
     {
@@ -2266,16 +2707,26 @@ void _grwlSetWindowIconX11(_GRWLwindow* window, int count, const GRWLimage* imag
 
         for (int i = 0; i < count; i++)
         {
+            const int pixelCount = images[i].width * images[i].height;
+
             *target++ = images[i].width;
             *target++ = images[i].height;
 
-            for (int j = 0; j < images[i].width * images[i].height; j++)
+            // Convert to 32-bit ARGB at the start of the space for the pixels,
+            // then widen to longs in place from the end if they are larger
+            _grwlConvertImage(target, _GRWL_IMAGE_ARGB32, images + i);
+
+            if (sizeof(unsigned long) > sizeof(uint32_t))
             {
-                *target++ = (((unsigned long)images[i].pixels[j * 4 + 0]) << 16) |
-                            (((unsigned long)images[i].pixels[j * 4 + 1]) << 8) |
-                            (((unsigned long)images[i].pixels[j * 4 + 2]) << 0) |
-                            (((unsigned long)images[i].pixels[j * 4 + 3]) << 24);
+                for (int j = pixelCount - 1; j >= 0; j--)
+                {
+                    uint32_t value;
+                    memcpy(&value, (unsigned char*)target + j * sizeof(uint32_t), sizeof(value));
+                    target[j] = value;
+                }
             }
+
+            target += pixelCount;
         }
 
         // NOTE: XChangeProperty expects 32-bit values like the image data above to be
@@ -2330,6 +2781,7 @@ void _grwlGetWindowPosX11(_GRWLwindow* window, int* xpos, int* ypos)
     Window dummy;
     int x, y;
 
+    _grwl.stats.roundTrips++;
     XTranslateCoordinates(_grwl.x11.display, window->x11.handle, _grwl.x11.root, 0, 0, &x, &y, &dummy);
 
     if (xpos)
@@ -2369,6 +2821,7 @@ void _grwlSetWindowPosX11(_GRWLwindow* window, int xpos, int ypos)
 void _grwlGetWindowSizeX11(_GRWLwindow* window, int* width, int* height)
 {
     XWindowAttributes attribs;
+    _grwl.stats.roundTrips++;
     XGetWindowAttributes(_grwl.x11.display, window->x11.handle, &attribs);
 
     if (width)
@@ -2702,6 +3155,7 @@ bool _grwlWindowFocusedX11(_GRWLwindow* window)
     Window focused;
     int state;
 
+    _grwl.stats.roundTrips++;
     XGetInputFocus(_grwl.x11.display, &focused, &state);
     return window->x11.handle == focused;
 }
@@ -2714,6 +3168,7 @@ bool _grwlWindowIconifiedX11(_GRWLwindow* window)
 bool _grwlWindowVisibleX11(_GRWLwindow* window)
 {
     XWindowAttributes wa;
+    _grwl.stats.roundTrips++;
     XGetWindowAttributes(_grwl.x11.display, window->x11.handle, &wa);
     return wa.map_state == IsViewable;
 }
@@ -2759,6 +3214,7 @@ bool _grwlWindowHoveredX11(_GRWLwindow* window)
 
         _grwlGrabErrorHandlerX11();
 
+        _grwl.stats.roundTrips++;
         const Bool result = XQueryPointer(_grwl.x11.display, w, &root, &w, &rootX, &rootY, &childX, &childY, &mask);
 
         _grwlReleaseErrorHandlerX11();
@@ -2787,6 +3243,7 @@ bool _grwlFramebufferTransparentX11(_GRWLwindow* window)
         return false;
     }
 
+    _grwl.stats.roundTrips++;
     return XGetSelectionOwner(_grwl.x11.display, _grwl.x11.NET_WM_CM_Sx) != None;
 }
 
@@ -2900,6 +3357,7 @@ float _grwlGetWindowOpacityX11(_GRWLwindow* window)
 {
     float opacity = 1.f;
 
+    _grwl.stats.roundTrips++;
     if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.NET_WM_CM_Sx))
     {
         CARD32* value = nullptr;
@@ -2955,14 +3413,15 @@ bool _grwlRawMouseMotionSupportedX11()
 
 void _grwlPollEventsX11()
 {
-    drainEmptyEvents();
+    _GRWL_TRACE_ZONE("_grwlPollEventsX11");
 
-    #if defined(GRWL_BUILD_LINUX_JOYSTICK)
-    if (_grwl.joysticksInitialized)
+    // Handle any wakeups and joystick input without blocking
+    double timeout = 0.0;
+    if (_grwlWaitPollSourcesPOSIX(&timeout))
     {
-        _grwlDetectJoystickConnectionLinux();
+        _grwlDispatchPollSourcesPOSIX();
     }
-    #endif
+
     XPending(_grwl.x11.display);
 
     while (QLength(_grwl.x11.display))
@@ -2972,6 +3431,13 @@ void _grwlPollEventsX11()
         processEvent(&event);
     }
 
+    _grwl.eventTime = 0;
+
+    if (_grwl.x11.sendCount)
+    {
+        expireStalledSends();
+    }
+
     _GRWLwindow* window = _grwl.x11.disabledCursorWindow;
     if (window)
     {
@@ -3003,7 +3469,7 @@ void _grwlWaitEventsTimeoutX11(double timeout)
 
 void _grwlPostEmptyEventX11()
 {
-    writeEmptyEvent();
+    _grwlPostEmptyEventPOSIX();
 }
 
 void _grwlGetCursorPosX11(_GRWLwindow* window, double* xpos, double* ypos)
@@ -3012,6 +3478,7 @@ void _grwlGetCursorPosX11(_GRWLwindow* window, double* xpos, double* ypos)
     int rootX, rootY, childX, childY;
     unsigned int mask;
 
+    _grwl.stats.roundTrips++;
     XQueryPointer(_grwl.x11.display, window->x11.handle, &root, &child, &rootX, &rootY, &childX, &childY, &mask);
 
     if (xpos)
@@ -3129,6 +3596,7 @@ const char* _grwlGetKeyboardLayoutNameX11()
     }
 
     XkbStateRec state = { 0 };
+    _grwl.stats.roundTrips++;
     XkbGetState(_grwl.x11.display, XkbUseCoreKbd, &state);
 
     XkbDescPtr desc = XkbAllocKeyboard();
@@ -3153,7 +3621,7 @@ const char* _grwlGetKeyboardLayoutNameX11()
     return _grwl.x11.keyboardLayoutName;
 }
 
-bool _grwlCreateCursorX11(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot)
+bool _grwlCreateCursorX11(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot)
 {
     cursor->x11.handle = _grwlCreateNativeCursorX11(image, xhot, yhot);
     if (!cursor->x11.handle)
@@ -3279,12 +3747,12 @@ void _grwlSetCursorX11(_GRWLwindow* window, _GRWLcursor* cursor)
 
 void _grwlSetClipboardStringX11(const char* string)
 {
-    char* copy = _grwl_strdup(string);
-    _grwl_free(_grwl.x11.clipboardString);
-    _grwl.x11.clipboardString = copy;
+    storeSelectionString(_grwl.x11.CLIPBOARD, string, false);
+    _grwl.x11.clipboardDataType = None;
 
     XSetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD, _grwl.x11.helperWindowHandle, CurrentTime);
 
+    _grwl.stats.roundTrips++;
     if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD) != _grwl.x11.helperWindowHandle)
     {
         _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to become owner of clipboard selection");
@@ -3296,6 +3764,78 @@ const char* _grwlGetClipboardStringX11()
     return getSelectionString(_grwl.x11.CLIPBOARD);
 }
 
+bool _grwlRequestClipboardStringX11()
+{
+    _grwl.stats.roundTrips++;
+    if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD) == _grwl.x11.helperWindowHandle)
+    {
+        // The string is ours, so there is no transfer to wait for
+        return _grwlRequestClipboardStringDeferred();
+    }
+
+    if (!_grwl.x11.clipboardTransfer.selection)
+    {
+        beginStringTransfer(_grwl.x11.CLIPBOARD);
+    }
+
+    return true;
+}
+
+void _grwlSetClipboardDataX11(const char* mimeType, const void* data, size_t size)
+{
+    detachSelectionBuffer(&_grwl.x11.clipboardData, &_grwl.x11.clipboardDataSize);
+
+    char* buffer = (char*)_grwlReserveBuffer(_grwl.x11.clipboardData, &_grwl.x11.clipboardDataSize, size + 1);
+    if (!buffer)
+    {
+        return;
+    }
+
+    memcpy(buffer, data, size);
+    _grwl.x11.clipboardData = buffer;
+    _grwl.x11.clipboardDataLength = size;
+    _grwl.x11.clipboardDataType = XInternAtom(_grwl.x11.display, mimeType, False);
+
+    XSetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD, _grwl.x11.helperWindowHandle, CurrentTime);
+
+    _grwl.stats.roundTrips++;
+    if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD) != _grwl.x11.helperWindowHandle)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to become owner of clipboard selection");
+    }
+}
+
+const void* _grwlGetClipboardDataX11(const char* mimeType, size_t* size)
+{
+    const Atom type = XInternAtom(_grwl.x11.display, mimeType, False);
+
+    _grwl.stats.roundTrips++;
+    if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.CLIPBOARD) == _grwl.x11.helperWindowHandle)
+    {
+        if (type != _grwl.x11.clipboardDataType)
+        {
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "X11: The clipboard has no data of type %s", mimeType);
+            return nullptr;
+        }
+
+        *size = _grwl.x11.clipboardDataLength;
+        return _grwl.x11.clipboardData;
+    }
+
+    _GRWLtransferX11* transfer = &_grwl.x11.dataTransfer;
+
+    beginTransfer(transfer, _grwl.x11.CLIPBOARD, &type, 1, _grwl.x11.helperWindowHandle,
+                  _grwl.x11.GRWL_CLIPBOARD_DATA, CurrentTime);
+    waitForTransfer(transfer);
+
+    if (transfer->result)
+    {
+        *size = transfer->length;
+    }
+
+    return transfer->result;
+}
+
 // When using STYLE_ONTHESPOT, this doesn't work and the cursor position can't be updated
 //
 void _grwlUpdatePreeditCursorRectangleX11(_GRWLwindow* window)
@@ -3630,6 +4170,7 @@ GRWLAPI Window grwlGetX11Window(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(None);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, None);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_X11)
     {
@@ -3650,11 +4191,11 @@ GRWLAPI void grwlSetX11SelectionString(const char* string)
         return;
     }
 
-    _grwl_free(_grwl.x11.primarySelectionString);
-    _grwl.x11.primarySelectionString = _grwl_strdup(string);
+    storeSelectionString(_grwl.x11.PRIMARY, string, false);
 
     XSetSelectionOwner(_grwl.x11.display, _grwl.x11.PRIMARY, _grwl.x11.helperWindowHandle, CurrentTime);
 
+    _grwl.stats.roundTrips++;
     if (XGetSelectionOwner(_grwl.x11.display, _grwl.x11.PRIMARY) != _grwl.x11.helperWindowHandle)
     {
         _grwlInputError(GRWL_PLATFORM_ERROR, "X11: Failed to become owner of primary selection");
@@ -387,8 +387,9 @@ static bool initializeTIS()
 
 - (NSApplicationTerminateReply)applicationShouldTerminate:(NSApplication*)sender
 {
-    for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+    for (int i = 0; i < _grwl.windowCount; i++)
     {
+        _GRWLwindow* window = _grwl.windows[i];
         _grwlInputWindowCloseRequest(window);
     }
 
@@ -397,8 +398,9 @@ static bool initializeTIS()
 
 - ()applicationDidChangeScreenParameters:(NSNotification*)notification
 {
-    for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+    for (int i = 0; i < _grwl.windowCount; i++)
     {
+        _GRWLwindow* window = _grwl.windows[i];
         if (window->context.client != GRWL_NO_API)
         {
             [window->context.nsgl.object update];
@@ -505,6 +507,9 @@ bool _grwlConnectCocoa(int platformID, _GRWLplatform* platform)
         _grwlGetKeyboardLayoutNameCocoa,
         _grwlSetClipboardStringCocoa,
         _grwlGetClipboardStringCocoa,
+        _grwlRequestClipboardStringDeferred,
+        _grwlSetClipboardDataCocoa,
+        _grwlGetClipboardDataCocoa,
         _grwlUpdatePreeditCursorRectangleCocoa,
         _grwlResetPreeditTextCocoa,
         _grwlSetIMEStatusCocoa,
@@ -705,6 +710,7 @@ void _grwlTerminateCocoa()
         }
 
         _grwl_free(_grwl.ns.clipboardString);
+        _grwl_free(_grwl.ns.clipboardData);
         _grwl_free(_grwl.ns.keyboardLayoutName);
 
         _grwlTerminateNSGL();
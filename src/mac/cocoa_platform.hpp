@@ -194,6 +194,7 @@ typedef struct _GRWLlibraryNS
     short int keycodes[256];
     short int scancodes[GRWL_KEY_LAST + 1];
     char* clipboardString;
+    void* clipboardData;
     char* keyboardLayoutName;
     CGPoint cascadePoint;
     // Where to place the cursor when re-enabled
@@ -259,7 +260,7 @@ bool _grwlCreateWindowCocoa(_GRWLwindow* window, const _GRWLwndconfig* wndconfig
                             const _GRWLfbconfig* fbconfig);
 void _grwlDestroyWindowCocoa(_GRWLwindow* window);
 void _grwlSetWindowTitleCocoa(_GRWLwindow* window, const char* title);
-void _grwlSetWindowIconCocoa(_GRWLwindow* window, int count, const GRWLimage* images);
+void _grwlSetWindowIconCocoa(_GRWLwindow* window, int count, const GRWLformattedimage* images);
 void _grwlSetWindowProgressIndicatorCocoa(_GRWLwindow* window, int progressState, double value);
 void _grwlSetWindowBadgeCocoa(_GRWLwindow* window, int count);
 void _grwlSetWindowBadgeStringCocoa(_GRWLwindow* window, const char* string);
@@ -308,12 +309,14 @@ void _grwlSetCursorModeCocoa(_GRWLwindow* window, int mode);
 const char* _grwlGetScancodeNameCocoa(int scancode);
 int _grwlGetKeyScancodeCocoa(int key);
 const char* _grwlGetKeyboardLayoutNameCocoa();
-bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot);
+bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot);
 bool _grwlCreateStandardCursorCocoa(_GRWLcursor* cursor, int shape);
 void _grwlDestroyCursorCocoa(_GRWLcursor* cursor);
 void _grwlSetCursorCocoa(_GRWLwindow* window, _GRWLcursor* cursor);
 void _grwlSetClipboardStringCocoa(const char* string);
 const char* _grwlGetClipboardStringCocoa();
+void _grwlSetClipboardDataCocoa(const char* mimeType, const void* data, size_t size);
+const void* _grwlGetClipboardDataCocoa(const char* mimeType, size_t* size);
 
 void _grwlUpdatePreeditCursorRectangleCocoa(_GRWLwindow* window);
 void _grwlResetPreeditTextCocoa(_GRWLwindow* window);
@@ -965,6 +965,14 @@ static void setDockProgressIndicator(int progressState, double value)
 
 @end
 
+// Converts the timestamp of an event to the timer domain
+// Event timestamps are in seconds from the same clock as mach_absolute_time
+//
+static uint64_t convertEventTime(NSEvent* event)
+{
+    return (uint64_t)([event timestamp] * _grwlPlatformGetTimerFrequency());
+}
+
 // Create the Cocoa window
 //
 static bool createNativeWindow(_GRWLwindow* window, const _GRWLwndconfig* wndconfig, const _GRWLfbconfig* fbconfig)
@@ -1272,7 +1280,7 @@ void _grwlSetWindowTitleCocoa(_GRWLwindow* window, const char* title)
     } // autoreleasepool
 }
 
-void _grwlSetWindowIconCocoa(_GRWLwindow* window, int count, const GRWLimage* images)
+void _grwlSetWindowIconCocoa(_GRWLwindow* window, int count, const GRWLformattedimage* images)
 {
     _grwlInputError(GRWL_FEATURE_UNAVAILABLE, "Cocoa: Regular windows do not have icons on macOS");
 }
@@ -1963,9 +1971,13 @@ void _grwlPollEventsCocoa()
                 break;
             }
 
+            _grwl.stats.events++;
+            _grwl.eventTime = convertEventTime(event);
             [NSApp sendEvent:event];
         }
 
+        _grwl.eventTime = 0;
+
     } // autoreleasepool
 }
 
@@ -1981,6 +1993,9 @@ void _grwlWaitEventsCocoa()
                                             untilDate:[NSDate distantFuture]
                                                inMode:NSDefaultRunLoopMode
                                               dequeue:YES];
+        _grwl.stats.pollWakeups++;
+        _grwl.stats.events++;
+        _grwl.eventTime = convertEventTime(event);
         [NSApp sendEvent:event];
 
         _grwlPollEventsCocoa();
@@ -2000,6 +2015,9 @@ void _grwlWaitEventsTimeoutCocoa(double timeout)
                                               dequeue:YES];
         if (event)
         {
+            _grwl.stats.pollWakeups++;
+            _grwl.stats.events++;
+            _grwl.eventTime = convertEventTime(event);
             [NSApp sendEvent:event];
         }
 
@@ -2171,7 +2189,7 @@ const char* _grwlGetKeyboardLayoutNameCocoa()
     return _grwl.ns.keyboardLayoutName;
 }
 
-bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot)
+bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot)
 {
     @autoreleasepool
     {
@@ -2179,6 +2197,10 @@ bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLimage* image, int xho
         NSImage* native;
         NSBitmapImageRep* rep;
 
+        // Keep premultiplied images premultiplied to avoid dividing by alpha
+        const bool premultiplied = image->format & _GRWL_IMAGE_PREMULTIPLIED;
+        const NSBitmapFormat format = premultiplied ? (NSBitmapFormat)0 : NSBitmapFormatAlphaNonpremultiplied;
+
         rep = [[NSBitmapImageRep alloc] initWithBitmapDataPlanes:nullptr
                                                       pixelsWide:image->width
                                                       pixelsHigh:image->height
@@ -2187,7 +2209,7 @@ bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLimage* image, int xho
                                                         hasAlpha:YES
                                                         isPlanar:NO
                                                   colorSpaceName:NSCalibratedRGBColorSpace
-                                                    bitmapFormat:NSBitmapFormatAlphaNonpremultiplied
+                                                    bitmapFormat:format
                                                      bytesPerRow:image->width * 4
                                                     bitsPerPixel:32];
 
@@ -2196,7 +2218,7 @@ bool _grwlCreateCursorCocoa(_GRWLcursor* cursor, const GRWLimage* image, int xho
             return false;
         }
 
-        memcpy([rep bitmapData], image -> pixels, image -> width * image -> height * 4);
+        _grwlConvertImage([rep bitmapData], premultiplied ? GRWL_IMAGE_RGBA_PREMULTIPLIED : GRWL_IMAGE_RGBA, image);
 
         native = [[NSImage alloc] initWithSize:NSMakeSize(image->width, image->height)];
         [native addRepresentation:rep];
@@ -2352,6 +2374,47 @@ const char* _grwlGetClipboardStringCocoa()
     } // autoreleasepool
 }
 
+void _grwlSetClipboardDataCocoa(const char* mimeType, const void* data, size_t size)
+{
+    @autoreleasepool
+    {
+        NSString* type = @(mimeType);
+        NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+        [pasteboard declareTypes:@[ type ] owner:nil];
+        [pasteboard setData:[NSData dataWithBytes:data length:size] forType:type];
+    } // autoreleasepool
+}
+
+const void* _grwlGetClipboardDataCocoa(const char* mimeType, size_t* size)
+{
+    @autoreleasepool
+    {
+        NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+
+        NSData* object = [pasteboard dataForType:@(mimeType)];
+        if (!object)
+        {
+            _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Cocoa: The pasteboard has no data of type %s", mimeType);
+            return nullptr;
+        }
+
+        void* copy = _grwl_calloc(1, [object length] ? [object length] : 1);
+        if (!copy)
+        {
+            return nullptr;
+        }
+
+        [object getBytes:copy length:[object length]];
+
+        _grwl_free(_grwl.ns.clipboardData);
+        _grwl.ns.clipboardData = copy;
+        *size = [object length];
+
+        return _grwl.ns.clipboardData;
+
+    } // autoreleasepool
+}
+
 void _grwlUpdatePreeditCursorRectangleCocoa(_GRWLwindow* window)
 {
     // Do nothing. Instead, implement `firstRectForCharacterRange` callback
@@ -2640,6 +2703,7 @@ GRWLAPI id grwlGetCocoaWindow(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nil);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nil);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_COCOA)
     {
@@ -387,6 +387,7 @@ GRWLAPI id grwlGetNSGLContext(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nil);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nil);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_COCOA)
     {
@@ -0,0 +1,193 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+
+// The number of messages that may be pending, must be a power of two
+#define _GRWL_MESSAGE_CAPACITY 4096
+
+// A user event or main thread task posted from any thread
+// The sequence number tells producers and the consumer whose turn it is to
+// access the slot, as described by Dmitry Vyukov for bounded queues
+//
+typedef struct _GRWLmessage
+{
+    std::atomic<size_t> sequence;
+    GRWLmainthreadfun function;
+    void* user;
+    int type;
+} _GRWLmessage;
+
+// These are outside of _grwl as they are shared with other threads and must not
+// be cleared with memset
+//
+static _GRWLmessage* _grwlMessages;
+static std::atomic<size_t> _grwlMessageTail;
+static size_t _grwlMessageHead;
+static std::atomic<bool> _grwlMessageWakeup;
+
+// Appends a message to the queue, from any thread
+//
+static bool postMessage(GRWLmainthreadfun function, int type, void* user)
+{
+    _GRWLmessage* message;
+    size_t position = _grwlMessageTail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        message = _grwlMessages + (position & (_GRWL_MESSAGE_CAPACITY - 1));
+
+        const intptr_t difference =
+            (intptr_t)message->sequence.load(std::memory_order_acquire) - (intptr_t)position;
+        if (difference == 0)
+        {
+            if (_grwlMessageTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The consumer has not yet freed this slot, so the queue is full
+            return false;
+        }
+        else
+        {
+            position = _grwlMessageTail.load(std::memory_order_relaxed);
+        }
+    }
+
+    message->function = function;
+    message->type = type;
+    message->user = user;
+    message->sequence.store(position + 1, std::memory_order_release);
+
+    // Only wake the event loop once until it has drained the queue
+    if (!_grwlMessageWakeup.exchange(true, std::memory_order_acq_rel))
+    {
+        _grwl.platform.postEmptyEvent();
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Allocates the message queue
+//
+bool _grwlInitMessageQueue()
+{
+    _grwlMessages = (_GRWLmessage*)_grwl_calloc(_GRWL_MESSAGE_CAPACITY, sizeof(_GRWLmessage));
+    if (!_grwlMessages)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < _GRWL_MESSAGE_CAPACITY; i++)
+    {
+        _grwlMessages[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    _grwlMessageHead = 0;
+    _grwlMessageTail.store(0, std::memory_order_relaxed);
+    _grwlMessageWakeup.store(false, std::memory_order_release);
+    return true;
+}
+
+// Frees the message queue, discarding any pending messages
+//
+void _grwlTerminateMessageQueue()
+{
+    _grwl_free(_grwlMessages);
+    _grwlMessages = nullptr;
+}
+
+// Runs pending main thread tasks and delivers pending user events
+//
+void _grwlProcessMessages()
+{
+    if (!_grwlMessageWakeup.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // Limit the work to one queue's worth so that tasks posting new tasks
+    // cannot keep the event loop from returning
+    for (int i = 0; i < _GRWL_MESSAGE_CAPACITY; i++)
+    {
+        _GRWLmessage* message = _grwlMessages + (_grwlMessageHead & (_GRWL_MESSAGE_CAPACITY - 1));
+        if (message->sequence.load(std::memory_order_acquire) != _grwlMessageHead + 1)
+        {
+            return;
+        }
+
+        const GRWLmainthreadfun function = message->function;
+        const int type = message->type;
+        void* user = message->user;
+
+        // Free the slot before calling user code, which may post more messages
+        message->sequence.store(_grwlMessageHead + _GRWL_MESSAGE_CAPACITY, std::memory_order_release);
+        _grwlMessageHead++;
+
+        if (function)
+        {
+            _grwlBeginCallback();
+            function(user);
+            _grwlEndCallback();
+            continue;
+        }
+
+        if (_grwl.queue.events)
+        {
+            GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_USER, nullptr);
+            queued->user.type = type;
+            queued->user.payload = user;
+        }
+
+        if (_grwl.callbacks.user)
+        {
+            _grwlBeginCallback();
+            _grwl.callbacks.user(type, user);
+            _grwlEndCallback();
+        }
+    }
+
+    // Messages were left in the queue, so make sure the next wait returns
+    if (!_grwlMessageWakeup.exchange(true, std::memory_order_acq_rel))
+    {
+        _grwl.platform.postEmptyEvent();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GRWL public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GRWLAPI int grwlPostUserEvent(int type, void* payload)
+{
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+    return postMessage(nullptr, type, payload);
+}
+
+GRWLAPI int grwlRunOnMainThread(GRWLmainthreadfun function, void* user)
+{
+    assert(function != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+    return postMessage(function, 0, user);
+}
+
+GRWLAPI GRWLusereventfun grwlSetUserEventCallback(GRWLusereventfun cbfun)
+{
+    _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_SWAP(GRWLusereventfun, _grwl.callbacks.user, cbfun);
+    return cbfun;
+}
@@ -101,8 +101,9 @@ void _grwlInputMonitor(_GRWLmonitor* monitor, int action, int placement)
     }
     else if (action == GRWL_DISCONNECTED)
     {
-        for (_GRWLwindow* window = _grwl.windowListHead; window; window = window->next)
+        for (int i = 0; i < _grwl.windowCount; i++)
         {
+            _GRWLwindow* window = _grwl.windows[i];
             if (window->monitor == monitor)
             {
                 int width, height, xoff, yoff;
@@ -125,9 +126,18 @@ void _grwlInputMonitor(_GRWLmonitor* monitor, int action, int placement)
         }
     }
 
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_MONITOR, nullptr);
+        queued->monitor.monitor = (GRWLmonitor*)monitor;
+        queued->monitor.event = action;
+    }
+
     if (_grwl.callbacks.monitor)
     {
+        _grwlBeginCallback();
         _grwl.callbacks.monitor((GRWLmonitor*)monitor, action);
+        _grwlEndCallback();
     }
 
     if (action == GRWL_DISCONNECTED)
@@ -171,6 +181,11 @@ void _grwlFreeMonitor(_GRWLmonitor* monitor)
         return;
     }
 
+    if (_grwl.queue.events)
+    {
+        _grwlForgetQueuedMonitor(monitor);
+    }
+
     _grwl.platform.freeMonitor(monitor);
 
     _grwl_free(monitor->modes);
@@ -0,0 +1,184 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+// Create key name strings for the printable keys
+//
+static void createKeyNames()
+{
+    static const struct
+    {
+        int key;
+        const char* name;
+    } names[] = {
+        { GRWL_KEY_APOSTROPHE, "'" },    { GRWL_KEY_COMMA, "," },          { GRWL_KEY_MINUS, "-" },
+        { GRWL_KEY_PERIOD, "." },        { GRWL_KEY_SLASH, "/" },          { GRWL_KEY_SEMICOLON, ";" },
+        { GRWL_KEY_EQUAL, "=" },         { GRWL_KEY_LEFT_BRACKET, "[" },   { GRWL_KEY_BACKSLASH, "\\" },
+        { GRWL_KEY_RIGHT_BRACKET, "]" }, { GRWL_KEY_GRAVE_ACCENT, "`" },   { GRWL_KEY_KP_DECIMAL, "." },
+        { GRWL_KEY_KP_DIVIDE, "/" },     { GRWL_KEY_KP_MULTIPLY, "*" },    { GRWL_KEY_KP_SUBTRACT, "-" },
+        { GRWL_KEY_KP_ADD, "+" },        { GRWL_KEY_KP_EQUAL, "=" },
+    };
+
+    char name[2] = { 0 };
+
+    for (int key = GRWL_KEY_0; key <= GRWL_KEY_9; key++)
+    {
+        name[0] = (char)('0' + key - GRWL_KEY_0);
+        _grwl.null.keynames[key] = _grwl_strdup(name);
+    }
+
+    for (int key = GRWL_KEY_A; key <= GRWL_KEY_Z; key++)
+    {
+        name[0] = (char)('a' + key - GRWL_KEY_A);
+        _grwl.null.keynames[key] = _grwl_strdup(name);
+    }
+
+    for (int key = GRWL_KEY_KP_0; key <= GRWL_KEY_KP_9; key++)
+    {
+        name[0] = (char)('0' + key - GRWL_KEY_KP_0);
+        _grwl.null.keynames[key] = _grwl_strdup(name);
+    }
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        _grwl.null.keynames[names[i].key] = _grwl_strdup(names[i].name);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+bool _grwlConnectNull(int platformID, _GRWLplatform* platform)
+{
+    const _GRWLplatform null = {
+        GRWL_PLATFORM_NULL,
+        _grwlInitNull,
+        _grwlTerminateNull,
+        _grwlGetCursorPosNull,
+        _grwlSetCursorPosNull,
+        _grwlSetCursorModeNull,
+        _grwlSetRawMouseMotionNull,
+        _grwlRawMouseMotionSupportedNull,
+        _grwlCreateCursorNull,
+        _grwlCreateStandardCursorNull,
+        _grwlDestroyCursorNull,
+        _grwlSetCursorNull,
+        _grwlGetScancodeNameNull,
+        _grwlGetKeyScancodeNull,
+        _grwlGetKeyboardLayoutNameNull,
+        _grwlSetClipboardStringNull,
+        _grwlGetClipboardStringNull,
+        _grwlRequestClipboardStringDeferred,
+        _grwlSetClipboardDataNull,
+        _grwlGetClipboardDataNull,
+        _grwlUpdatePreeditCursorRectangleNull,
+        _grwlResetPreeditTextNull,
+        _grwlSetIMEStatusNull,
+        _grwlGetIMEStatusNull,
+        _grwlInitJoysticksNull,
+        _grwlTerminateJoysticksNull,
+        _grwlPollJoystickNull,
+        _grwlGetMappingNameNull,
+        _grwlUpdateGamepadGUIDNull,
+        _grwlFreeMonitorNull,
+        _grwlGetMonitorPosNull,
+        _grwlGetMonitorContentScaleNull,
+        _grwlGetMonitorWorkareaNull,
+        _grwlGetVideoModesNull,
+        _grwlGetVideoModeNull,
+        _grwlCreateWindowNull,
+        _grwlDestroyWindowNull,
+        _grwlSetWindowTitleNull,
+        _grwlSetWindowIconNull,
+        _grwlSetWindowProgressIndicatorNull,
+        _grwlSetWindowBadgeNull,
+        _grwlSetWindowBadgeStringNull,
+        _grwlGetWindowPosNull,
+        _grwlSetWindowPosNull,
+        _grwlGetWindowSizeNull,
+        _grwlSetWindowSizeNull,
+        _grwlSetWindowSizeLimitsNull,
+        _grwlSetWindowAspectRatioNull,
+        _grwlGetFramebufferSizeNull,
+        _grwlGetWindowFrameSizeNull,
+        _grwlGetWindowContentScaleNull,
+        _grwlIconifyWindowNull,
+        _grwlRestoreWindowNull,
+        _grwlMaximizeWindowNull,
+        _grwlShowWindowNull,
+        _grwlHideWindowNull,
+        _grwlRequestWindowAttentionNull,
+        _grwlFocusWindowNull,
+        _grwlSetWindowMonitorNull,
+        _grwlWindowFocusedNull,
+        _grwlWindowIconifiedNull,
+        _grwlWindowVisibleNull,
+        _grwlWindowMaximizedNull,
+        _grwlWindowHoveredNull,
+        _grwlFramebufferTransparentNull,
+        _grwlGetWindowOpacityNull,
+        _grwlSetWindowResizableNull,
+        _grwlSetWindowDecoratedNull,
+        _grwlSetWindowFloatingNull,
+        _grwlSetWindowOpacityNull,
+        _grwlSetWindowMousePassthroughNull,
+        _grwlPollEventsNull,
+        _grwlWaitEventsNull,
+        _grwlWaitEventsTimeoutNull,
+        _grwlPostEmptyEventNull,
+        _grwlCreateUserContextNull,
+        _grwlGetEGLPlatformNull,
+        _grwlGetEGLNativeDisplayNull,
+        _grwlGetEGLNativeWindowNull,
+        _grwlGetRequiredInstanceExtensionsNull,
+        _grwlGetPhysicalDevicePresentationSupportNull,
+        _grwlCreateWindowSurfaceNull,
+    };
+
+    *platform = null;
+    return true;
+}
+
+bool _grwlInitNull()
+{
+    createKeyNames();
+
+#if defined(GRWL_BUILD_POSIX_POLL)
+    if (!_grwlInitPollPOSIX())
+    {
+        return false;
+    }
+#endif
+
+    _grwlPollMonitorsNull();
+    return true;
+}
+
+void _grwlTerminateNull()
+{
+    _grwl_free(_grwl.null.clipboardString);
+    _grwl.null.clipboardString = nullptr;
+    _grwl_free(_grwl.null.clipboardDataType);
+    _grwl.null.clipboardDataType = nullptr;
+    _grwl_free(_grwl.null.clipboardData);
+    _grwl.null.clipboardData = nullptr;
+
+    for (int key = 0; key <= GRWL_KEY_LAST; key++)
+    {
+        _grwl_free(_grwl.null.keynames[key]);
+        _grwl.null.keynames[key] = nullptr;
+    }
+
+    _grwlTerminateEGL();
+
+#if defined(GRWL_BUILD_POSIX_POLL)
+    _grwlTerminatePollPOSIX();
+#endif
+}
@@ -0,0 +1,33 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+bool _grwlInitJoysticksNull()
+{
+    return true;
+}
+
+void _grwlTerminateJoysticksNull()
+{
+}
+
+bool _grwlPollJoystickNull(_GRWLjoystick* js, int mode)
+{
+    return false;
+}
+
+const char* _grwlGetMappingNameNull()
+{
+    return "";
+}
+
+void _grwlUpdateGamepadGUIDNull(char* guid)
+{
+}
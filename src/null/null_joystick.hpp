@@ -0,0 +1,10 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+bool _grwlInitJoysticksNull();
+void _grwlTerminateJoysticksNull();
+bool _grwlPollJoystickNull(_GRWLjoystick* js, int mode);
+const char* _grwlGetMappingNameNull();
+void _grwlUpdateGamepadGUIDNull(char* guid);
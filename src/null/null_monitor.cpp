@@ -0,0 +1,149 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+// The resolutions offered by every virtual monitor, in ascending order
+//
+static const struct
+{
+    int width, height;
+} nullModeSizes[_GRWL_NULL_MODE_COUNT] = {
+    { 640, 480 },   { 800, 600 },   { 1024, 768 },  { 1280, 720 },  { 1280, 1024 },
+    { 1366, 768 },  { 1600, 900 },  { 1920, 1080 }, { 2560, 1440 }, { 3840, 2160 },
+};
+
+// The video mode shared by all virtual monitors at startup
+//
+static GRWLvidmode getDesktopMode()
+{
+    GRWLvidmode mode;
+    mode.width = 1920;
+    mode.height = 1080;
+    mode.redBits = 8;
+    mode.greenBits = 8;
+    mode.blueBits = 8;
+    mode.refreshRate = 60;
+    return mode;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+void _grwlPollMonitorsNull()
+{
+    const float dpi = 141.f;
+    const GRWLvidmode mode = getDesktopMode();
+    int xpos = 0;
+
+    for (int i = 0; i < _grwl.hints.init.null.monitorCount; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Null SuperNoop %i", i);
+
+        _GRWLmonitor* monitor =
+            _grwlAllocMonitor(name, (int)(mode.width * 25.4f / dpi), (int)(mode.height * 25.4f / dpi));
+        monitor->null.xpos = xpos;
+        monitor->null.ypos = 0;
+        monitor->null.contentScale = 1.f;
+        monitor->null.desktopMode = mode;
+        monitor->null.mode = mode;
+
+        _grwlInputMonitor(monitor, GRWL_CONNECTED, _GRWL_INSERT_LAST);
+
+        xpos += mode.width;
+    }
+}
+
+void _grwlSetVideoModeNull(_GRWLmonitor* monitor, const GRWLvidmode* desired)
+{
+    const GRWLvidmode* best = _grwlChooseVideoMode(monitor, desired);
+    if (best)
+    {
+        monitor->null.mode = *best;
+    }
+}
+
+void _grwlRestoreVideoModeNull(_GRWLmonitor* monitor)
+{
+    monitor->null.mode = monitor->null.desktopMode;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+void _grwlFreeMonitorNull(_GRWLmonitor* monitor)
+{
+}
+
+void _grwlGetMonitorPosNull(_GRWLmonitor* monitor, int* xpos, int* ypos)
+{
+    if (xpos)
+    {
+        *xpos = monitor->null.xpos;
+    }
+    if (ypos)
+    {
+        *ypos = monitor->null.ypos;
+    }
+}
+
+void _grwlGetMonitorContentScaleNull(_GRWLmonitor* monitor, float* xscale, float* yscale)
+{
+    if (xscale)
+    {
+        *xscale = monitor->null.contentScale;
+    }
+    if (yscale)
+    {
+        *yscale = monitor->null.contentScale;
+    }
+}
+
+void _grwlGetMonitorWorkareaNull(_GRWLmonitor* monitor, int* xpos, int* ypos, int* width, int* height)
+{
+    // Leave room for a virtual 10 pixel menu bar along the top edge
+    if (xpos)
+    {
+        *xpos = monitor->null.xpos;
+    }
+    if (ypos)
+    {
+        *ypos = monitor->null.ypos + 10;
+    }
+    if (width)
+    {
+        *width = monitor->null.desktopMode.width;
+    }
+    if (height)
+    {
+        *height = monitor->null.desktopMode.height - 10;
+    }
+}
+
+GRWLvidmode* _grwlGetVideoModesNull(_GRWLmonitor* monitor, int* found)
+{
+    GRWLvidmode* modes = (GRWLvidmode*)_grwl_calloc(_GRWL_NULL_MODE_COUNT, sizeof(GRWLvidmode));
+
+    for (int i = 0; i < _GRWL_NULL_MODE_COUNT; i++)
+    {
+        modes[i] = monitor->null.desktopMode;
+        modes[i].width = nullModeSizes[i].width;
+        modes[i].height = nullModeSizes[i].height;
+    }
+
+    *found = _GRWL_NULL_MODE_COUNT;
+    return modes;
+}
+
+void _grwlGetVideoModeNull(_GRWLmonitor* monitor, GRWLvidmode* mode)
+{
+    *mode = monitor->null.mode;
+}
@@ -0,0 +1,175 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#define GRWL_NULL_WINDOW_STATE _GRWLwindowNull null;
+#define GRWL_NULL_LIBRARY_WINDOW_STATE _GRWLlibraryNull null;
+#define GRWL_NULL_MONITOR_STATE _GRWLmonitorNull null;
+#define GRWL_NULL_CURSOR_STATE _GRWLcursorNull null;
+
+typedef VkFlags VkHeadlessSurfaceCreateFlagsEXT;
+
+typedef struct VkHeadlessSurfaceCreateInfoEXT
+{
+    VkStructureType sType;
+    const void* pNext;
+    VkHeadlessSurfaceCreateFlagsEXT flags;
+} VkHeadlessSurfaceCreateInfoEXT;
+
+typedef VkResult(APIENTRY* PFN_vkCreateHeadlessSurfaceEXT)(VkInstance, const VkHeadlessSurfaceCreateInfoEXT*,
+                                                           const VkAllocationCallbacks*, VkSurfaceKHR*);
+
+// The number of video modes offered by every virtual monitor
+#define _GRWL_NULL_MODE_COUNT 10
+
+// Null-specific per-window data
+//
+typedef struct _GRWLwindowNull
+{
+    int xpos;
+    int ypos;
+    int width;
+    int height;
+    char* title;
+    bool visible;
+    bool iconified;
+    bool maximized;
+    bool resizable;
+    bool decorated;
+    bool floating;
+    bool transparent;
+    bool mousePassthrough;
+    float opacity;
+    float cursorPosX, cursorPosY;
+    int imeStatus;
+} _GRWLwindowNull;
+
+// Null-specific per-monitor data
+//
+typedef struct _GRWLmonitorNull
+{
+    int xpos;
+    int ypos;
+    float contentScale;
+    GRWLvidmode desktopMode;
+    GRWLvidmode mode;
+} _GRWLmonitorNull;
+
+// Null-specific per-cursor data
+//
+typedef struct _GRWLcursorNull
+{
+    int shape;
+    int width, height;
+    int xhot, yhot;
+} _GRWLcursorNull;
+
+// Null-specific global data
+//
+typedef struct _GRWLlibraryNull
+{
+    // Cursor position in virtual desktop coordinates
+    double cursorPosX, cursorPosY;
+    char* clipboardString;
+    // Clipboard data and its MIME type
+    char* clipboardDataType;
+    void* clipboardData;
+    size_t clipboardDataSize;
+    char* keynames[GRWL_KEY_LAST + 1];
+    _GRWLwindow* focusedWindow;
+    _GRWLwindow* hoveredWindow;
+    _GRWLwindow* disabledCursorWindow;
+    // The EGLDeviceEXT used when surfaceless EGL is unavailable
+    void* eglDevice;
+} _GRWLlibraryNull;
+
+bool _grwlConnectNull(int platformID, _GRWLplatform* platform);
+bool _grwlInitNull();
+void _grwlTerminateNull();
+
+void _grwlPollMonitorsNull();
+void _grwlFreeMonitorNull(_GRWLmonitor* monitor);
+void _grwlGetMonitorPosNull(_GRWLmonitor* monitor, int* xpos, int* ypos);
+void _grwlGetMonitorContentScaleNull(_GRWLmonitor* monitor, float* xscale, float* yscale);
+void _grwlGetMonitorWorkareaNull(_GRWLmonitor* monitor, int* xpos, int* ypos, int* width, int* height);
+GRWLvidmode* _grwlGetVideoModesNull(_GRWLmonitor* monitor, int* found);
+void _grwlGetVideoModeNull(_GRWLmonitor* monitor, GRWLvidmode* mode);
+void _grwlSetVideoModeNull(_GRWLmonitor* monitor, const GRWLvidmode* desired);
+void _grwlRestoreVideoModeNull(_GRWLmonitor* monitor);
+
+bool _grwlCreateWindowNull(_GRWLwindow* window, const _GRWLwndconfig* wndconfig, const _GRWLctxconfig* ctxconfig,
+                           const _GRWLfbconfig* fbconfig);
+void _grwlDestroyWindowNull(_GRWLwindow* window);
+void _grwlSetWindowTitleNull(_GRWLwindow* window, const char* title);
+void _grwlSetWindowIconNull(_GRWLwindow* window, int count, const GRWLformattedimage* images);
+void _grwlSetWindowProgressIndicatorNull(_GRWLwindow* window, int progressState, double value);
+void _grwlSetWindowBadgeNull(_GRWLwindow* window, int count);
+void _grwlSetWindowBadgeStringNull(_GRWLwindow* window, const char* string);
+void _grwlSetWindowMonitorNull(_GRWLwindow* window, _GRWLmonitor* monitor, int xpos, int ypos, int width, int height,
+                               int refreshRate);
+void _grwlGetWindowPosNull(_GRWLwindow* window, int* xpos, int* ypos);
+void _grwlSetWindowPosNull(_GRWLwindow* window, int xpos, int ypos);
+void _grwlGetWindowSizeNull(_GRWLwindow* window, int* width, int* height);
+void _grwlSetWindowSizeNull(_GRWLwindow* window, int width, int height);
+void _grwlSetWindowSizeLimitsNull(_GRWLwindow* window, int minwidth, int minheight, int maxwidth, int maxheight);
+void _grwlSetWindowAspectRatioNull(_GRWLwindow* window, int n, int d);
+void _grwlGetFramebufferSizeNull(_GRWLwindow* window, int* width, int* height);
+void _grwlGetWindowFrameSizeNull(_GRWLwindow* window, int* left, int* top, int* right, int* bottom);
+void _grwlGetWindowContentScaleNull(_GRWLwindow* window, float* xscale, float* yscale);
+void _grwlIconifyWindowNull(_GRWLwindow* window);
+void _grwlRestoreWindowNull(_GRWLwindow* window);
+void _grwlMaximizeWindowNull(_GRWLwindow* window);
+bool _grwlWindowMaximizedNull(_GRWLwindow* window);
+bool _grwlWindowHoveredNull(_GRWLwindow* window);
+bool _grwlFramebufferTransparentNull(_GRWLwindow* window);
+void _grwlSetWindowResizableNull(_GRWLwindow* window, bool enabled);
+void _grwlSetWindowDecoratedNull(_GRWLwindow* window, bool enabled);
+void _grwlSetWindowFloatingNull(_GRWLwindow* window, bool enabled);
+void _grwlSetWindowMousePassthroughNull(_GRWLwindow* window, bool enabled);
+float _grwlGetWindowOpacityNull(_GRWLwindow* window);
+void _grwlSetWindowOpacityNull(_GRWLwindow* window, float opacity);
+void _grwlSetRawMouseMotionNull(_GRWLwindow* window, bool enabled);
+bool _grwlRawMouseMotionSupportedNull();
+void _grwlShowWindowNull(_GRWLwindow* window);
+void _grwlRequestWindowAttentionNull(_GRWLwindow* window);
+void _grwlHideWindowNull(_GRWLwindow* window);
+void _grwlFocusWindowNull(_GRWLwindow* window);
+bool _grwlWindowFocusedNull(_GRWLwindow* window);
+bool _grwlWindowIconifiedNull(_GRWLwindow* window);
+bool _grwlWindowVisibleNull(_GRWLwindow* window);
+void _grwlPollEventsNull();
+void _grwlWaitEventsNull();
+void _grwlWaitEventsTimeoutNull(double timeout);
+void _grwlPostEmptyEventNull();
+void _grwlGetCursorPosNull(_GRWLwindow* window, double* xpos, double* ypos);
+void _grwlSetCursorPosNull(_GRWLwindow* window, double x, double y);
+void _grwlSetCursorModeNull(_GRWLwindow* window, int mode);
+bool _grwlCreateCursorNull(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot);
+bool _grwlCreateStandardCursorNull(_GRWLcursor* cursor, int shape);
+void _grwlDestroyCursorNull(_GRWLcursor* cursor);
+void _grwlSetCursorNull(_GRWLwindow* window, _GRWLcursor* cursor);
+void _grwlSetClipboardStringNull(const char* string);
+const char* _grwlGetClipboardStringNull();
+void _grwlSetClipboardDataNull(const char* mimeType, const void* data, size_t size);
+const void* _grwlGetClipboardDataNull(const char* mimeType, size_t* size);
+const char* _grwlGetScancodeNameNull(int scancode);
+int _grwlGetKeyScancodeNull(int key);
+const char* _grwlGetKeyboardLayoutNameNull();
+
+void _grwlUpdatePreeditCursorRectangleNull(_GRWLwindow* window);
+void _grwlResetPreeditTextNull(_GRWLwindow* window);
+void _grwlSetIMEStatusNull(_GRWLwindow* window, int active);
+int _grwlGetIMEStatusNull(_GRWLwindow* window);
+
+_GRWLusercontext* _grwlCreateUserContextNull(_GRWLwindow* window);
+
+EGLenum _grwlGetEGLPlatformNull(EGLint** attribs);
+EGLNativeDisplayType _grwlGetEGLNativeDisplayNull();
+EGLNativeWindowType _grwlGetEGLNativeWindowNull(_GRWLwindow* window);
+
+void _grwlGetRequiredInstanceExtensionsNull(char** extensions);
+bool _grwlGetPhysicalDevicePresentationSupportNull(VkInstance instance, VkPhysicalDevice device,
+                                                   uint32_t queuefamily);
+VkResult _grwlCreateWindowSurfaceNull(VkInstance instance, _GRWLwindow* window, const VkAllocationCallbacks* allocator,
+                                      VkSurfaceKHR* surface);
@@ -0,0 +1,859 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+static void applySizeLimits(_GRWLwindow* window, int* width, int* height)
+{
+    if (window->numer != GRWL_DONT_CARE && window->denom != GRWL_DONT_CARE)
+    {
+        const float ratio = (float)window->numer / (float)window->denom;
+        *height = (int)(*width / ratio);
+    }
+
+    if (window->minwidth != GRWL_DONT_CARE)
+    {
+        *width = _grwl_max(*width, window->minwidth);
+    }
+    if (window->maxwidth != GRWL_DONT_CARE)
+    {
+        *width = _grwl_min(*width, window->maxwidth);
+    }
+
+    if (window->minheight != GRWL_DONT_CARE)
+    {
+        *height = _grwl_max(*height, window->minheight);
+    }
+    if (window->maxheight != GRWL_DONT_CARE)
+    {
+        *height = _grwl_min(*height, window->maxheight);
+    }
+}
+
+static void fitToMonitor(_GRWLwindow* window)
+{
+    GRWLvidmode mode;
+    _grwlGetVideoModeNull(window->monitor, &mode);
+    _grwlGetMonitorPosNull(window->monitor, &window->null.xpos, &window->null.ypos);
+
+    if (window->null.width != mode.width || window->null.height != mode.height)
+    {
+        window->null.width = mode.width;
+        window->null.height = mode.height;
+        _grwlResizeOffscreenSurfaceEGL(window, mode.width, mode.height);
+    }
+}
+
+static void acquireMonitor(_GRWLwindow* window)
+{
+    _grwlSetVideoModeNull(window->monitor, &window->videoMode);
+    fitToMonitor(window);
+    _grwlInputMonitorWindow(window->monitor, window);
+}
+
+static void releaseMonitor(_GRWLwindow* window)
+{
+    if (window->monitor->window != window)
+    {
+        return;
+    }
+
+    _grwlInputMonitorWindow(window->monitor, nullptr);
+    _grwlRestoreVideoModeNull(window->monitor);
+}
+
+static bool createNativeWindow(_GRWLwindow* window, const _GRWLwndconfig* wndconfig, const _GRWLfbconfig* fbconfig)
+{
+    if (window->monitor)
+    {
+        fitToMonitor(window);
+    }
+    else
+    {
+        if (wndconfig->xpos == (int)GRWL_ANY_POSITION && wndconfig->ypos == (int)GRWL_ANY_POSITION)
+        {
+            window->null.xpos = 17;
+            window->null.ypos = 17;
+        }
+        else
+        {
+            window->null.xpos = wndconfig->xpos;
+            window->null.ypos = wndconfig->ypos;
+        }
+
+        window->null.width = wndconfig->width;
+        window->null.height = wndconfig->height;
+    }
+
+    window->null.title = _grwl_strdup(wndconfig->title);
+    window->null.visible = wndconfig->visible;
+    window->null.resizable = wndconfig->resizable;
+    window->null.decorated = wndconfig->decorated;
+    window->null.maximized = wndconfig->maximized;
+    window->null.floating = wndconfig->floating;
+    window->null.transparent = fbconfig->transparent;
+    window->null.mousePassthrough = wndconfig->mousePassthrough;
+    window->null.opacity = 1.f;
+    window->null.imeStatus = false;
+
+    return true;
+}
+
+// Waits until a wakeup arrives or the timeout expires and handles it
+//
+static void waitForEmptyEvent(double* timeout)
+{
+#if defined(GRWL_BUILD_POSIX_POLL)
+    if (_grwlWaitPollSourcesPOSIX(timeout))
+    {
+        _grwlDispatchPollSourcesPOSIX();
+    }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+bool _grwlCreateWindowNull(_GRWLwindow* window, const _GRWLwndconfig* wndconfig, const _GRWLctxconfig* ctxconfig,
+                           const _GRWLfbconfig* fbconfig)
+{
+    if (!createNativeWindow(window, wndconfig, fbconfig))
+    {
+        return false;
+    }
+
+    if (ctxconfig->client != GRWL_NO_API)
+    {
+        if (ctxconfig->source == GRWL_EGL_CONTEXT_API || ctxconfig->source == GRWL_NATIVE_CONTEXT_API)
+        {
+            if (!_grwlInitEGL())
+            {
+                return false;
+            }
+            if (!_grwlCreateContextEGL(window, ctxconfig, fbconfig))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            _grwlInputError(GRWL_API_UNAVAILABLE, "Null: OSMesa is not supported, use EGL for offscreen contexts");
+            return false;
+        }
+
+        if (!_grwlRefreshContextAttribs(window, ctxconfig))
+        {
+            return false;
+        }
+    }
+
+    if (wndconfig->mousePassthrough)
+    {
+        _grwlSetWindowMousePassthroughNull(window, true);
+    }
+
+    if (window->monitor)
+    {
+        _grwlShowWindowNull(window);
+        _grwlFocusWindowNull(window);
+        acquireMonitor(window);
+
+        if (wndconfig->centerCursor)
+        {
+            _grwlCenterCursorInContentArea(window);
+        }
+    }
+    else
+    {
+        if (wndconfig->visible)
+        {
+            _grwlShowWindowNull(window);
+            if (wndconfig->focused)
+            {
+                _grwlFocusWindowNull(window);
+            }
+        }
+    }
+
+    return true;
+}
+
+void _grwlDestroyWindowNull(_GRWLwindow* window)
+{
+    if (window->monitor)
+    {
+        releaseMonitor(window);
+    }
+
+    if (_grwl.null.focusedWindow == window)
+    {
+        _grwl.null.focusedWindow = nullptr;
+    }
+
+    if (_grwl.null.hoveredWindow == window)
+    {
+        _grwl.null.hoveredWindow = nullptr;
+    }
+
+    if (_grwl.null.disabledCursorWindow == window)
+    {
+        _grwl.null.disabledCursorWindow = nullptr;
+    }
+
+    if (window->context.destroy)
+    {
+        window->context.destroy(window);
+    }
+
+    _grwl_free(window->null.title);
+    window->null.title = nullptr;
+}
+
+void _grwlSetWindowTitleNull(_GRWLwindow* window, const char* title)
+{
+    char* copy = _grwl_strdup(title);
+    _grwl_free(window->null.title);
+    window->null.title = copy;
+}
+
+void _grwlSetWindowIconNull(_GRWLwindow* window, int count, const GRWLformattedimage* images)
+{
+}
+
+void _grwlSetWindowProgressIndicatorNull(_GRWLwindow* window, int progressState, double value)
+{
+}
+
+void _grwlSetWindowBadgeNull(_GRWLwindow* window, int count)
+{
+}
+
+void _grwlSetWindowBadgeStringNull(_GRWLwindow* window, const char* string)
+{
+}
+
+void _grwlSetWindowMonitorNull(_GRWLwindow* window, _GRWLmonitor* monitor, int xpos, int ypos, int width, int height,
+                               int refreshRate)
+{
+    if (window->monitor == monitor)
+    {
+        if (!monitor)
+        {
+            _grwlSetWindowPosNull(window, xpos, ypos);
+            _grwlSetWindowSizeNull(window, width, height);
+        }
+
+        return;
+    }
+
+    if (window->monitor)
+    {
+        releaseMonitor(window);
+    }
+
+    _grwlInputWindowMonitor(window, monitor);
+
+    if (window->monitor)
+    {
+        window->null.visible = true;
+        acquireMonitor(window);
+    }
+    else
+    {
+        _grwlSetWindowPosNull(window, xpos, ypos);
+        _grwlSetWindowSizeNull(window, width, height);
+    }
+}
+
+void _grwlGetWindowPosNull(_GRWLwindow* window, int* xpos, int* ypos)
+{
+    if (xpos)
+    {
+        *xpos = window->null.xpos;
+    }
+    if (ypos)
+    {
+        *ypos = window->null.ypos;
+    }
+}
+
+void _grwlSetWindowPosNull(_GRWLwindow* window, int xpos, int ypos)
+{
+    if (window->monitor)
+    {
+        return;
+    }
+
+    if (window->null.xpos != xpos || window->null.ypos != ypos)
+    {
+        window->null.xpos = xpos;
+        window->null.ypos = ypos;
+        _grwlInputWindowPos(window, xpos, ypos);
+        _grwlInputWindowDamage(window);
+    }
+}
+
+void _grwlGetWindowSizeNull(_GRWLwindow* window, int* width, int* height)
+{
+    if (width)
+    {
+        *width = window->null.width;
+    }
+    if (height)
+    {
+        *height = window->null.height;
+    }
+}
+
+void _grwlSetWindowSizeNull(_GRWLwindow* window, int width, int height)
+{
+    if (window->monitor)
+    {
+        return;
+    }
+
+    if (window->null.width != width || window->null.height != height)
+    {
+        window->null.width = width;
+        window->null.height = height;
+        _grwlResizeOffscreenSurfaceEGL(window, width, height);
+        _grwlInputWindowSize(window, width, height);
+        _grwlInputFramebufferSize(window, width, height);
+        _grwlInputWindowDamage(window);
+    }
+}
+
+void _grwlSetWindowSizeLimitsNull(_GRWLwindow* window, int minwidth, int minheight, int maxwidth, int maxheight)
+{
+    int width = window->null.width;
+    int height = window->null.height;
+    applySizeLimits(window, &width, &height);
+    _grwlSetWindowSizeNull(window, width, height);
+}
+
+void _grwlSetWindowAspectRatioNull(_GRWLwindow* window, int n, int d)
+{
+    int width = window->null.width;
+    int height = window->null.height;
+    applySizeLimits(window, &width, &height);
+    _grwlSetWindowSizeNull(window, width, height);
+}
+
+void _grwlGetFramebufferSizeNull(_GRWLwindow* window, int* width, int* height)
+{
+    if (width)
+    {
+        *width = window->null.width;
+    }
+    if (height)
+    {
+        *height = window->null.height;
+    }
+}
+
+void _grwlGetWindowFrameSizeNull(_GRWLwindow* window, int* left, int* top, int* right, int* bottom)
+{
+    if (window->null.decorated && !window->monitor)
+    {
+        if (left)
+        {
+            *left = 1;
+        }
+        if (top)
+        {
+            *top = 10;
+        }
+        if (right)
+        {
+            *right = 1;
+        }
+        if (bottom)
+        {
+            *bottom = 1;
+        }
+    }
+    else
+    {
+        if (left)
+        {
+            *left = 0;
+        }
+        if (top)
+        {
+            *top = 0;
+        }
+        if (right)
+        {
+            *right = 0;
+        }
+        if (bottom)
+        {
+            *bottom = 0;
+        }
+    }
+}
+
+void _grwlGetWindowContentScaleNull(_GRWLwindow* window, float* xscale, float* yscale)
+{
+    if (xscale)
+    {
+        *xscale = 1.f;
+    }
+    if (yscale)
+    {
+        *yscale = 1.f;
+    }
+}
+
+void _grwlIconifyWindowNull(_GRWLwindow* window)
+{
+    if (_grwl.null.focusedWindow == window)
+    {
+        _grwl.null.focusedWindow = nullptr;
+        _grwlInputWindowFocus(window, false);
+    }
+
+    if (!window->null.iconified)
+    {
+        window->null.iconified = true;
+        _grwlInputWindowIconify(window, true);
+
+        if (window->monitor)
+        {
+            releaseMonitor(window);
+        }
+    }
+}
+
+void _grwlRestoreWindowNull(_GRWLwindow* window)
+{
+    if (window->null.iconified)
+    {
+        window->null.iconified = false;
+        _grwlInputWindowIconify(window, false);
+
+        if (window->monitor)
+        {
+            acquireMonitor(window);
+        }
+    }
+    else if (window->null.maximized)
+    {
+        window->null.maximized = false;
+        _grwlInputWindowMaximize(window, false);
+    }
+}
+
+void _grwlMaximizeWindowNull(_GRWLwindow* window)
+{
+    if (!window->null.maximized)
+    {
+        window->null.maximized = true;
+        _grwlInputWindowMaximize(window, true);
+    }
+}
+
+bool _grwlWindowMaximizedNull(_GRWLwindow* window)
+{
+    return window->null.maximized;
+}
+
+bool _grwlWindowHoveredNull(_GRWLwindow* window)
+{
+    return _grwl.null.cursorPosX >= window->null.xpos && _grwl.null.cursorPosY >= window->null.ypos &&
+           _grwl.null.cursorPosX <= window->null.xpos + window->null.width - 1 &&
+           _grwl.null.cursorPosY <= window->null.ypos + window->null.height - 1;
+}
+
+bool _grwlFramebufferTransparentNull(_GRWLwindow* window)
+{
+    return window->null.transparent;
+}
+
+void _grwlSetWindowResizableNull(_GRWLwindow* window, bool enabled)
+{
+    window->null.resizable = enabled;
+}
+
+void _grwlSetWindowDecoratedNull(_GRWLwindow* window, bool enabled)
+{
+    window->null.decorated = enabled;
+}
+
+void _grwlSetWindowFloatingNull(_GRWLwindow* window, bool enabled)
+{
+    window->null.floating = enabled;
+}
+
+void _grwlSetWindowMousePassthroughNull(_GRWLwindow* window, bool enabled)
+{
+    window->null.mousePassthrough = enabled;
+}
+
+float _grwlGetWindowOpacityNull(_GRWLwindow* window)
+{
+    return window->null.opacity;
+}
+
+void _grwlSetWindowOpacityNull(_GRWLwindow* window, float opacity)
+{
+    window->null.opacity = opacity;
+}
+
+void _grwlSetRawMouseMotionNull(_GRWLwindow* window, bool enabled)
+{
+}
+
+bool _grwlRawMouseMotionSupportedNull()
+{
+    return true;
+}
+
+void _grwlShowWindowNull(_GRWLwindow* window)
+{
+    window->null.visible = true;
+}
+
+void _grwlRequestWindowAttentionNull(_GRWLwindow* window)
+{
+}
+
+void _grwlHideWindowNull(_GRWLwindow* window)
+{
+    if (_grwl.null.focusedWindow == window)
+    {
+        _grwl.null.focusedWindow = nullptr;
+        _grwlInputWindowFocus(window, false);
+    }
+
+    window->null.visible = false;
+}
+
+void _grwlFocusWindowNull(_GRWLwindow* window)
+{
+    if (_grwl.null.focusedWindow == window)
+    {
+        return;
+    }
+
+    if (!window->null.visible)
+    {
+        return;
+    }
+
+    _GRWLwindow* previous = _grwl.null.focusedWindow;
+    _grwl.null.focusedWindow = window;
+
+    if (previous)
+    {
+        _grwlInputWindowFocus(previous, false);
+        if (previous->monitor && previous->autoIconify)
+        {
+            _grwlIconifyWindowNull(previous);
+        }
+    }
+
+    _grwlInputWindowFocus(window, true);
+}
+
+bool _grwlWindowFocusedNull(_GRWLwindow* window)
+{
+    return _grwl.null.focusedWindow == window;
+}
+
+bool _grwlWindowIconifiedNull(_GRWLwindow* window)
+{
+    return window->null.iconified;
+}
+
+bool _grwlWindowVisibleNull(_GRWLwindow* window)
+{
+    return window->null.visible;
+}
+
+void _grwlPollEventsNull()
+{
+    _GRWL_TRACE_ZONE("_grwlPollEventsNull");
+
+    double timeout = 0.0;
+    waitForEmptyEvent(&timeout);
+}
+
+void _grwlWaitEventsNull()
+{
+    waitForEmptyEvent(nullptr);
+}
+
+void _grwlWaitEventsTimeoutNull(double timeout)
+{
+    waitForEmptyEvent(&timeout);
+}
+
+void _grwlPostEmptyEventNull()
+{
+#if defined(GRWL_BUILD_POSIX_POLL)
+    _grwlPostEmptyEventPOSIX();
+#endif
+}
+
+void _grwlGetCursorPosNull(_GRWLwindow* window, double* xpos, double* ypos)
+{
+    if (xpos)
+    {
+        *xpos = _grwl.null.cursorPosX - window->null.xpos;
+    }
+    if (ypos)
+    {
+        *ypos = _grwl.null.cursorPosY - window->null.ypos;
+    }
+}
+
+void _grwlSetCursorPosNull(_GRWLwindow* window, double x, double y)
+{
+    _grwl.null.cursorPosX = window->null.xpos + x;
+    _grwl.null.cursorPosY = window->null.ypos + y;
+}
+
+void _grwlSetCursorModeNull(_GRWLwindow* window, int mode)
+{
+    if (mode == GRWL_CURSOR_DISABLED)
+    {
+        if (_grwl.null.disabledCursorWindow == window)
+        {
+            return;
+        }
+
+        _grwl.null.disabledCursorWindow = window;
+        _grwlGetCursorPosNull(window, &window->virtualCursorPosX, &window->virtualCursorPosY);
+        _grwlCenterCursorInContentArea(window);
+    }
+    else if (_grwl.null.disabledCursorWindow == window)
+    {
+        _grwl.null.disabledCursorWindow = nullptr;
+        _grwlSetCursorPosNull(window, window->virtualCursorPosX, window->virtualCursorPosY);
+    }
+}
+
+bool _grwlCreateCursorNull(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot)
+{
+    cursor->null.shape = 0;
+    cursor->null.width = image->width;
+    cursor->null.height = image->height;
+    cursor->null.xhot = xhot;
+    cursor->null.yhot = yhot;
+    return true;
+}
+
+bool _grwlCreateStandardCursorNull(_GRWLcursor* cursor, int shape)
+{
+    cursor->null.shape = shape;
+    return true;
+}
+
+void _grwlDestroyCursorNull(_GRWLcursor* cursor)
+{
+}
+
+void _grwlSetCursorNull(_GRWLwindow* window, _GRWLcursor* cursor)
+{
+}
+
+void _grwlSetClipboardStringNull(const char* string)
+{
+    char* copy = _grwl_strdup(string);
+    _grwl_free(_grwl.null.clipboardString);
+    _grwl.null.clipboardString = copy;
+
+    _grwl_free(_grwl.null.clipboardDataType);
+    _grwl.null.clipboardDataType = nullptr;
+    _grwl_free(_grwl.null.clipboardData);
+    _grwl.null.clipboardData = nullptr;
+    _grwl.null.clipboardDataSize = 0;
+}
+
+const char* _grwlGetClipboardStringNull()
+{
+    return _grwl.null.clipboardString;
+}
+
+void _grwlSetClipboardDataNull(const char* mimeType, const void* data, size_t size)
+{
+    char* type = _grwl_strdup(mimeType);
+    void* copy = _grwl_calloc(1, size ? size : 1);
+    if (!type || !copy)
+    {
+        _grwl_free(type);
+        _grwl_free(copy);
+        return;
+    }
+
+    memcpy(copy, data, size);
+
+    _grwl_free(_grwl.null.clipboardString);
+    _grwl.null.clipboardString = nullptr;
+
+    _grwl_free(_grwl.null.clipboardDataType);
+    _grwl.null.clipboardDataType = type;
+    _grwl_free(_grwl.null.clipboardData);
+    _grwl.null.clipboardData = copy;
+    _grwl.null.clipboardDataSize = size;
+}
+
+const void* _grwlGetClipboardDataNull(const char* mimeType, size_t* size)
+{
+    if (!_grwl.null.clipboardDataType || strcmp(_grwl.null.clipboardDataType, mimeType) != 0)
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Null: The clipboard has no data of type %s", mimeType);
+        return nullptr;
+    }
+
+    *size = _grwl.null.clipboardDataSize;
+    return _grwl.null.clipboardData;
+}
+
+void _grwlUpdatePreeditCursorRectangleNull(_GRWLwindow* window)
+{
+}
+
+void _grwlResetPreeditTextNull(_GRWLwindow* window)
+{
+}
+
+void _grwlSetIMEStatusNull(_GRWLwindow* window, int active)
+{
+    if (window->null.imeStatus != active)
+    {
+        window->null.imeStatus = active;
+        _grwlInputIMEStatus(window);
+    }
+}
+
+int _grwlGetIMEStatusNull(_GRWLwindow* window)
+{
+    return window->null.imeStatus;
+}
+
+_GRWLusercontext* _grwlCreateUserContextNull(_GRWLwindow* window)
+{
+    if (window->context.egl.handle)
+    {
+        return _grwlCreateUserContextEGL(window);
+    }
+
+    _grwlInputError(GRWL_API_UNAVAILABLE, "Null: No context creation API available");
+    return nullptr;
+}
+
+EGLenum _grwlGetEGLPlatformNull(EGLint** attribs)
+{
+    if (!_grwl.egl.EXT_platform_base)
+    {
+        return 0;
+    }
+
+    if (_grwl.egl.MESA_platform_surfaceless)
+    {
+        return EGL_PLATFORM_SURFACELESS_MESA;
+    }
+
+    if (_grwl.egl.EXT_platform_device && eglQueryDevicesEXT)
+    {
+        EGLint count = 0;
+        if (eglQueryDevicesEXT(1, &_grwl.null.eglDevice, &count) && count > 0)
+        {
+            return EGL_PLATFORM_DEVICE_EXT;
+        }
+    }
+
+    return 0;
+}
+
+EGLNativeDisplayType _grwlGetEGLNativeDisplayNull()
+{
+    if (_grwl.egl.platform == EGL_PLATFORM_DEVICE_EXT)
+    {
+        return _grwl.null.eglDevice;
+    }
+
+    return EGL_DEFAULT_DISPLAY;
+}
+
+EGLNativeWindowType _grwlGetEGLNativeWindowNull(_GRWLwindow* window)
+{
+    return 0;
+}
+
+const char* _grwlGetScancodeNameNull(int scancode)
+{
+    if (scancode < GRWL_KEY_SPACE || scancode > GRWL_KEY_LAST)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid scancode %i", scancode);
+        return nullptr;
+    }
+
+    return _grwl.null.keynames[scancode];
+}
+
+int _grwlGetKeyScancodeNull(int key)
+{
+    return key;
+}
+
+const char* _grwlGetKeyboardLayoutNameNull()
+{
+    return "Null";
+}
+
+void _grwlGetRequiredInstanceExtensionsNull(char** extensions)
+{
+    if (!_grwl.vk.KHR_surface || !_grwl.vk.EXT_headless_surface)
+    {
+        return;
+    }
+
+    extensions[0] = (char*)"VK_KHR_surface";
+    extensions[1] = (char*)"VK_EXT_headless_surface";
+}
+
+bool _grwlGetPhysicalDevicePresentationSupportNull(VkInstance instance, VkPhysicalDevice device,
+                                                   uint32_t queuefamily)
+{
+    // Headless surfaces have no display to present to, so there is no query
+    // beyond the extension being present
+    return _grwl.vk.EXT_headless_surface;
+}
+
+VkResult _grwlCreateWindowSurfaceNull(VkInstance instance, _GRWLwindow* window, const VkAllocationCallbacks* allocator,
+                                      VkSurfaceKHR* surface)
+{
+    VkResult err;
+    VkHeadlessSurfaceCreateInfoEXT sci;
+    PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXT;
+
+    vkCreateHeadlessSurfaceEXT =
+        (PFN_vkCreateHeadlessSurfaceEXT)vkGetInstanceProcAddr(instance, "vkCreateHeadlessSurfaceEXT");
+    if (!vkCreateHeadlessSurfaceEXT)
+    {
+        _grwlInputError(GRWL_API_UNAVAILABLE, "Null: Vulkan instance missing VK_EXT_headless_surface extension");
+        return VK_ERROR_EXTENSION_NOT_PRESENT;
+    }
+
+    memset(&sci, 0, sizeof(sci));
+    sci.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+
+    err = vkCreateHeadlessSurfaceEXT(instance, &sci, allocator, surface);
+    if (err)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Null: Failed to create Vulkan surface: %s",
+                        _grwlGetVulkanResultString(err));
+    }
+
+    return err;
+}
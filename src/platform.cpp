@@ -43,6 +43,12 @@ bool _grwlSelectPlatform(int desiredID, _GRWLplatform* platform)
         return false;
     }
 
+    // Only allow the Null platform if specifically requested
+    if (desiredID == GRWL_PLATFORM_NULL)
+    {
+        return _grwlConnectNull(desiredID, platform);
+    }
+
     if (desiredID == GRWL_ANY_PLATFORM)
     {
         // If there is exactly one platform available for auto-selection, let it emit the
@@ -132,7 +138,6 @@ GRWLAPI const char* grwlGetVersionString()
 #endif
         " Null"
         " EGL"
-        " OSMesa"
 #if defined(__MINGW64_VERSION_MAJOR)
         " MinGW-w64"
 #elif defined(__MINGW32__)
@@ -4,12 +4,16 @@
 //===========================================================================
 #pragma once
 
-#if defined(GRWL_BUILD_WIN32_TIMER) || defined(GRWL_BUILD_WIN32_MODULE) || defined(GRWL_BUILD_WIN32_THREAD) || \
-    defined(GRWL_BUILD_COCOA_TIMER) || defined(GRWL_BUILD_POSIX_TIMER) || defined(GRWL_BUILD_POSIX_MODULE) ||  \
-    defined(GRWL_BUILD_POSIX_THREAD) || defined(GRWL_BUILD_POSIX_POLL) || defined(GRWL_BUILD_LINUX_JOYSTICK)
+#if defined(GRWL_BUILD_WIN32_TIMER) || defined(GRWL_BUILD_WIN32_MODULE) || defined(GRWL_BUILD_WIN32_THREAD) ||  \
+    defined(GRWL_BUILD_COCOA_TIMER) || defined(GRWL_BUILD_POSIX_TIMER) || defined(GRWL_BUILD_POSIX_MODULE) ||   \
+    defined(GRWL_BUILD_POSIX_THREAD) || defined(GRWL_BUILD_POSIX_POLL) || defined(GRWL_BUILD_LINUX_JOYSTICK) || \
+    defined(GRWL_BUILD_WIN32_FILE) || defined(GRWL_BUILD_POSIX_FILE)
     #error "You must not define these; define zero or more _GRWL_<platform> macros instead"
 #endif
 
+#include "null/null_platform.hpp"
+#include "null/null_joystick.hpp"
+
 #if defined(_GRWL_WIN32)
     #include "win32/win32_platform.hpp"
 #else
@@ -84,19 +88,22 @@
     GRWL_WIN32_WINDOW_STATE        \
     GRWL_COCOA_WINDOW_STATE        \
     GRWL_WAYLAND_WINDOW_STATE      \
-    GRWL_X11_WINDOW_STATE
+    GRWL_X11_WINDOW_STATE          \
+    GRWL_NULL_WINDOW_STATE
 
 #define GRWL_PLATFORM_MONITOR_STATE \
     GRWL_WIN32_MONITOR_STATE        \
     GRWL_COCOA_MONITOR_STATE        \
     GRWL_WAYLAND_MONITOR_STATE      \
-    GRWL_X11_MONITOR_STATE
+    GRWL_X11_MONITOR_STATE          \
+    GRWL_NULL_MONITOR_STATE
 
 #define GRWL_PLATFORM_CURSOR_STATE \
     GRWL_WIN32_CURSOR_STATE        \
     GRWL_COCOA_CURSOR_STATE        \
     GRWL_WAYLAND_CURSOR_STATE      \
-    GRWL_X11_CURSOR_STATE
+    GRWL_X11_CURSOR_STATE          \
+    GRWL_NULL_CURSOR_STATE
 
 #define GRWL_PLATFORM_JOYSTICK_STATE \
     GRWL_WIN32_JOYSTICK_STATE        \
@@ -107,7 +114,8 @@
     GRWL_WIN32_LIBRARY_WINDOW_STATE        \
     GRWL_COCOA_LIBRARY_WINDOW_STATE        \
     GRWL_WAYLAND_LIBRARY_WINDOW_STATE      \
-    GRWL_X11_LIBRARY_WINDOW_STATE
+    GRWL_X11_LIBRARY_WINDOW_STATE          \
+    GRWL_NULL_LIBRARY_WINDOW_STATE
 
 #define GRWL_PLATFORM_LIBRARY_JOYSTICK_STATE \
     GRWL_WIN32_LIBRARY_JOYSTICK_STATE        \
@@ -139,10 +147,14 @@
     #include "win32/win32_thread.hpp"
     #define GRWL_PLATFORM_TLS_STATE GRWL_WIN32_TLS_STATE
     #define GRWL_PLATFORM_MUTEX_STATE GRWL_WIN32_MUTEX_STATE
+    #define GRWL_PLATFORM_THREAD_STATE GRWL_WIN32_THREAD_STATE
+    #define GRWL_PLATFORM_CONDITION_STATE GRWL_WIN32_CONDITION_STATE
 #elif defined(GRWL_BUILD_POSIX_THREAD)
     #include "posix_thread.hpp"
     #define GRWL_PLATFORM_TLS_STATE GRWL_POSIX_TLS_STATE
     #define GRWL_PLATFORM_MUTEX_STATE GRWL_POSIX_MUTEX_STATE
+    #define GRWL_PLATFORM_THREAD_STATE GRWL_POSIX_THREAD_STATE
+    #define GRWL_PLATFORM_CONDITION_STATE GRWL_POSIX_CONDITION_STATE
 #endif
 
 #if defined(_WIN32)
@@ -178,6 +190,27 @@
     #define GRWL_BUILD_POSIX_MODULE
 #endif
 
-#if defined(_GRWL_WAYLAND) || defined(_GRWL_X11)
+#if defined(_WIN32)
+    #define GRWL_BUILD_WIN32_FILE
+#else
+    #define GRWL_BUILD_POSIX_FILE
+#endif
+
+#if defined(GRWL_BUILD_WIN32_FILE)
+    #include "win32/win32_file.hpp"
+    #define GRWL_PLATFORM_MAPPED_FILE_STATE GRWL_WIN32_MAPPED_FILE_STATE
+#elif defined(GRWL_BUILD_POSIX_FILE)
+    #include "posix_file.hpp"
+    #define GRWL_PLATFORM_MAPPED_FILE_STATE GRWL_POSIX_MAPPED_FILE_STATE
+#endif
+
+#if !defined(_WIN32)
     #define GRWL_BUILD_POSIX_POLL
 #endif
+
+#if defined(GRWL_BUILD_POSIX_POLL)
+    #include "linux/posix_poll.hpp"
+    #define GRWL_PLATFORM_LIBRARY_POLL_STATE GRWL_POSIX_LIBRARY_POLL_STATE
+#else
+    #define GRWL_PLATFORM_LIBRARY_POLL_STATE
+#endif
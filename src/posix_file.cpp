@@ -0,0 +1,131 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#if defined(GRWL_BUILD_POSIX_FILE)
+
+    #include <cassert>
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+// Maps the whole file at its current size
+//
+static bool mapFile(_GRWLmappedfile* file, size_t size)
+{
+    const int protection = file->writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    const int flags = file->writable ? MAP_SHARED : MAP_PRIVATE;
+
+    void* data = mmap(nullptr, size, protection, flags, file->posix.fd, 0);
+    if (data == MAP_FAILED)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to map file: %s", strerror(errno));
+        return false;
+    }
+
+    file->data = (unsigned char*)data;
+    file->size = size;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+bool _grwlPlatformCreateMappedFile(_GRWLmappedfile* file, const char* path, size_t size)
+{
+    assert(file->data == nullptr);
+    assert(size > 0);
+
+    file->posix.fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file->posix.fd == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create file %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    if (ftruncate(file->posix.fd, (off_t)size) == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to allocate file %s: %s", path, strerror(errno));
+        close(file->posix.fd);
+        return false;
+    }
+
+    file->writable = true;
+
+    if (!mapFile(file, size))
+    {
+        close(file->posix.fd);
+        return false;
+    }
+
+    return true;
+}
+
+bool _grwlPlatformOpenMappedFile(_GRWLmappedfile* file, const char* path)
+{
+    assert(file->data == nullptr);
+
+    file->posix.fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (file->posix.fd == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to open file %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(file->posix.fd, &info) == -1 || info.st_size == 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: File %s is empty or unreadable", path);
+        close(file->posix.fd);
+        return false;
+    }
+
+    file->writable = false;
+
+    if (!mapFile(file, (size_t)info.st_size))
+    {
+        close(file->posix.fd);
+        return false;
+    }
+
+    return true;
+}
+
+bool _grwlPlatformResizeMappedFile(_GRWLmappedfile* file, size_t size)
+{
+    assert(file->data != nullptr);
+    assert(file->writable);
+    assert(size > 0);
+
+    munmap(file->data, file->size);
+    file->data = nullptr;
+    file->size = 0;
+
+    if (ftruncate(file->posix.fd, (off_t)size) == -1)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to resize file: %s", strerror(errno));
+        return false;
+    }
+
+    return mapFile(file, size);
+}
+
+void _grwlPlatformCloseMappedFile(_GRWLmappedfile* file)
+{
+    if (file->data)
+    {
+        munmap(file->data, file->size);
+    }
+
+    close(file->posix.fd);
+    memset(file, 0, sizeof(_GRWLmappedfile));
+}
+
+#endif // GRWL_BUILD_POSIX_FILE
@@ -0,0 +1,13 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#define GRWL_POSIX_MAPPED_FILE_STATE _GRWLmappedfilePOSIX posix;
+
+// POSIX-specific memory-mapped file data
+//
+typedef struct _GRWLmappedfilePOSIX
+{
+    int fd;
+} _GRWLmappedfilePOSIX;
@@ -83,4 +83,76 @@ void _grwlPlatformUnlockMutex(_GRWLmutex* mutex)
     pthread_mutex_unlock(&mutex->posix.handle);
 }
 
+static void* threadMain(void* pointer)
+{
+    _GRWLthread* thread = (_GRWLthread*)pointer;
+    thread->function(thread->user);
+    return nullptr;
+}
+
+bool _grwlPlatformCreateThread(_GRWLthread* thread, _GRWLthreadfun function, void* user)
+{
+    assert(thread->posix.allocated == false);
+
+    thread->function = function;
+    thread->user = user;
+
+    if (pthread_create(&thread->posix.handle, nullptr, threadMain, thread) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create thread");
+        return false;
+    }
+
+    return thread->posix.allocated = true;
+}
+
+void _grwlPlatformJoinThread(_GRWLthread* thread)
+{
+    if (thread->posix.allocated)
+    {
+        pthread_join(thread->posix.handle, nullptr);
+    }
+    memset(thread, 0, sizeof(_GRWLthread));
+}
+
+bool _grwlPlatformCreateCondition(_GRWLcondition* condition)
+{
+    assert(condition->posix.allocated == false);
+
+    if (pthread_cond_init(&condition->posix.handle, nullptr) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "POSIX: Failed to create condition variable");
+        return false;
+    }
+
+    return condition->posix.allocated = true;
+}
+
+void _grwlPlatformDestroyCondition(_GRWLcondition* condition)
+{
+    if (condition->posix.allocated)
+    {
+        pthread_cond_destroy(&condition->posix.handle);
+    }
+    memset(condition, 0, sizeof(_GRWLcondition));
+}
+
+void _grwlPlatformWaitCondition(_GRWLcondition* condition, _GRWLmutex* mutex)
+{
+    assert(condition->posix.allocated == true);
+    pthread_cond_wait(&condition->posix.handle, &mutex->posix.handle);
+}
+
+void _grwlPlatformSignalCondition(_GRWLcondition* condition)
+{
+    assert(condition->posix.allocated == true);
+    pthread_cond_signal(&condition->posix.handle);
+}
+
+void _grwlPlatformBroadcastCondition(_GRWLcondition* condition)
+{
+    assert(condition->posix.allocated == true);
+    pthread_cond_broadcast(&condition->posix.handle);
+}
+
 #endif // GRWL_BUILD_POSIX_THREAD
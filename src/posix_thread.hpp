@@ -7,6 +7,8 @@
 
 #define GRWL_POSIX_TLS_STATE _GRWLtlsPOSIX posix;
 #define GRWL_POSIX_MUTEX_STATE _GRWLmutexPOSIX posix;
+#define GRWL_POSIX_THREAD_STATE _GRWLthreadPOSIX posix;
+#define GRWL_POSIX_CONDITION_STATE _GRWLconditionPOSIX posix;
 
 // POSIX-specific thread local storage data
 //
@@ -23,3 +25,19 @@ typedef struct _GRWLmutexPOSIX
     bool allocated;
     pthread_mutex_t handle;
 } _GRWLmutexPOSIX;
+
+// POSIX-specific thread data
+//
+typedef struct _GRWLthreadPOSIX
+{
+    bool allocated;
+    pthread_t handle;
+} _GRWLthreadPOSIX;
+
+// POSIX-specific condition variable data
+//
+typedef struct _GRWLconditionPOSIX
+{
+    bool allocated;
+    pthread_cond_t handle;
+} _GRWLconditionPOSIX;
@@ -0,0 +1,494 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define _GRWL_TEXT_SSE2
+    #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define _GRWL_TEXT_NEON
+    #include <arm_neon.h>
+#endif
+
+// Returns the number of bytes that are greater than the specified value when
+// treated as signed
+//
+static size_t countBytesAbove(const char* string, size_t length, signed char value)
+{
+    size_t count = 0, i = 0;
+
+#if defined(_GRWL_TEXT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i threshold = _mm_set1_epi8(value);
+
+    while (i + 16 <= length)
+    {
+        // Each byte of the sums can count at most 255 blocks
+        const size_t end = (length - i) / 16 > 255 ? i + 255 * 16 : length;
+        __m128i sums = zero;
+
+        for (; i + 16 <= end; i += 16)
+        {
+            const __m128i bytes = _mm_loadu_si128((const __m128i*)(string + i));
+            sums = _mm_sub_epi8(sums, _mm_cmpgt_epi8(bytes, threshold));
+        }
+
+        sums = _mm_sad_epu8(sums, zero);
+        count += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+#elif defined(_GRWL_TEXT_NEON)
+    const int8x16_t threshold = vdupq_n_s8(value);
+
+    while (i + 16 <= length)
+    {
+        // Each byte of the sums can count at most 255 blocks
+        const size_t end = (length - i) / 16 > 255 ? i + 255 * 16 : length;
+        uint8x16_t sums = vdupq_n_u8(0);
+
+        for (; i + 16 <= end; i += 16)
+        {
+            const int8x16_t bytes = vld1q_s8((const int8_t*)(string + i));
+            sums = vsubq_u8(sums, vcgtq_s8(bytes, threshold));
+        }
+
+        count += vaddlvq_u8(sums);
+    }
+#endif
+
+    for (; i < length; i++)
+    {
+        if ((signed char)string[i] > value)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Returns the number of occurrences of the specified byte
+//
+static size_t countByte(const char* string, size_t length, char c)
+{
+    size_t count = 0, i = 0;
+
+#if defined(_GRWL_TEXT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i value = _mm_set1_epi8(c);
+
+    while (i + 16 <= length)
+    {
+        // Each byte of the sums can count at most 255 blocks
+        const size_t end = (length - i) / 16 > 255 ? i + 255 * 16 : length;
+        __m128i sums = zero;
+
+        for (; i + 16 <= end; i += 16)
+        {
+            const __m128i bytes = _mm_loadu_si128((const __m128i*)(string + i));
+            sums = _mm_sub_epi8(sums, _mm_cmpeq_epi8(bytes, value));
+        }
+
+        sums = _mm_sad_epu8(sums, zero);
+        count += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+#elif defined(_GRWL_TEXT_NEON)
+    const uint8x16_t value = vdupq_n_u8((uint8_t)c);
+
+    while (i + 16 <= length)
+    {
+        // Each byte of the sums can count at most 255 blocks
+        const size_t end = (length - i) / 16 > 255 ? i + 255 * 16 : length;
+        uint8x16_t sums = vdupq_n_u8(0);
+
+        for (; i + 16 <= end; i += 16)
+        {
+            const uint8x16_t bytes = vld1q_u8((const uint8_t*)(string + i));
+            sums = vsubq_u8(sums, vceqq_u8(bytes, value));
+        }
+
+        count += vaddlvq_u8(sums);
+    }
+#endif
+
+    for (; i < length; i++)
+    {
+        if (string[i] == c)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Returns the number of leading ASCII characters
+//
+static size_t countASCII(const char* string, size_t length)
+{
+    size_t i = 0;
+
+#if defined(_GRWL_TEXT_SSE2)
+    for (; i + 16 <= length; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(string + i))))
+        {
+            break;
+        }
+    }
+#elif defined(_GRWL_TEXT_NEON)
+    for (; i + 16 <= length; i += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8((const uint8_t*)(string + i))) & 0x80)
+        {
+            break;
+        }
+    }
+#endif
+
+    while (i < length && !(string[i] & 0x80))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+// Widens the leading ASCII characters to code points and returns their number
+//
+static size_t decodeASCII(uint32_t* codepoints, const char* string, size_t length)
+{
+    size_t i = 0;
+
+#if defined(_GRWL_TEXT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)(string + i));
+        if (_mm_movemask_epi8(bytes))
+        {
+            break;
+        }
+
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128((__m128i*)(codepoints + i), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(codepoints + i + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(codepoints + i + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*)(codepoints + i + 12), _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(_GRWL_TEXT_NEON)
+    for (; i + 16 <= length; i += 16)
+    {
+        const uint8x16_t bytes = vld1q_u8((const uint8_t*)(string + i));
+        if (vmaxvq_u8(bytes) & 0x80)
+        {
+            break;
+        }
+
+        const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+        const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+        vst1q_u32(codepoints + i, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(codepoints + i + 4, vmovl_u16(vget_high_u16(low)));
+        vst1q_u32(codepoints + i + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(codepoints + i + 12, vmovl_u16(vget_high_u16(high)));
+    }
+#endif
+
+    for (; i < length && !(string[i] & 0x80); i++)
+    {
+        codepoints[i] = (unsigned char)string[i];
+    }
+
+    return i;
+}
+
+// Decodes a multi-byte UTF-8 sequence, or returns the replacement character and
+// skips a single byte if the sequence is invalid
+//
+static uint32_t decodeSequence(const char** s, const char* end)
+{
+    const unsigned char* c = (const unsigned char*)*s;
+    uint32_t codepoint, minimum;
+    int count;
+
+    if (c[0] >= 0xc2 && c[0] <= 0xdf)
+    {
+        codepoint = c[0] & 0x1f;
+        minimum = 0x80;
+        count = 1;
+    }
+    else if (c[0] >= 0xe0 && c[0] <= 0xef)
+    {
+        codepoint = c[0] & 0x0f;
+        minimum = 0x800;
+        count = 2;
+    }
+    else if (c[0] >= 0xf0 && c[0] <= 0xf4)
+    {
+        codepoint = c[0] & 0x07;
+        minimum = 0x10000;
+        count = 3;
+    }
+    else
+    {
+        (*s)++;
+        return 0xfffd;
+    }
+
+    if (end - *s <= count)
+    {
+        (*s)++;
+        return 0xfffd;
+    }
+
+    for (int i = 1; i <= count; i++)
+    {
+        if ((c[i] & 0xc0) != 0x80)
+        {
+            (*s)++;
+            return 0xfffd;
+        }
+
+        codepoint = (codepoint << 6) | (c[i] & 0x3f);
+    }
+
+    if (codepoint < minimum || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint <= 0xdfff))
+    {
+        (*s)++;
+        return 0xfffd;
+    }
+
+    *s += count + 1;
+    return codepoint;
+}
+
+// Returns the value of a hexadecimal digit, or -1 if it is not one
+//
+static int getHexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+// Copies a string while decoding percent-encoded bytes and returns the length
+// of the result
+//
+static size_t decodePercent(char* target, const char* source, size_t length)
+{
+    char* start = target;
+    const char* end = source + length;
+
+    for (;;)
+    {
+        const char* escape = (const char*)memchr(source, '%', end - source);
+        if (!escape)
+        {
+            memcpy(target, source, end - source);
+            target += end - source;
+            break;
+        }
+
+        memcpy(target, source, escape - source);
+        target += escape - source;
+        source = escape + 1;
+
+        if (end - source >= 2)
+        {
+            const int high = getHexValue(source[0]);
+            const int low = getHexValue(source[1]);
+
+            if (high >= 0 && low >= 0)
+            {
+                *target++ = (char)((high << 4) | low);
+                source += 2;
+                continue;
+            }
+        }
+
+        *target++ = '%';
+    }
+
+    return target - start;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Encode a Unicode code point to a UTF-8 stream
+// Based on cutef8 by Jeff Bezanson (Public Domain)
+//
+size_t _grwlEncodeUTF8(char* s, uint32_t codepoint)
+{
+    size_t count = 0;
+
+    if (codepoint < 0x80)
+    {
+        s[count++] = (char)codepoint;
+    }
+    else if (codepoint < 0x800)
+    {
+        s[count++] = (codepoint >> 6) | 0xc0;
+        s[count++] = (codepoint & 0x3f) | 0x80;
+    }
+    else if (codepoint < 0x10000)
+    {
+        s[count++] = (codepoint >> 12) | 0xe0;
+        s[count++] = ((codepoint >> 6) & 0x3f) | 0x80;
+        s[count++] = (codepoint & 0x3f) | 0x80;
+    }
+    else if (codepoint < 0x110000)
+    {
+        s[count++] = (codepoint >> 18) | 0xf0;
+        s[count++] = ((codepoint >> 12) & 0x3f) | 0x80;
+        s[count++] = ((codepoint >> 6) & 0x3f) | 0x80;
+        s[count++] = (codepoint & 0x3f) | 0x80;
+    }
+
+    return count;
+}
+
+// Decodes a UTF-8 string of the specified length in bytes to code points and
+// returns their number, which is at most the length
+// Invalid sequences are replaced with U+FFFD
+//
+size_t _grwlDecodeUTF8(uint32_t* codepoints, const char* string, size_t length)
+{
+    const char* end = string + length;
+    size_t count = 0;
+
+    while (string < end)
+    {
+        const size_t ascii = decodeASCII(codepoints + count, string, end - string);
+        string += ascii;
+        count += ascii;
+
+        if (string < end)
+        {
+            codepoints[count++] = decodeSequence(&string, end);
+        }
+    }
+
+    return count;
+}
+
+// Returns the number of code points in a UTF-8 string of the specified length in
+// bytes, counting each byte of an invalid sequence as one
+//
+size_t _grwlCountUTF8(const char* string, size_t length)
+{
+    // Every byte that is not a continuation byte (0x80 to 0xbf) starts a code point
+    return countBytesAbove(string, length, (signed char)0xbf);
+}
+
+// Returns the length in bytes of a Latin-1 string of the specified length once
+// converted to UTF-8
+//
+size_t _grwlGetLatin1LengthUTF8(const char* string, size_t length)
+{
+    // Every byte with the high bit set becomes two bytes
+    return 2 * length - countBytesAbove(string, length, -1);
+}
+
+// Converts a Latin-1 string of the specified length to UTF-8 and returns the
+// length of the result, which has no terminating null
+//
+size_t _grwlConvertLatin1toUTF8(char* target, const char* string, size_t length)
+{
+    char* start = target;
+    const char* end = string + length;
+
+    while (string < end)
+    {
+        const size_t ascii = countASCII(string, end - string);
+        memcpy(target, string, ascii);
+        string += ascii;
+        target += ascii;
+
+        // There are usually few non-ASCII characters in a row
+        while (string < end && (*string & 0x80))
+        {
+            target += _grwlEncodeUTF8(target, (unsigned char)*string);
+            string++;
+        }
+    }
+
+    return target - start;
+}
+
+// Splits and translates a text/uri-list into separate file paths
+// The paths are allocated from the arena and do not need to be freed
+//
+char** _grwlParseUriList(const char* text, int* count)
+{
+    const char* prefix = "file://";
+    const size_t prefixLength = strlen(prefix);
+
+    *count = 0;
+
+    // Every path is on a line of its own, so this is enough for all of them
+    const size_t length = strlen(text);
+    const size_t lineCount = countByte(text, length, '\n') + countByte(text, length, '\r') + 1;
+
+    char** paths = (char**)_grwlArenaAlloc(lineCount * sizeof(char*));
+    if (!paths)
+    {
+        return nullptr;
+    }
+
+    while (*text)
+    {
+        const char* line = text;
+        size_t lineLength = strcspn(line, "\r\n");
+
+        text += lineLength;
+        text += strspn(text, "\r\n");
+
+        if (lineLength == 0 || line[0] == '#')
+        {
+            continue;
+        }
+
+        if (lineLength >= prefixLength && strncmp(line, prefix, prefixLength) == 0)
+        {
+            // TODO: Validate hostname
+            const char* slash = (const char*)memchr(line + prefixLength, '/', lineLength - prefixLength);
+            if (!slash)
+            {
+                continue;
+            }
+
+            lineLength -= slash - line;
+            line += slash - line;
+        }
+
+        char* path = (char*)_grwlArenaAlloc(lineLength + 1);
+        if (!path)
+        {
+            break;
+        }
+
+        path[decodePercent(path, line, lineLength)] = '\0';
+        paths[(*count)++] = path;
+    }
+
+    return paths;
+}
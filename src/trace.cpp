@@ -0,0 +1,292 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(_GRWL_BUILD_TRACING)
+
+    #if defined(_WIN32)
+        #include <windows.h>
+    #else
+        #include <unistd.h>
+        #if defined(__linux__)
+            #include <sys/syscall.h>
+        #elif defined(__APPLE__)
+            #include <pthread.h>
+        #endif
+    #endif
+
+    // The number of zones kept per thread, must be a power of two
+    #define _GRWL_TRACE_CAPACITY 8192
+
+// A completed trace zone
+// The members are atomic so that they may be read while being overwritten
+//
+typedef struct _GRWLtraceevent
+{
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> start;
+    std::atomic<uint64_t> end;
+} _GRWLtraceevent;
+
+// A copy of a completed trace zone, taken while writing the trace
+//
+typedef struct _GRWLtracerecord
+{
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+} _GRWLtracerecord;
+
+// Per-thread ring buffer of trace zones
+// Only the owning thread writes to it, any thread may read it
+//
+typedef struct _GRWLtracebuffer
+{
+    _GRWLtracebuffer* next;
+    uint64_t threadID;
+    std::atomic<uint64_t> head;
+    _GRWLtraceevent events[_GRWL_TRACE_CAPACITY];
+} _GRWLtracebuffer;
+
+// The trace buffers of all threads that have recorded zones
+// Buffers are never freed so that the zones of exited threads remain available
+static std::atomic<_GRWLtracebuffer*> _grwlTraceBuffers;
+static thread_local _GRWLtracebuffer* _grwlTraceBuffer;
+
+#endif // _GRWL_BUILD_TRACING
+
+static std::atomic<GRWLtracestallfun> _grwlTraceStallCallback;
+static std::atomic<uint64_t> _grwlTraceStallThreshold;
+
+#if defined(_GRWL_BUILD_TRACING)
+
+// Returns the current time, in nanoseconds, of the clock used for tracing
+//
+static uint64_t getTraceTime()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+static uint64_t getProcessID()
+{
+    #if defined(_WIN32)
+    return GetCurrentProcessId();
+    #else
+    return (uint64_t)getpid();
+    #endif
+}
+
+static uint64_t getThreadID()
+{
+    #if defined(_WIN32)
+    return GetCurrentThreadId();
+    #elif defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+    #elif defined(__APPLE__)
+    uint64_t threadID;
+    pthread_threadid_np(nullptr, &threadID);
+    return threadID;
+    #else
+    static std::atomic<uint64_t> counter;
+    return ++counter;
+    #endif
+}
+
+// Returns the trace buffer of the calling thread, creating it if necessary
+//
+static _GRWLtracebuffer* getTraceBuffer()
+{
+    if (!_grwlTraceBuffer)
+    {
+        // NOTE: This does not use the library allocator, as zones may be recorded
+        //       before initialization and buffers outlive termination
+        _GRWLtracebuffer* buffer = (_GRWLtracebuffer*)calloc(1, sizeof(_GRWLtracebuffer));
+        if (!buffer)
+        {
+            return nullptr;
+        }
+
+        buffer->threadID = getThreadID();
+        buffer->next = _grwlTraceBuffers.load(std::memory_order_relaxed);
+        while (!_grwlTraceBuffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release,
+                                                        std::memory_order_relaxed))
+        {
+        }
+
+        _grwlTraceBuffer = buffer;
+    }
+
+    return _grwlTraceBuffer;
+}
+
+// Writes the recorded zones of a single thread ending at or after the cutoff
+//
+static void writeTraceBuffer(FILE* file, _GRWLtracebuffer* buffer, uint64_t pid, uint64_t cutoff, bool* first)
+{
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    const uint64_t tail = head > _GRWL_TRACE_CAPACITY ? head - _GRWL_TRACE_CAPACITY : 0;
+    const uint64_t count = head - tail;
+
+    _GRWLtracerecord* records = (_GRWLtracerecord*)calloc((size_t)count, sizeof(_GRWLtracerecord));
+    if (!records)
+    {
+        return;
+    }
+
+    for (uint64_t i = 0; i < count; i++)
+    {
+        const _GRWLtraceevent* event = buffer->events + ((tail + i) & (_GRWL_TRACE_CAPACITY - 1));
+        records[i].name = event->name.load(std::memory_order_relaxed);
+        records[i].start = event->start.load(std::memory_order_relaxed);
+        records[i].end = event->end.load(std::memory_order_relaxed);
+    }
+
+    // Discard any zones the owning thread may have overwritten while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t current = buffer->head.load(std::memory_order_relaxed);
+    const uint64_t valid = current >= _GRWL_TRACE_CAPACITY ? current - _GRWL_TRACE_CAPACITY + 1 : 0;
+
+    for (uint64_t i = 0; i < count; i++)
+    {
+        if (tail + i < valid)
+        {
+            continue;
+        }
+
+        if (records[i].end < cutoff)
+        {
+            continue;
+        }
+
+        fprintf(file,
+                "%s\n{\"name\":\"%s\",\"cat\":\"grwl\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%llu,\"tid\":%llu}",
+                *first ? "" : ",", records[i].name, records[i].start / 1e3, (records[i].end - records[i].start) / 1e3,
+                (unsigned long long)pid, (unsigned long long)buffer->threadID);
+
+        *first = false;
+    }
+
+    free(records);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+_GRWLtracezone::_GRWLtracezone(const char* name) : name(name), start(getTraceTime())
+{
+}
+
+_GRWLtracezone::~_GRWLtracezone()
+{
+    const uint64_t end = getTraceTime();
+
+    _GRWLtracebuffer* buffer = getTraceBuffer();
+    if (buffer)
+    {
+        const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+        _GRWLtraceevent* event = buffer->events + (head & (_GRWL_TRACE_CAPACITY - 1));
+
+        // Pairs with the fence in writeTraceBuffer so readers can detect overwritten zones
+        std::atomic_thread_fence(std::memory_order_release);
+        event->name.store(name, std::memory_order_relaxed);
+        event->start.store(start, std::memory_order_relaxed);
+        event->end.store(end, std::memory_order_relaxed);
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    const uint64_t threshold = _grwlTraceStallThreshold.load(std::memory_order_relaxed);
+    if (threshold && end - start >= threshold)
+    {
+        const GRWLtracestallfun callback = _grwlTraceStallCallback.load(std::memory_order_relaxed);
+        if (callback)
+        {
+            callback(name, (end - start) / 1e9);
+        }
+    }
+}
+
+#endif // _GRWL_BUILD_TRACING
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GRWL public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GRWLAPI int grwlWriteTrace(const char* path, double seconds)
+{
+    assert(path != nullptr);
+
+    if (seconds != seconds || seconds < 0.0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid trace duration %f", seconds);
+        return false;
+    }
+
+#if defined(_GRWL_BUILD_TRACING)
+    FILE* file = fopen(path, "w");
+    if (!file)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Failed to open trace file %s", path);
+        return false;
+    }
+
+    const uint64_t now = getTraceTime();
+    uint64_t cutoff = 0;
+
+    if (seconds > 0.0 && seconds * 1e9 < (double)now)
+    {
+        cutoff = now - (uint64_t)(seconds * 1e9);
+    }
+
+    const uint64_t pid = getProcessID();
+    bool first = true;
+
+    fputs("{\"traceEvents\":[", file);
+
+    _GRWLtracebuffer* buffer = _grwlTraceBuffers.load(std::memory_order_acquire);
+    while (buffer)
+    {
+        writeTraceBuffer(file, buffer, pid, cutoff, &first);
+        buffer = buffer->next;
+    }
+
+    fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+
+    if (fclose(file) != 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Failed to write trace file %s", path);
+        return false;
+    }
+
+    return true;
+#else
+    _grwlInputError(GRWL_FEATURE_UNAVAILABLE, "Tracing support was not compiled in");
+    return false;
+#endif
+}
+
+GRWLAPI void grwlSetTraceStallThreshold(double seconds)
+{
+    if (seconds != seconds || seconds < 0.0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid stall threshold %f", seconds);
+        return;
+    }
+
+    _grwlTraceStallThreshold.store((uint64_t)(seconds * 1e9), std::memory_order_relaxed);
+}
+
+GRWLAPI GRWLtracestallfun grwlSetTraceStallCallback(GRWLtracestallfun cbfun)
+{
+    return _grwlTraceStallCallback.exchange(cbfun);
+}
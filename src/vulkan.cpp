@@ -137,6 +137,10 @@ bool _grwlInitVulkan(int mode)
         {
             _grwl.vk.KHR_wayland_surface = true;
         }
+        else if (strcmp(ep[i].extensionName, "VK_EXT_headless_surface") == 0)
+        {
+            _grwl.vk.EXT_headless_surface = true;
+        }
     }
 
     _grwl_free(ep);
@@ -305,6 +309,7 @@ GRWLAPI VkResult grwlCreateWindowSurface(VkInstance instance, GRWLwindow* handle
     *surface = VK_NULL_HANDLE;
 
     _GRWL_REQUIRE_INIT_OR_RETURN(VK_ERROR_INITIALIZATION_FAILED);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, VK_ERROR_INITIALIZATION_FAILED);
 
     if (!_grwlInitVulkan(_GRWL_REQUIRE_LOADER))
     {
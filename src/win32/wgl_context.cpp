@@ -803,6 +803,7 @@ GRWLAPI HGLRC grwlGetWGLContext(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_WIN32)
     {
@@ -0,0 +1,187 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+
+#include "internal.hpp"
+
+#if defined(GRWL_BUILD_WIN32_FILE)
+
+    #include <cassert>
+    #include <cstring>
+
+// Returns a wide string version of the specified UTF-8 path
+//
+static WCHAR* createWidePath(const char* path)
+{
+    const int count = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+    if (!count)
+    {
+        return nullptr;
+    }
+
+    WCHAR* target = (WCHAR*)_grwl_calloc(count, sizeof(WCHAR));
+
+    if (!MultiByteToWideChar(CP_UTF8, 0, path, -1, target, count))
+    {
+        _grwl_free(target);
+        return nullptr;
+    }
+
+    return target;
+}
+
+// Opens a file with the specified access and creation disposition
+//
+static bool openFile(_GRWLmappedfile* file, const char* path, DWORD access, DWORD disposition)
+{
+    WCHAR* widePath = createWidePath(path);
+    if (!widePath)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to convert path %s", path);
+        return false;
+    }
+
+    file->win32.file =
+        CreateFileW(widePath, access, FILE_SHARE_READ, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+    _grwl_free(widePath);
+
+    if (file->win32.file == INVALID_HANDLE_VALUE)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to open file %s", path);
+        return false;
+    }
+
+    return true;
+}
+
+// Maps the whole file at the specified size
+//
+static bool mapFile(_GRWLmappedfile* file, size_t size)
+{
+    const DWORD protection = file->writable ? PAGE_READWRITE : PAGE_READONLY;
+    const DWORD access = file->writable ? FILE_MAP_WRITE : FILE_MAP_READ;
+    ULARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = size;
+
+    file->win32.mapping =
+        CreateFileMappingW(file->win32.file, nullptr, protection, mappingSize.HighPart, mappingSize.LowPart, nullptr);
+    if (!file->win32.mapping)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to create file mapping");
+        return false;
+    }
+
+    void* data = MapViewOfFile(file->win32.mapping, access, 0, 0, size);
+    if (!data)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to map view of file");
+        CloseHandle(file->win32.mapping);
+        file->win32.mapping = nullptr;
+        return false;
+    }
+
+    file->data = (unsigned char*)data;
+    file->size = size;
+    return true;
+}
+
+// Unmaps the file, leaving the file handle open
+//
+static void unmapFile(_GRWLmappedfile* file)
+{
+    if (file->data)
+    {
+        UnmapViewOfFile(file->data);
+        file->data = nullptr;
+        file->size = 0;
+    }
+
+    if (file->win32.mapping)
+    {
+        CloseHandle(file->win32.mapping);
+        file->win32.mapping = nullptr;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+bool _grwlPlatformCreateMappedFile(_GRWLmappedfile* file, const char* path, size_t size)
+{
+    assert(file->data == nullptr);
+    assert(size > 0);
+
+    if (!openFile(file, path, GENERIC_READ | GENERIC_WRITE, CREATE_ALWAYS))
+    {
+        return false;
+    }
+
+    file->writable = true;
+
+    if (!mapFile(file, size))
+    {
+        CloseHandle(file->win32.file);
+        return false;
+    }
+
+    return true;
+}
+
+bool _grwlPlatformOpenMappedFile(_GRWLmappedfile* file, const char* path)
+{
+    assert(file->data == nullptr);
+
+    if (!openFile(file, path, GENERIC_READ, OPEN_EXISTING))
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file->win32.file, &size) || size.QuadPart == 0)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: File %s is empty or unreadable", path);
+        CloseHandle(file->win32.file);
+        return false;
+    }
+
+    file->writable = false;
+
+    if (!mapFile(file, (size_t)size.QuadPart))
+    {
+        CloseHandle(file->win32.file);
+        return false;
+    }
+
+    return true;
+}
+
+bool _grwlPlatformResizeMappedFile(_GRWLmappedfile* file, size_t size)
+{
+    assert(file->data != nullptr);
+    assert(file->writable);
+    assert(size > 0);
+
+    unmapFile(file);
+
+    LARGE_INTEGER offset;
+    offset.QuadPart = (LONGLONG)size;
+
+    if (!SetFilePointerEx(file->win32.file, offset, nullptr, FILE_BEGIN) || !SetEndOfFile(file->win32.file))
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to resize file");
+        return false;
+    }
+
+    return mapFile(file, size);
+}
+
+void _grwlPlatformCloseMappedFile(_GRWLmappedfile* file)
+{
+    unmapFile(file);
+    CloseHandle(file->win32.file);
+    memset(file, 0, sizeof(_GRWLmappedfile));
+}
+
+#endif // GRWL_BUILD_WIN32_FILE
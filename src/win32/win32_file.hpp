@@ -0,0 +1,17 @@
+//===========================================================================
+// This file is part of GRWL(a fork of GLFW) licensed under the Zlib license.
+// See file LICENSE.md for full license details
+//===========================================================================
+#pragma once
+
+#include <windows.h>
+
+#define GRWL_WIN32_MAPPED_FILE_STATE _GRWLmappedfileWin32 win32;
+
+// Win32-specific memory-mapped file data
+//
+typedef struct _GRWLmappedfileWin32
+{
+    HANDLE file;
+    HANDLE mapping;
+} _GRWLmappedfileWin32;
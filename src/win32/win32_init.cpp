@@ -666,6 +666,9 @@ bool _grwlConnectWin32(int platformID, _GRWLplatform* platform)
         _grwlGetKeyboardLayoutNameWin32,
         _grwlSetClipboardStringWin32,
         _grwlGetClipboardStringWin32,
+        _grwlRequestClipboardStringDeferred,
+        _grwlSetClipboardDataWin32,
+        _grwlGetClipboardDataWin32,
         _grwlUpdatePreeditCursorRectangleWin32,
         _grwlResetPreeditTextWin32,
         _grwlSetIMEStatusWin32,
@@ -787,6 +790,7 @@ void _grwlTerminateWin32()
     }
 
     _grwl_free(_grwl.win32.clipboardString);
+    _grwl_free(_grwl.win32.clipboardData);
     _grwl_free(_grwl.win32.keyboardLayoutName);
     _grwl_free(_grwl.win32.rawInput);
 
@@ -812,6 +812,7 @@ typedef struct _GRWLlibraryWin32
     HDEVNOTIFY deviceNotificationHandle;
     int acquiredMonitorCount;
     char* clipboardString;
+    void* clipboardData;
     char* keyboardLayoutName;
     short int keycodes[512];
     short int scancodes[GRWL_KEY_LAST + 1];
@@ -946,7 +947,7 @@ bool _grwlCreateWindowWin32(_GRWLwindow* window, const _GRWLwndconfig* wndconfig
                             const _GRWLfbconfig* fbconfig);
 void _grwlDestroyWindowWin32(_GRWLwindow* window);
 void _grwlSetWindowTitleWin32(_GRWLwindow* window, const char* title);
-void _grwlSetWindowIconWin32(_GRWLwindow* window, int count, const GRWLimage* images);
+void _grwlSetWindowIconWin32(_GRWLwindow* window, int count, const GRWLformattedimage* images);
 void _grwlSetWindowProgressIndicatorWin32(_GRWLwindow* window, int progressState, double value);
 void _grwlSetWindowBadgeWin32(_GRWLwindow* window, int count);
 void _grwlSetWindowBadgeStringWin32(_GRWLwindow* window, const char* string);
@@ -995,12 +996,14 @@ void _grwlSetCursorModeWin32(_GRWLwindow* window, int mode);
 const char* _grwlGetScancodeNameWin32(int scancode);
 int _grwlGetKeyScancodeWin32(int key);
 const char* _grwlGetKeyboardLayoutNameWin32();
-bool _grwlCreateCursorWin32(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot);
+bool _grwlCreateCursorWin32(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot);
 bool _grwlCreateStandardCursorWin32(_GRWLcursor* cursor, int shape);
 void _grwlDestroyCursorWin32(_GRWLcursor* cursor);
 void _grwlSetCursorWin32(_GRWLwindow* window, _GRWLcursor* cursor);
 void _grwlSetClipboardStringWin32(const char* string);
 const char* _grwlGetClipboardStringWin32();
+void _grwlSetClipboardDataWin32(const char* mimeType, const void* data, size_t size);
+const void* _grwlGetClipboardDataWin32(const char* mimeType, size_t* size);
 
 void _grwlUpdatePreeditCursorRectangleWin32(_GRWLwindow* window);
 void _grwlResetPreeditTextWin32(_GRWLwindow* window);
@@ -8,6 +8,7 @@
 #if defined(GRWL_BUILD_WIN32_THREAD)
 
     #include <cassert>
+    #include <cstring>
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GRWL platform API                      //////
@@ -77,4 +78,69 @@ void _grwlPlatformUnlockMutex(_GRWLmutex* mutex)
     LeaveCriticalSection(&mutex->win32.section);
 }
 
+static DWORD WINAPI threadMain(LPVOID pointer)
+{
+    _GRWLthread* thread = (_GRWLthread*)pointer;
+    thread->function(thread->user);
+    return 0;
+}
+
+bool _grwlPlatformCreateThread(_GRWLthread* thread, _GRWLthreadfun function, void* user)
+{
+    assert(thread->win32.allocated == false);
+
+    thread->function = function;
+    thread->user = user;
+
+    thread->win32.handle = CreateThread(nullptr, 0, threadMain, thread, 0, nullptr);
+    if (!thread->win32.handle)
+    {
+        _grwlInputError(GRWL_PLATFORM_ERROR, "Win32: Failed to create thread");
+        return false;
+    }
+
+    return thread->win32.allocated = true;
+}
+
+void _grwlPlatformJoinThread(_GRWLthread* thread)
+{
+    if (thread->win32.allocated)
+    {
+        WaitForSingleObject(thread->win32.handle, INFINITE);
+        CloseHandle(thread->win32.handle);
+    }
+    memset(thread, 0, sizeof(_GRWLthread));
+}
+
+bool _grwlPlatformCreateCondition(_GRWLcondition* condition)
+{
+    assert(condition->win32.allocated == false);
+    InitializeConditionVariable(&condition->win32.handle);
+    return condition->win32.allocated = true;
+}
+
+void _grwlPlatformDestroyCondition(_GRWLcondition* condition)
+{
+    // Win32 condition variables do not need to be destroyed
+    memset(condition, 0, sizeof(_GRWLcondition));
+}
+
+void _grwlPlatformWaitCondition(_GRWLcondition* condition, _GRWLmutex* mutex)
+{
+    assert(condition->win32.allocated == true);
+    SleepConditionVariableCS(&condition->win32.handle, &mutex->win32.section, INFINITE);
+}
+
+void _grwlPlatformSignalCondition(_GRWLcondition* condition)
+{
+    assert(condition->win32.allocated == true);
+    WakeConditionVariable(&condition->win32.handle);
+}
+
+void _grwlPlatformBroadcastCondition(_GRWLcondition* condition)
+{
+    assert(condition->win32.allocated == true);
+    WakeAllConditionVariable(&condition->win32.handle);
+}
+
 #endif // GRWL_BUILD_WIN32_THREAD
@@ -8,6 +8,8 @@
 
 #define GRWL_WIN32_TLS_STATE _GRWLtlsWin32 win32;
 #define GRWL_WIN32_MUTEX_STATE _GRWLmutexWin32 win32;
+#define GRWL_WIN32_THREAD_STATE _GRWLthreadWin32 win32;
+#define GRWL_WIN32_CONDITION_STATE _GRWLconditionWin32 win32;
 
 // Win32-specific thread local storage data
 //
@@ -24,3 +26,19 @@ typedef struct _GRWLmutexWin32
     bool allocated;
     CRITICAL_SECTION section;
 } _GRWLmutexWin32;
+
+// Win32-specific thread data
+//
+typedef struct _GRWLthreadWin32
+{
+    bool allocated;
+    HANDLE handle;
+} _GRWLthreadWin32;
+
+// Win32-specific condition variable data
+//
+typedef struct _GRWLconditionWin32
+{
+    bool allocated;
+    CONDITION_VARIABLE handle;
+} _GRWLconditionWin32;
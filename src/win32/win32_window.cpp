@@ -114,10 +114,10 @@ static DWORD getWindowExStyle(const _GRWLwindow* window)
 
 // Returns the image whose area most closely matches the desired one
 //
-static const GRWLimage* chooseImage(int count, const GRWLimage* images, int width, int height)
+static const GRWLformattedimage* chooseImage(int count, const GRWLformattedimage* images, int width, int height)
 {
     int leastDiff = INT_MAX;
-    const GRWLimage* closest = nullptr;
+    const GRWLformattedimage* closest = nullptr;
 
     for (int i = 0; i < count; i++)
     {
@@ -134,7 +134,7 @@ static const GRWLimage* chooseImage(int count, const GRWLimage* images, int widt
 
 // Creates an RGBA icon or cursor
 //
-static HICON createIcon(const GRWLimage* image, int xhot, int yhot, bool icon)
+static HICON createIcon(const GRWLformattedimage* image, int xhot, int yhot, bool icon)
 {
     HDC dc;
     HICON handle;
@@ -142,7 +142,6 @@ static HICON createIcon(const GRWLimage* image, int xhot, int yhot, bool icon)
     BITMAPV5HEADER bi;
     ICONINFO ii;
     unsigned char* target = nullptr;
-    unsigned char* source = image->pixels;
 
     ZeroMemory(&bi, sizeof(bi));
     bi.bV5Size = sizeof(bi);
@@ -174,15 +173,7 @@ static HICON createIcon(const GRWLimage* image, int xhot, int yhot, bool icon)
         return nullptr;
     }
 
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        target[0] = source[2];
-        target[1] = source[1];
-        target[2] = source[0];
-        target[3] = source[3];
-        target += 4;
-        source += 4;
-    }
+    _grwlConvertImage(target, GRWL_IMAGE_BGRA, image);
 
     ZeroMemory(&ii, sizeof(ii));
     ii.fIcon = icon;
@@ -626,7 +617,7 @@ static void getImmCandidates(_GRWLwindow* window)
 
     {
         int bufferCount = preedit->candidateBufferCount;
-        LPCANDIDATELIST candidateList = (LPCANDIDATELIST)_grwl_calloc(candidateListBytes, 1);
+        LPCANDIDATELIST candidateList = (LPCANDIDATELIST)_grwlArenaAlloc(candidateListBytes);
         if (candidateList == nullptr)
         {
             ImmReleaseContext(window->win32.handle, hIMC);
@@ -645,7 +636,6 @@ static void getImmCandidates(_GRWLwindow* window)
                 (_GRWLpreeditcandidate*)_grwl_realloc(preedit->candidates, sizeof(_GRWLpreeditcandidate) * bufferCount);
             if (candidates == nullptr)
             {
-                _grwl_free(candidateList);
                 return;
             }
             // `realloc` does not initialize the increased area with 0.
@@ -670,8 +660,6 @@ static void getImmCandidates(_GRWLwindow* window)
         preedit->candidateSelection = candidateList->dwSelection;
         preedit->candidatePageStart = candidateList->dwPageStart;
         preedit->candidatePageSize = candidateList->dwPageSize;
-
-        _grwl_free(candidateList);
     }
 
     _grwlInputPreeditCandidate(window);
@@ -704,15 +692,12 @@ static bool getImmPreedit(_GRWLwindow* window)
         int textBufferCount = preedit->textBufferCount;
         int blockBufferCount = preedit->blockSizesBufferCount;
         int textLen = preeditBytes / sizeof(WCHAR);
-        LPWSTR buffer = (LPWSTR)_grwl_calloc(preeditBytes, 1);
-        LPSTR attributes = (LPSTR)_grwl_calloc(attrBytes, 1);
-        DWORD* clauses = (DWORD*)_grwl_calloc(clauseBytes, 1);
+        LPWSTR buffer = (LPWSTR)_grwlArenaAlloc(preeditBytes);
+        LPSTR attributes = attrBytes > 0 ? (LPSTR)_grwlArenaAlloc(attrBytes) : nullptr;
+        DWORD* clauses = clauseBytes > 0 ? (DWORD*)_grwlArenaAlloc(clauseBytes) : nullptr;
 
         if (!buffer || (attrBytes > 0 && !attributes) || (clauseBytes > 0 && !clauses))
         {
-            _grwl_free(buffer);
-            _grwl_free(attributes);
-            _grwl_free(clauses);
             ImmReleaseContext(window->win32.handle, hIMC);
             return false;
         }
@@ -740,9 +725,6 @@ static bool getImmPreedit(_GRWLwindow* window)
 
             if (preeditText == nullptr)
             {
-                _grwl_free(buffer);
-                _grwl_free(attributes);
-                _grwl_free(clauses);
                 ImmReleaseContext(window->win32.handle, hIMC);
                 return false;
             }
@@ -763,9 +745,6 @@ static bool getImmPreedit(_GRWLwindow* window)
 
             if (blocks == nullptr)
             {
-                _grwl_free(buffer);
-                _grwl_free(attributes);
-                _grwl_free(clauses);
                 ImmReleaseContext(window->win32.handle, hIMC);
                 return false;
             }
@@ -831,10 +810,6 @@ static bool getImmPreedit(_GRWLwindow* window)
             }
         }
 
-        _grwl_free(buffer);
-        _grwl_free(attributes);
-        _grwl_free(clauses);
-
         _grwlInputPreedit(window);
     }
 
@@ -883,7 +858,9 @@ static bool commitImmResultStr(_GRWLwindow* window)
         {
             if (convertToUTF32FromUTF16(buffer[i], &highSurrogate, &codepoint))
             {
+                _grwlBeginCallback();
                 window->callbacks.character((GRWLwindow*)window, codepoint);
+                _grwlEndCallback();
             }
         }
 
@@ -894,6 +871,24 @@ static bool commitImmResultStr(_GRWLwindow* window)
     return true;
 }
 
+// Converts a message time to the timer domain
+// Message times are from the GetTickCount clock, so the age of the message is
+// measured against that and applied to the current timer value
+//
+static uint64_t convertMessageTime(LONG time)
+{
+    const uint64_t now = _grwlPlatformGetTimerValue();
+    const DWORD age = GetTickCount() - (DWORD)time;
+    const uint64_t ticks = (uint64_t)age * _grwlPlatformGetTimerFrequency() / 1000;
+
+    if (age > 10000 || ticks > now)
+    {
+        return now;
+    }
+
+    return now - ticks;
+}
+
 // Window procedure for user-created windows
 //
 static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
@@ -2084,15 +2079,15 @@ void _grwlSetWindowTitleWin32(_GRWLwindow* window, const char* title)
     _grwl_free(wideTitle);
 }
 
-void _grwlSetWindowIconWin32(_GRWLwindow* window, int count, const GRWLimage* images)
+void _grwlSetWindowIconWin32(_GRWLwindow* window, int count, const GRWLformattedimage* images)
 {
     HICON bigIcon = nullptr, smallIcon = nullptr;
 
     if (count)
     {
-        const GRWLimage* bigImage =
+        const GRWLformattedimage* bigImage =
             chooseImage(count, images, GetSystemMetrics(SM_CXICON), GetSystemMetrics(SM_CYICON));
-        const GRWLimage* smallImage =
+        const GRWLformattedimage* smallImage =
             chooseImage(count, images, GetSystemMetrics(SM_CXSMICON), GetSystemMetrics(SM_CYSMICON));
 
         bigIcon = createIcon(bigImage, 0, 0, true);
@@ -3152,26 +3147,31 @@ void _grwlPollEventsWin32()
 
     while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE))
     {
+        _grwl.stats.events++;
+
         if (msg.message == WM_QUIT)
         {
             // NOTE: While GRWL does not itself post WM_QUIT, other processes
             //       may post it to this one, for example Task Manager
             // HACK: Treat WM_QUIT as a close on all windows
 
-            window = _grwl.windowListHead;
-            while (window)
+            // Iterate backwards as the close callback may destroy the window
+            for (int i = _grwl.windowCount - 1; i >= 0; i--)
             {
-                _grwlInputWindowCloseRequest(window);
-                window = window->next;
+                _grwlInputWindowCloseRequest(_grwl.windows[i]);
             }
         }
         else
         {
+            _grwl.eventTime = convertMessageTime(msg.time);
+
             TranslateMessage(&msg);
             DispatchMessageW(&msg);
         }
     }
 
+    _grwl.eventTime = 0;
+
     // HACK: Release modifier keys that the system did not emit KEYUP for
     // NOTE: Shift keys on Windows tend to "stick" when both are pressed as
     //       no key up message is generated by the first key release
@@ -3228,13 +3228,17 @@ void _grwlPollEventsWin32()
 void _grwlWaitEventsWin32()
 {
     WaitMessage();
+    _grwl.stats.pollWakeups++;
 
     _grwlPollEventsWin32();
 }
 
 void _grwlWaitEventsTimeoutWin32(double timeout)
 {
-    MsgWaitForMultipleObjects(0, nullptr, FALSE, (DWORD)(timeout * 1e3), QS_ALLEVENTS);
+    if (MsgWaitForMultipleObjects(0, nullptr, FALSE, (DWORD)(timeout * 1e3), QS_ALLEVENTS) == WAIT_OBJECT_0)
+    {
+        _grwl.stats.pollWakeups++;
+    }
 
     _grwlPollEventsWin32();
 }
@@ -3377,7 +3381,7 @@ const char* _grwlGetKeyboardLayoutNameWin32()
     return _grwl.win32.keyboardLayoutName;
 }
 
-bool _grwlCreateCursorWin32(_GRWLcursor* cursor, const GRWLimage* image, int xhot, int yhot)
+bool _grwlCreateCursorWin32(_GRWLcursor* cursor, const GRWLformattedimage* image, int xhot, int yhot)
 {
     cursor->win32.handle = (HCURSOR)createIcon(image, xhot, yhot, false);
     if (!cursor->win32.handle)
@@ -3534,6 +3538,181 @@ const char* _grwlGetClipboardStringWin32()
     return _grwl.win32.clipboardString;
 }
 
+// Returns the registered clipboard format for the specified MIME type
+//
+static UINT getClipboardFormat(const char* mimeType)
+{
+    WCHAR* wideType = _grwlCreateWideStringFromUTF8Win32(mimeType);
+    if (!wideType)
+    {
+        return 0;
+    }
+
+    const UINT format = RegisterClipboardFormatW(wideType);
+    _grwl_free(wideType);
+
+    if (!format)
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to register clipboard format");
+    }
+
+    return format;
+}
+
+    // The name of the companion format holding the exact size of clipboard data
+    #define _GRWL_CLIPBOARD_SIZE_FORMAT "GRWL Clipboard Data Size"
+
+// The exact size of clipboard data set by GRWL, as global memory objects may be
+// larger than requested
+//
+typedef struct _GRWLclipboardsizeWin32
+{
+    UINT format;
+    uint64_t size;
+} _GRWLclipboardsizeWin32;
+
+// Creates a global memory object holding a copy of the specified data
+//
+static HANDLE createGlobalObject(const void* data, size_t size)
+{
+    HANDLE object = GlobalAlloc(GMEM_MOVEABLE, size ? size : 1);
+    if (!object)
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to allocate global handle for clipboard");
+        return nullptr;
+    }
+
+    void* buffer = GlobalLock(object);
+    if (!buffer)
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to lock global handle");
+        GlobalFree(object);
+        return nullptr;
+    }
+
+    memcpy(buffer, data, size);
+    GlobalUnlock(object);
+
+    return object;
+}
+
+void _grwlSetClipboardDataWin32(const char* mimeType, const void* data, size_t size)
+{
+    const UINT format = getClipboardFormat(mimeType);
+    const UINT sizeFormat = getClipboardFormat(_GRWL_CLIPBOARD_SIZE_FORMAT);
+    if (!format || !sizeFormat)
+    {
+        return;
+    }
+
+    HANDLE object = createGlobalObject(data, size);
+    if (!object)
+    {
+        return;
+    }
+
+    const _GRWLclipboardsizeWin32 header = { format, size };
+    HANDLE sizeObject = createGlobalObject(&header, sizeof(header));
+    if (!sizeObject)
+    {
+        GlobalFree(object);
+        return;
+    }
+
+    if (!OpenClipboard(_grwl.win32.helperWindowHandle))
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to open clipboard");
+        GlobalFree(object);
+        GlobalFree(sizeObject);
+        return;
+    }
+
+    EmptyClipboard();
+
+    // The clipboard only takes ownership of objects it accepted
+    if (!SetClipboardData(format, object))
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to set clipboard data");
+        GlobalFree(object);
+        GlobalFree(sizeObject);
+        CloseClipboard();
+        return;
+    }
+
+    // Without the size the data is still readable, only possibly with padding
+    if (!SetClipboardData(sizeFormat, sizeObject))
+    {
+        GlobalFree(sizeObject);
+    }
+
+    CloseClipboard();
+}
+
+const void* _grwlGetClipboardDataWin32(const char* mimeType, size_t* size)
+{
+    const UINT format = getClipboardFormat(mimeType);
+    if (!format)
+    {
+        return nullptr;
+    }
+
+    if (!OpenClipboard(_grwl.win32.helperWindowHandle))
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to open clipboard");
+        return nullptr;
+    }
+
+    HANDLE object = GetClipboardData(format);
+    if (!object)
+    {
+        _grwlInputError(GRWL_FORMAT_UNAVAILABLE, "Win32: The clipboard has no data of type %s", mimeType);
+        CloseClipboard();
+        return nullptr;
+    }
+
+    const void* buffer = GlobalLock(object);
+    if (!buffer)
+    {
+        _grwlInputErrorWin32(GRWL_PLATFORM_ERROR, "Win32: Failed to lock global handle");
+        CloseClipboard();
+        return nullptr;
+    }
+
+    // The size of a global memory object may be rounded up from the size it was
+    // allocated with, so the exact size is used for data set by GRWL
+    size_t length = GlobalSize(object);
+
+    const UINT sizeFormat = getClipboardFormat(_GRWL_CLIPBOARD_SIZE_FORMAT);
+    HANDLE sizeObject = sizeFormat ? GetClipboardData(sizeFormat) : nullptr;
+    if (sizeObject)
+    {
+        const _GRWLclipboardsizeWin32* header = (const _GRWLclipboardsizeWin32*)GlobalLock(sizeObject);
+        if (header)
+        {
+            if (GlobalSize(sizeObject) >= sizeof(*header) && header->format == format && header->size <= length)
+            {
+                length = (size_t)header->size;
+            }
+
+            GlobalUnlock(sizeObject);
+        }
+    }
+
+    void* copy = _grwl_calloc(1, length ? length : 1);
+    if (copy)
+    {
+        memcpy(copy, buffer, length);
+        _grwl_free(_grwl.win32.clipboardData);
+        _grwl.win32.clipboardData = copy;
+        *size = length;
+    }
+
+    GlobalUnlock(object);
+    CloseClipboard();
+
+    return copy;
+}
+
 void _grwlUpdatePreeditCursorRectangleWin32(_GRWLwindow* window)
 {
     _GRWLpreedit* preedit = &window->preedit;
@@ -3713,6 +3892,7 @@ GRWLAPI HWND grwlGetWin32Window(GRWLwindow* handle)
 {
     _GRWLwindow* window = (_GRWLwindow*)handle;
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
 
     if (_grwl.platform.platformID != GRWL_PLATFORM_WIN32)
     {
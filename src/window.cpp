@@ -10,6 +10,113 @@
 #include <cstdlib>
 #include <cfloat>
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GRWL internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Allocates a zeroed window from the window slots and adds it to the window
+// array
+//
+_GRWLwindow* _grwlAllocWindow()
+{
+    char* array = (char*)_grwlReserveBuffer(_grwl.windows, &_grwl.windowArraySize,
+                                            ((size_t)_grwl.windowCount + 1) * sizeof(_GRWLwindow*));
+    if (!array)
+    {
+        return nullptr;
+    }
+
+    _grwl.windows = (_GRWLwindow**)array;
+
+    if (!_grwl.freeWindowHead)
+    {
+        _GRWLwindowblock* block = (_GRWLwindowblock*)_grwl_calloc(1, sizeof(_GRWLwindowblock));
+        if (!block)
+        {
+            return nullptr;
+        }
+
+        block->next = _grwl.windowBlockHead;
+        _grwl.windowBlockHead = block;
+
+        const int slotCount = sizeof(block->windows) / sizeof(block->windows[0]);
+        for (int i = 0; i < slotCount - 1; i++)
+        {
+            block->windows[i].nextFree = block->windows + i + 1;
+        }
+
+        _grwl.freeWindowHead = block->windows;
+        _grwl.freeWindowTail = block->windows + slotCount - 1;
+    }
+
+    _GRWLwindow* window = _grwl.freeWindowHead;
+    _grwl.freeWindowHead = window->nextFree;
+    if (!_grwl.freeWindowHead)
+    {
+        _grwl.freeWindowTail = nullptr;
+    }
+
+    const unsigned int generation = window->generation;
+    memset(window, 0, sizeof(_GRWLwindow));
+    window->generation = generation + 1;
+
+    window->index = _grwl.windowCount;
+    _grwl.windows[_grwl.windowCount++] = window;
+    return window;
+}
+
+// Removes the window from the window array and returns its slot
+// The slot is reused last, so that handles of recently destroyed windows are
+// detected
+//
+void _grwlFreeWindow(_GRWLwindow* window)
+{
+    _GRWLwindow* last = _grwl.windows[--_grwl.windowCount];
+    _grwl.windows[window->index] = last;
+    last->index = window->index;
+
+    window->generation++;
+    window->nextFree = nullptr;
+
+    if (_grwl.freeWindowTail)
+    {
+        _grwl.freeWindowTail->nextFree = window;
+    }
+    else
+    {
+        _grwl.freeWindowHead = window;
+    }
+
+    _grwl.freeWindowTail = window;
+}
+
+// Returns whether the specified window handle refers to an existing window
+//
+bool _grwlIsWindowAlive(const _GRWLwindow* window)
+{
+    return window && (window->generation & 1);
+}
+
+// Frees the window slots and the window array
+// All windows must have been destroyed
+//
+void _grwlTerminateWindows()
+{
+    while (_grwl.windowBlockHead)
+    {
+        _GRWLwindowblock* next = _grwl.windowBlockHead->next;
+        _grwl_free(_grwl.windowBlockHead);
+        _grwl.windowBlockHead = next;
+    }
+
+    _grwl_free(_grwl.windows);
+    _grwl.windows = nullptr;
+    _grwl.windowCount = 0;
+    _grwl.windowArraySize = 0;
+    _grwl.freeWindowHead = nullptr;
+    _grwl.freeWindowTail = nullptr;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GRWL event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -21,9 +128,23 @@ void _grwlInputWindowFocus(_GRWLwindow* window, bool focused)
     assert(window != nullptr);
     assert(focused == true || focused == false);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { focused };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_FOCUS, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_FOCUS, window);
+        queued->state.value = focused;
+    }
+
     if (window->callbacks.focus)
     {
+        _grwlBeginCallback();
         window->callbacks.focus((GRWLwindow*)window, focused);
+        _grwlEndCallback();
     }
 
     if (!focused)
@@ -54,9 +175,24 @@ void _grwlInputWindowPos(_GRWLwindow* window, int x, int y)
 {
     assert(window != nullptr);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { x, y };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_POS, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_POS, window);
+        queued->pos.x = x;
+        queued->pos.y = y;
+    }
+
     if (window->callbacks.pos)
     {
+        _grwlBeginCallback();
         window->callbacks.pos((GRWLwindow*)window, x, y);
+        _grwlEndCallback();
     }
 }
 
@@ -69,9 +205,24 @@ void _grwlInputWindowSize(_GRWLwindow* window, int width, int height)
     assert(width >= 0);
     assert(height >= 0);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { width, height };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_SIZE, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_SIZE, window);
+        queued->size.width = width;
+        queued->size.height = height;
+    }
+
     if (window->callbacks.size)
     {
+        _grwlBeginCallback();
         window->callbacks.size((GRWLwindow*)window, width, height);
+        _grwlEndCallback();
     }
 }
 
@@ -82,9 +233,23 @@ void _grwlInputWindowIconify(_GRWLwindow* window, bool iconified)
     assert(window != nullptr);
     assert(iconified == true || iconified == false);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { iconified };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_ICONIFY, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_ICONIFY, window);
+        queued->state.value = iconified;
+    }
+
     if (window->callbacks.iconify)
     {
+        _grwlBeginCallback();
         window->callbacks.iconify((GRWLwindow*)window, iconified);
+        _grwlEndCallback();
     }
 }
 
@@ -95,9 +260,23 @@ void _grwlInputWindowMaximize(_GRWLwindow* window, bool maximized)
     assert(window != nullptr);
     assert(maximized == true || maximized == false);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { maximized };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_MAXIMIZE, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_MAXIMIZE, window);
+        queued->state.value = maximized;
+    }
+
     if (window->callbacks.maximize)
     {
+        _grwlBeginCallback();
         window->callbacks.maximize((GRWLwindow*)window, maximized);
+        _grwlEndCallback();
     }
 }
 
@@ -110,9 +289,24 @@ void _grwlInputFramebufferSize(_GRWLwindow* window, int width, int height)
     assert(width >= 0);
     assert(height >= 0);
 
+    if (_grwl.record.recording)
+    {
+        const int data[] = { width, height };
+        _grwlRecordInput(_GRWL_RECORD_FRAMEBUFFER_SIZE, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_FRAMEBUFFER_SIZE, window);
+        queued->size.width = width;
+        queued->size.height = height;
+    }
+
     if (window->callbacks.fbsize)
     {
+        _grwlBeginCallback();
         window->callbacks.fbsize((GRWLwindow*)window, width, height);
+        _grwlEndCallback();
     }
 }
 
@@ -127,9 +321,24 @@ void _grwlInputWindowContentScale(_GRWLwindow* window, float xscale, float yscal
     assert(yscale > 0.f);
     assert(yscale < FLT_MAX);
 
+    if (_grwl.record.recording)
+    {
+        const float data[] = { xscale, yscale };
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_CONTENT_SCALE, window->serial, data, sizeof(data));
+    }
+
+    if (_grwl.queue.events)
+    {
+        GRWLevent* queued = _grwlQueueEvent(GRWL_EVENT_WINDOW_CONTENT_SCALE, window);
+        queued->scale.x = xscale;
+        queued->scale.y = yscale;
+    }
+
     if (window->callbacks.scale)
     {
+        _grwlBeginCallback();
         window->callbacks.scale((GRWLwindow*)window, xscale, yscale);
+        _grwlEndCallback();
     }
 }
 
@@ -139,9 +348,21 @@ void _grwlInputWindowDamage(_GRWLwindow* window)
 {
     assert(window != nullptr);
 
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_DAMAGE, window->serial, nullptr, 0);
+    }
+
+    if (_grwl.queue.events)
+    {
+        _grwlQueueEvent(GRWL_EVENT_WINDOW_REFRESH, window);
+    }
+
     if (window->callbacks.refresh)
     {
+        _grwlBeginCallback();
         window->callbacks.refresh((GRWLwindow*)window);
+        _grwlEndCallback();
     }
 }
 
@@ -151,11 +372,23 @@ void _grwlInputWindowCloseRequest(_GRWLwindow* window)
 {
     assert(window != nullptr);
 
+    if (_grwl.record.recording)
+    {
+        _grwlRecordInput(_GRWL_RECORD_WINDOW_CLOSE_REQUEST, window->serial, nullptr, 0);
+    }
+
     window->shouldClose = true;
 
+    if (_grwl.queue.events)
+    {
+        _grwlQueueEvent(GRWL_EVENT_WINDOW_CLOSE, window);
+    }
+
     if (window->callbacks.close)
     {
+        _grwlBeginCallback();
         window->callbacks.close((GRWLwindow*)window);
+        _grwlEndCallback();
     }
 }
 
@@ -178,6 +411,8 @@ GRWLAPI GRWLwindow* grwlCreateWindow(int width, int height, const char* title, G
     _GRWLwndconfig wndconfig;
     _GRWLwindow* window;
 
+    _GRWL_TRACE_ZONE("grwlCreateWindow");
+
     assert(title != nullptr);
     assert(width >= 0);
     assert(height >= 0);
@@ -200,14 +435,23 @@ GRWLAPI GRWLwindow* grwlCreateWindow(int width, int height, const char* title, G
     wndconfig.title = title;
     ctxconfig.share = (_GRWLwindow*)share;
 
+    if (ctxconfig.share)
+    {
+        _GRWL_REQUIRE_WINDOW_OR_RETURN(ctxconfig.share, nullptr);
+    }
+
     if (!_grwlIsValidContextConfig(&ctxconfig))
     {
         return nullptr;
     }
 
-    window = (_GRWLwindow*)_grwl_calloc(1, sizeof(_GRWLwindow));
-    window->next = _grwl.windowListHead;
-    _grwl.windowListHead = window;
+    window = _grwlAllocWindow();
+    if (!window)
+    {
+        return nullptr;
+    }
+
+    window->serial = ++_grwl.windowSerial;
 
     window->videoMode.width = width;
     window->videoMode.height = height;
@@ -475,6 +719,8 @@ GRWLAPI void grwlDestroyWindow(GRWLwindow* handle)
         return;
     }
 
+    _GRWL_REQUIRE_WINDOW(window);
+
     // Clear all callbacks to avoid exposing a half torn-down window object
     memset(&window->callbacks, 0, sizeof(window->callbacks));
 
@@ -485,18 +731,13 @@ GRWLAPI void grwlDestroyWindow(GRWLwindow* handle)
         grwlMakeContextCurrent(nullptr);
     }
 
+    _grwlStopContextWorkers(window);
     _grwl.platform.destroyWindow(window);
+    _grwlFreeContextTables(&window->context);
 
-    // Unlink window from global linked list
+    if (_grwl.queue.events)
     {
-        _GRWLwindow** prev = &_grwl.windowListHead;
-
-        while (*prev != window)
-        {
-            prev = &((*prev)->next);
-        }
-
-        *prev = window->next;
+        _grwlDiscardQueuedEvents(window);
     }
 
     // Clear memory for preedit text
@@ -508,7 +749,8 @@ GRWLAPI void grwlDestroyWindow(GRWLwindow* handle)
     {
         _grwl_free(window->preedit.blockSizes);
     }
-    _grwl_free(window);
+
+    _grwlFreeWindow(window);
 }
 
 GRWLAPI int grwlWindowShouldClose(GRWLwindow* handle)
@@ -517,6 +759,7 @@ GRWLAPI int grwlWindowShouldClose(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(0);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, 0);
     return window->shouldClose;
 }
 
@@ -526,6 +769,7 @@ GRWLAPI void grwlSetWindowShouldClose(GRWLwindow* handle, int value)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     window->shouldClose = value;
 }
 
@@ -536,6 +780,7 @@ GRWLAPI void grwlSetWindowTitle(GRWLwindow* handle, const char* title)
     assert(title != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.setWindowTitle(window, title);
 }
 
@@ -548,6 +793,41 @@ GRWLAPI void grwlSetWindowIcon(GRWLwindow* handle, int count, const GRWLimage* i
     assert(count == 0 || images != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
+
+    if (count <= 0)
+    {
+        grwlSetWindowIconFormatted(handle, count, nullptr);
+        return;
+    }
+
+    GRWLformattedimage* formatted = (GRWLformattedimage*)_grwl_calloc(count, sizeof(GRWLformattedimage));
+    if (!formatted)
+    {
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        formatted[i].width = images[i].width;
+        formatted[i].height = images[i].height;
+        formatted[i].pixels = images[i].pixels;
+    }
+
+    grwlSetWindowIconFormatted(handle, count, formatted);
+    _grwl_free(formatted);
+}
+
+GRWLAPI void grwlSetWindowIconFormatted(GRWLwindow* handle, int count, const GRWLformattedimage* images)
+{
+    _GRWLwindow* window = (_GRWLwindow*)handle;
+
+    assert(window != nullptr);
+    assert(count >= 0);
+    assert(count == 0 || images != nullptr);
+
+    _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (count < 0)
     {
@@ -564,6 +844,18 @@ GRWLAPI void grwlSetWindowIcon(GRWLwindow* handle, int count, const GRWLimage* i
             _grwlInputError(GRWL_INVALID_VALUE, "Invalid image dimensions for window icon");
             return;
         }
+
+        if (images[i].format < GRWL_IMAGE_RGBA || images[i].format > GRWL_IMAGE_BGRA_PREMULTIPLIED)
+        {
+            _grwlInputError(GRWL_INVALID_ENUM, "Invalid image format 0x%08X for window icon", images[i].format);
+            return;
+        }
+
+        if (images[i].stride != 0 && images[i].stride / 4 < images[i].width)
+        {
+            _grwlInputError(GRWL_INVALID_VALUE, "Invalid image stride %i for window icon", images[i].stride);
+            return;
+        }
     }
 
     _grwl.platform.setWindowIcon(window, count, images);
@@ -576,6 +868,7 @@ GRWLAPI void grwlSetWindowProgressIndicator(GRWLwindow* handle, int progressStat
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (value < 0.0 || value > 1.0)
     {
@@ -599,6 +892,7 @@ GRWLAPI void grwlSetWindowBadge(GRWLwindow* handle, int count)
     _GRWLwindow* window = (_GRWLwindow*)handle;
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (count < 0)
     {
@@ -614,6 +908,7 @@ GRWLAPI void grwlSetWindowBadgeString(GRWLwindow* handle, const char* string)
     _GRWLwindow* window = (_GRWLwindow*)handle;
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     _grwl.platform.setWindowBadgeString(window, string);
 }
@@ -633,6 +928,7 @@ GRWLAPI void grwlGetWindowPos(GRWLwindow* handle, int* xpos, int* ypos)
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.getWindowPos(window, xpos, ypos);
 }
 
@@ -642,6 +938,7 @@ GRWLAPI void grwlSetWindowPos(GRWLwindow* handle, int xpos, int ypos)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->monitor)
     {
@@ -666,6 +963,7 @@ GRWLAPI void grwlGetWindowSize(GRWLwindow* handle, int* width, int* height)
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.getWindowSize(window, width, height);
 }
 
@@ -677,6 +975,7 @@ GRWLAPI void grwlSetWindowSize(GRWLwindow* handle, int width, int height)
     assert(height >= 0);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     window->videoMode.width = width;
     window->videoMode.height = height;
@@ -690,6 +989,7 @@ GRWLAPI void grwlSetWindowSizeLimits(GRWLwindow* handle, int minwidth, int minhe
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (minwidth != GRWL_DONT_CARE && minheight != GRWL_DONT_CARE)
     {
@@ -730,6 +1030,7 @@ GRWLAPI void grwlSetWindowAspectRatio(GRWLwindow* handle, int numer, int denom)
     assert(denom != 0);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (numer != GRWL_DONT_CARE && denom != GRWL_DONT_CARE)
     {
@@ -766,6 +1067,7 @@ GRWLAPI void grwlGetFramebufferSize(GRWLwindow* handle, int* width, int* height)
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.getFramebufferSize(window, width, height);
 }
 
@@ -792,6 +1094,7 @@ GRWLAPI void grwlGetWindowFrameSize(GRWLwindow* handle, int* left, int* top, int
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.getWindowFrameSize(window, left, top, right, bottom);
 }
 
@@ -810,6 +1113,7 @@ GRWLAPI void grwlGetWindowContentScale(GRWLwindow* handle, float* xscale, float*
     }
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.getWindowContentScale(window, xscale, yscale);
 }
 
@@ -819,6 +1123,7 @@ GRWLAPI float grwlGetWindowOpacity(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(1.f);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, 1.f);
     return _grwl.platform.getWindowOpacity(window);
 }
 
@@ -831,6 +1136,7 @@ GRWLAPI void grwlSetWindowOpacity(GRWLwindow* handle, float opacity)
     assert(opacity <= 1.f);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (opacity != opacity || opacity < 0.f || opacity > 1.f)
     {
@@ -847,6 +1153,7 @@ GRWLAPI void grwlIconifyWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.iconifyWindow(window);
 }
 
@@ -856,6 +1163,7 @@ GRWLAPI void grwlRestoreWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     _grwl.platform.restoreWindow(window);
 }
 
@@ -865,6 +1173,7 @@ GRWLAPI void grwlMaximizeWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->monitor)
     {
@@ -880,6 +1189,7 @@ GRWLAPI void grwlShowWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->monitor)
     {
@@ -900,6 +1210,7 @@ GRWLAPI void grwlRequestWindowAttention(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     _grwl.platform.requestWindowAttention(window);
 }
@@ -910,6 +1221,7 @@ GRWLAPI void grwlHideWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (window->monitor)
     {
@@ -925,6 +1237,7 @@ GRWLAPI void grwlFocusWindow(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     _grwl.platform.focusWindow(window);
 }
@@ -935,6 +1248,7 @@ GRWLAPI int grwlGetWindowAttrib(GRWLwindow* handle, int attrib)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(0);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, 0);
 
     switch (attrib)
     {
@@ -998,6 +1312,7 @@ GRWLAPI void grwlSetWindowAttrib(GRWLwindow* handle, int attrib, int value)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     value = value ? true : false;
 
@@ -1050,6 +1365,7 @@ GRWLAPI GRWLmonitor* grwlGetWindowMonitor(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     return (GRWLmonitor*)window->monitor;
 }
 
@@ -1063,6 +1379,7 @@ GRWLAPI void grwlSetWindowMonitor(GRWLwindow* wh, GRWLmonitor* mh, int xpos, int
     assert(height >= 0);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
 
     if (width <= 0 || height <= 0)
     {
@@ -1089,6 +1406,7 @@ GRWLAPI void grwlSetWindowUserPointer(GRWLwindow* handle, void* pointer)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT();
+    _GRWL_REQUIRE_WINDOW(window);
     window->userPointer = pointer;
 }
 
@@ -1098,6 +1416,7 @@ GRWLAPI void* grwlGetWindowUserPointer(GRWLwindow* handle)
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     return window->userPointer;
 }
 
@@ -1107,6 +1426,7 @@ GRWLAPI GRWLwindowposfun grwlSetWindowPosCallback(GRWLwindow* handle, GRWLwindow
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowposfun, window->callbacks.pos, cbfun);
     return cbfun;
 }
@@ -1117,6 +1437,7 @@ GRWLAPI GRWLwindowsizefun grwlSetWindowSizeCallback(GRWLwindow* handle, GRWLwind
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowsizefun, window->callbacks.size, cbfun);
     return cbfun;
 }
@@ -1127,6 +1448,7 @@ GRWLAPI GRWLwindowclosefun grwlSetWindowCloseCallback(GRWLwindow* handle, GRWLwi
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowclosefun, window->callbacks.close, cbfun);
     return cbfun;
 }
@@ -1137,6 +1459,7 @@ GRWLAPI GRWLwindowrefreshfun grwlSetWindowRefreshCallback(GRWLwindow* handle, GR
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowrefreshfun, window->callbacks.refresh, cbfun);
     return cbfun;
 }
@@ -1147,6 +1470,7 @@ GRWLAPI GRWLwindowfocusfun grwlSetWindowFocusCallback(GRWLwindow* handle, GRWLwi
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowfocusfun, window->callbacks.focus, cbfun);
     return cbfun;
 }
@@ -1157,6 +1481,7 @@ GRWLAPI GRWLwindowiconifyfun grwlSetWindowIconifyCallback(GRWLwindow* handle, GR
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowiconifyfun, window->callbacks.iconify, cbfun);
     return cbfun;
 }
@@ -1167,6 +1492,7 @@ GRWLAPI GRWLwindowmaximizefun grwlSetWindowMaximizeCallback(GRWLwindow* handle,
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowmaximizefun, window->callbacks.maximize, cbfun);
     return cbfun;
 }
@@ -1177,6 +1503,7 @@ GRWLAPI GRWLframebuffersizefun grwlSetFramebufferSizeCallback(GRWLwindow* handle
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLframebuffersizefun, window->callbacks.fbsize, cbfun);
     return cbfun;
 }
@@ -1187,6 +1514,7 @@ GRWLAPI GRWLwindowcontentscalefun grwlSetWindowContentScaleCallback(GRWLwindow*
     assert(window != nullptr);
 
     _GRWL_REQUIRE_INIT_OR_RETURN(nullptr);
+    _GRWL_REQUIRE_WINDOW_OR_RETURN(window, nullptr);
     _GRWL_SWAP(GRWLwindowcontentscalefun, window->callbacks.scale, cbfun);
     return cbfun;
 }
@@ -1194,14 +1522,20 @@ GRWLAPI GRWLwindowcontentscalefun grwlSetWindowContentScaleCallback(GRWLwindow*
 GRWLAPI void grwlPollEvents()
 {
     _GRWL_REQUIRE_INIT();
+    _grwlResetArena();
     _grwl.platform.pollEvents();
+    _grwlProcessMessages();
+    _grwlProcessContextJobs();
 }
 
 GRWLAPI void grwlWaitEvents()
 {
     _GRWL_REQUIRE_INIT();
+    _grwlResetArena();
     _grwl.platform.waitEvents();
     _grwlPollAllJoysticks();
+    _grwlProcessMessages();
+    _grwlProcessContextJobs();
 }
 
 GRWLAPI void grwlWaitEventsTimeout(double timeout)
@@ -1217,7 +1551,10 @@ GRWLAPI void grwlWaitEventsTimeout(double timeout)
         return;
     }
 
+    _grwlResetArena();
     _grwl.platform.waitEventsTimeout(timeout);
+    _grwlProcessMessages();
+    _grwlProcessContextJobs();
 }
 
 GRWLAPI void grwlPostEmptyEvent()
@@ -1225,3 +1562,61 @@ GRWLAPI void grwlPostEmptyEvent()
     _GRWL_REQUIRE_INIT();
     _grwl.platform.postEmptyEvent();
 }
+
+GRWLAPI int grwlGetEventFd()
+{
+    _GRWL_REQUIRE_INIT_OR_RETURN(-1);
+
+#if defined(GRWL_BUILD_POSIX_POLL) && defined(__linux__)
+    if (_grwl.poll.initialized)
+    {
+        return _grwl.poll.epoll;
+    }
+#endif
+
+    _grwlInputError(GRWL_FEATURE_UNAVAILABLE, "The event loop file descriptor is not available on this platform");
+    return -1;
+}
+
+GRWLAPI int grwlAddWatchFd(int fd, int events, GRWLwatchfun callback, void* user)
+{
+    assert(callback != nullptr);
+
+    _GRWL_REQUIRE_INIT_OR_RETURN(false);
+
+    if (fd < 0)
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid file descriptor %i", fd);
+        return false;
+    }
+
+    if (events & ~(GRWL_WATCH_READ | GRWL_WATCH_WRITE | GRWL_WATCH_ERROR))
+    {
+        _grwlInputError(GRWL_INVALID_VALUE, "Invalid watch events 0x%08X", events);
+        return false;
+    }
+
+#if defined(GRWL_BUILD_POSIX_POLL)
+    if (_grwl.poll.initialized)
+    {
+        return _grwlAddWatchPOSIX(fd, events, callback, user);
+    }
+#endif
+
+    _grwlInputError(GRWL_FEATURE_UNAVAILABLE, "Watching file descriptors is not available on this platform");
+    return false;
+}
+
+GRWLAPI void grwlRemoveWatchFd(int fd)
+{
+    _GRWL_REQUIRE_INIT();
+
+#if defined(GRWL_BUILD_POSIX_POLL)
+    if (_grwlRemoveWatchPOSIX(fd))
+    {
+        return;
+    }
+#endif
+
+    _grwlInputError(GRWL_INVALID_VALUE, "File descriptor %i is not being watched", fd);
+}